@@ -51,7 +51,7 @@ gvolume.make_trapezoid(shape2_dxa * 0.5, shape2_dxb * 0.5, shape2_dya * 0.5, sha
 gvolume.material = 'G4_BONE_COMPACT_ICRU'
 gvolume.color = 'lightpink'
 gvolume.set_position(0, -10, 70)
-gvolume.digitization = 'dosimeter'     # collects edep, dose
+gvolume.digitization = 'dosimeter'     # collects edep, dose, NIEL weight, dose equivalent
 gvolume.set_identifier('mydosimeter', 1)
 gvolume.opacity = 0.6
 gvolume.publish(cfg)
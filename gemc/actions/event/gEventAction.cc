@@ -4,6 +4,7 @@
 // geant4
 #include "G4Event.hh"
 #include "G4Threading.hh"
+#include "Randomize.hh"
 
 // c++
 #include <string>
@@ -17,6 +18,7 @@
 #include <algorithm>
 #include <cctype>
 #include <chrono>
+#include <limits>
 #include <sstream>
 #include <unordered_set>
 
@@ -105,12 +107,23 @@ GEventAction::GEventAction(const std::shared_ptr<GOptions>& gopt, GRunAction* ru
 	GBase(gopt, EVENTACTION_LOGGER),
 	goptions(gopt),
 	run_action(run_a),
-	track_provenance(std::move(provenance)) {
+	track_provenance(std::move(provenance)),
+	skim(gopt, log) {
 	const auto thread_id = G4Threading::G4GetThreadId();
 	const auto desc      = "GEventAction " + std::to_string(thread_id);
 	log->debug(CONSTRUCTOR, FUNCTION_NAME, desc);
 	save_all_ancestors  = goptions->getSwitch(SAVE_ALL_ANCESTORS_SWITCH);
 	save_original_track = goptions->getSwitch(SAVE_ORIGINAL_TRACK_SWITCH) || save_all_ancestors;
+	digitization_threads = goptions->getRequiredScalarInt(DIGITIZATION_THREADS_OPTION);
+	digitization_chunk   = static_cast<size_t>(std::max(1, goptions->getRequiredScalarInt(DIGITIZATION_CHUNK_OPTION)));
+	if (digitization_threads > 1) {
+		// Started once and reused by every event, each helper keeping its own digitization contexts.
+		digitization_pool = std::make_unique<GHelperPool>(
+			static_cast<size_t>(digitization_threads),
+			[thread_id](size_t helper) {
+				GDynamicDigitization::bindThreadContextSlot(GDynamicDigitization::helperContextSlot(thread_id, helper));
+			});
+	}
 
 	// Parse the log_every option of the form N or N-NTH. Anything malformed disables the
 	// feature and is reported once (from thread 0) to avoid duplicated warnings across workers.
@@ -197,6 +210,11 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 	const auto event_id  = event->GetEventID();
 
 	auto gevent_header       = std::make_unique<GEventHeader>(goptions, event_id, thread_id);
+	const auto& event_seeds  = GPrimaryGeneratorAction::currentEventSeeds();
+	if (event_seeds[0] != 0) { gevent_header->setRandomSeeds(event_seeds[0], event_seeds[1]); }
+	if (const int replayed = GPrimaryGeneratorAction::currentReplayedEvent(); replayed >= 0) {
+		gevent_header->setReplayedEvent(replayed);
+	}
 	auto eventDataCollection = std::make_shared<GEventDataCollection>(goptions, std::move(gevent_header));
 	eventDataCollection->setGeneratedParticles(
 		make_generated_particle_bank(GPrimaryGeneratorAction::currentGeneratedParticleRecords()));
@@ -205,8 +223,10 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 
 	auto* const hcs_this_event = event->GetHCofThisEvent();
 	if (hcs_this_event == nullptr) {
-		if (!eventDataCollection->getGeneratedParticles().empty() ||
-		    !eventDataCollection->getGeneratedTrackedParticles().empty()) {
+		const bool has_generated = !eventDataCollection->getGeneratedParticles().empty() ||
+			!eventDataCollection->getGeneratedTrackedParticles().empty();
+		run_action->complete_frame_event(event_id);
+		if (has_generated && (skim.keep_rejected() || skim.accept(*eventDataCollection))) {
 			publish_event_data(eventDataCollection);
 		}
 		return;
@@ -224,8 +244,10 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 	const bool also_reject_true_info = scalar_bool_option_enabled(goptions, "also_reject_true_info");
 	std::unordered_set<int> ancestor_track_ids;
 
-	// Loop over every hit collection produced during this event and dispatch each
-	// collection to the digitization routine registered under its collection name.
+	// Resolve every hit collection produced during this event to the digitization routine
+	// registered under its collection name.
+	std::vector<CollectionContext> collections;
+	size_t                         total_hits = 0;
 	for (G4int hci = 0; hci < hcs_this_event->GetNumberOfCollections(); ++hci) {
 		auto* const this_ghc = static_cast<GHitsCollection*>(hcs_this_event->GetHC(hci));
 		if (this_ghc == nullptr) {
@@ -233,8 +255,6 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 		}
 
 		const std::string hcSDName = this_ghc->GetSDname();
-		const bool no_digitized = detector_is_listed(goptions, NO_DIGITIZED_OPTION, hcSDName);
-		const bool no_true_info = detector_is_listed(goptions, NO_TRUE_INFO_OPTION, hcSDName);
 
 		log->info(2, FUNCTION_NAME, " worker ", thread_id,
 				  " for event number ", event_id,
@@ -258,81 +278,71 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 			continue;
 		}
 
-		const auto collection_mode = digitization_routine->collection_mode();
-		size_t accepted_hit_index = 0;
+		collections.push_back({
+			hcSDName,
+			this_ghc,
+			digitization_routine,
+			digitization_routine->collection_mode(),
+			detector_is_listed(goptions, NO_DIGITIZED_OPTION, hcSDName),
+			!needs_true_info(hcSDName),
+			also_reject_true_info
+		});
+		total_hits += this_ghc->GetSize();
+	}
 
+	// Helper threads do not share the worker's random engine: their seeds derive from one draw, made
+	// on every event whether it fans out or not, so the worker's random sequence does not depend on
+	// which events crossed the parallel threshold.
+	const long helper_seed = digitization_pool != nullptr ?
+		CLHEP::RandFlat::shootInt(std::numeric_limits<int>::max()) : 0;
+
+	// Fan out only when the event has more than one chunk of work; otherwise the helper threads
+	// would cost more than they save.
+	const bool parallel = digitization_threads > 1 &&
+		(collections.size() > 1 || total_hits > digitization_chunk);
+
+	if (parallel) {
+		digitize_collections_in_parallel(collections, helper_seed, *eventDataCollection, ancestor_track_ids,
+		                                 has_event_mode_payload, has_run_mode_payload);
+	}
+	else {
 		// Process all hits in the collection. Event-mode digitizers append to the
 		// event container, while run-mode digitizers append to the run container.
-		for (size_t hitIndex = 0; hitIndex < this_ghc->GetSize(); ++hitIndex) {
-
-			auto* const this_hit = static_cast<GHit*>(this_ghc->GetHit(hitIndex));
-			if (this_hit == nullptr) {
-				continue;
-			}
-			if (save_all_ancestors) {
-				const auto track_ids = this_hit->getTids();
-				ancestor_track_ids.insert(track_ids.begin(), track_ids.end());
+		// Each collection is handed to its routine as one batch.
+		for (const auto& ctx : collections) {
+			const size_t             nhits = ctx.hits->GetSize();
+			std::vector<HitProducts> products(nhits);
+			digitize_hits(ctx, 0, nhits, products);
+
+			size_t accepted_hit_index = 0;
+			for (size_t hitIndex = 0; hitIndex < nhits; ++hitIndex) {
+				if (products[hitIndex].hit == nullptr) { continue; }
+				assign_output_index(ctx, hitIndex, products[hitIndex], accepted_hit_index);
 			}
+			collect_true_info(ctx, 0, nhits, products);
 
-			auto digi_data = no_digitized ? nullptr : digitization_routine->digitizeHit(this_hit, hitIndex);
-			bool hit_accepted = digi_data != nullptr;
-
-			// Apply post-digitization threshold and efficiency policies. Plugins may declare a
-			// policy intrinsic or leave it controlled by -applyThresholds / -applyInefficiencies.
-			// Both are evaluated so the detector's random-number sequence remains stable.
-			if (hit_accepted) {
-				const bool skip_threshold  = digitization_routine->apply_thresholds(this_hit, digi_data.get());
-				const bool skip_efficiency = digitization_routine->apply_efficiency(this_hit, digi_data.get());
-				if (skip_threshold || skip_efficiency) {
-					digi_data.reset();
-					hit_accepted = false;
-				}
+			for (auto& hit_products : products) {
+				if (hit_products.hit == nullptr) { continue; }
+				route_hit_products(ctx, hit_products, *eventDataCollection, ancestor_track_ids,
+				                   has_event_mode_payload, has_run_mode_payload);
 			}
+		}
+	}
 
-			if (collection_mode == CollectionMode::event) {
-				if (hit_accepted) {
-					++accepted_hit_index;
-					digi_data->includeVariable("hitn", static_cast<int>(accepted_hit_index));
-					run_action->record_analysis_digitized(hcSDName, *digi_data);
-					eventDataCollection->addDetectorDigitizedData(hcSDName, std::move(digi_data));
-					has_event_mode_payload = true;
-				}
-			}
-			else if (collection_mode == CollectionMode::run) {
-				if (hit_accepted) {
-					run_action->record_analysis_digitized(hcSDName, *digi_data);
-					run_action->collect_event_data_collections(
-						hcSDName,
-						std::move(digi_data));
-					has_run_mode_payload = true;
-				}
-			}
+	// Frames are continuous in time: frame-mode hits are not subject to the event skim.
+	run_action->complete_frame_event(event_id);
 
-			// Event output already requires true information. In GUI analysis mode, request it for
-			// run-mode plugins too so their runtime-defined variables can be discovered without an API schema.
-			const bool collect_true = !no_true_info &&
-				(no_digitized || hit_accepted || !also_reject_true_info) &&
-				(collection_mode == CollectionMode::event || run_action->analysis_enabled());
-			if (collect_true) {
-				const size_t output_hit_index = collection_mode == CollectionMode::event && hit_accepted
-					? accepted_hit_index : hitIndex + 1;
-				auto true_data = digitization_routine->collectTrueInformation(this_hit, output_hit_index);
-				if (save_original_track && track_provenance != nullptr && true_data != nullptr) {
-					const int           tid = this_hit->getTid();
-					const G4ThreeVector op  = track_provenance->originalTrackMomentum(tid);
-					true_data->includeVariable("otid", track_provenance->originalTrackId(tid));
-					true_data->includeVariable("opid", track_provenance->originalTrackPid(tid));
-					true_data->includeVariable("opx", op.getX());
-					true_data->includeVariable("opy", op.getY());
-					true_data->includeVariable("opz", op.getZ());
-				}
-				if (true_data != nullptr) { run_action->record_analysis_true(hcSDName, *true_data); }
-				if (collection_mode == CollectionMode::event) {
-					eventDataCollection->addDetectorTrueInfoData(hcSDName, std::move(true_data));
-					has_event_mode_payload = true;
-				}
-			}
-		}
+	// Record whether this event contributed at least one run-mode payload entry.
+	if (has_run_mode_payload) {
+		run_action->increment_run_events_with_payload();
+	}
+
+	// The skim runs on the completed event, before any streamer sees it. Rejected events skip
+	// serialization entirely unless -skim_keep_rejected asks to publish them without true info.
+	if (skim.enabled() && !skim.accept(*eventDataCollection)) {
+		log->info(2, FUNCTION_NAME, " event ", event_id, " rejected by the skim");
+		if (!skim.keep_rejected()) { return; }
+		eventDataCollection->clearTrueInfoData();
 	}
 
 	if (save_all_ancestors && track_provenance != nullptr) {
@@ -340,10 +350,8 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 			make_ancestor_bank(track_provenance->ancestorsForTracks(ancestor_track_ids)));
 	}
 
-	// Record whether this event contributed at least one run-mode payload entry.
-	if (has_run_mode_payload) {
-		run_action->increment_run_events_with_payload();
-	}
+	// The event is complete: freeze it so every streamer reads the same detector-grouped views.
+	eventDataCollection->freeze();
 
 	// Publish event-mode output once, after all collections have been processed.
 	if (has_event_mode_payload ||
@@ -354,6 +362,185 @@ void GEventAction::EndOfEventAction([[maybe_unused]] const G4Event* event) {
 	}
 }
 
+// Digitize a range of hits and apply post-digitization threshold and efficiency policies. Plugins
+// may declare a policy intrinsic or leave it controlled by -applyThresholds / -applyInefficiencies.
+// The routine receives the whole range at once and writes into preallocated records.
+void GEventAction::digitize_hits(const CollectionContext& ctx, size_t begin, size_t end,
+                                 std::vector<HitProducts>& products) const {
+	std::vector<GHit*> hits(end - begin);
+	for (size_t i = 0; i < hits.size(); ++i) {
+		hits[i]                 = static_cast<GHit*>(ctx.hits->GetHit(begin + i));
+		products[begin + i].hit = hits[i];
+	}
+	if (ctx.no_digitized) { return; }
+
+	std::vector<std::unique_ptr<GDigitizedData>> digitized(hits.size());
+	ctx.routine->digitizeHits(hits, begin, digitized);
+	ctx.routine->apply_rejection_policies(hits, digitized);
+
+	for (size_t i = 0; i < hits.size(); ++i) {
+		products[begin + i].accepted  = digitized[i] != nullptr;
+		products[begin + i].digi_data = std::move(digitized[i]);
+	}
+}
+
+// Event output already requires true information. In GUI analysis mode, request it for
+// run-mode plugins too so their runtime-defined variables can be discovered without an API schema.
+void GEventAction::assign_output_index(const CollectionContext& ctx, size_t hitIndex, HitProducts& products,
+                                       size_t& accepted_hit_index) const {
+	const bool event_mode = ctx.mode == CollectionMode::event;
+	if (event_mode && products.accepted) { ++accepted_hit_index; }
+
+	products.collect_true = !ctx.no_true_info &&
+		(ctx.no_digitized || products.accepted || !ctx.also_reject_true_info) &&
+		(event_mode || run_action->analysis_enabled());
+	products.output_hit_index = event_mode && products.accepted ? accepted_hit_index : hitIndex + 1;
+}
+
+// Resolved once per collection per event: the streamer selections are fixed for the whole run.
+bool GEventAction::needs_true_info(const std::string& sdName) const {
+	if (detector_is_listed(goptions, NO_TRUE_INFO_OPTION, sdName)) { return false; }
+	return run_action->analysis_enabled() || skim.uses_detector(sdName) || run_action->streams_true_info(sdName);
+}
+
+void GEventAction::collect_true_info(const CollectionContext& ctx, size_t begin, size_t end,
+                                     std::vector<HitProducts>& products) const {
+	// Gather the hits that requested true information, collect them in one call, scatter the results.
+	std::vector<GHit*>  hits;
+	std::vector<size_t> hitns;
+	std::vector<size_t> slots;
+	for (size_t hitIndex = begin; hitIndex < end; ++hitIndex) {
+		const auto& hit_products = products[hitIndex];
+		if (hit_products.hit == nullptr || !hit_products.collect_true) { continue; }
+		hits.push_back(hit_products.hit);
+		hitns.push_back(hit_products.output_hit_index);
+		slots.push_back(hitIndex);
+	}
+	if (hits.empty()) { return; }
+
+	std::vector<std::unique_ptr<GTrueInfoData>> trueInfo(hits.size());
+	ctx.routine->collectHitsTrueInformation(hits, hitns, trueInfo);
+	for (size_t i = 0; i < slots.size(); ++i) { products[slots[i]].true_data = std::move(trueInfo[i]); }
+}
+
+// Route one hit's products in hit order: event-mode digitizers append to the event container,
+// run-mode digitizers append to the run container, frame-mode digitizers stage a frame hit.
+void GEventAction::route_hit_products(const CollectionContext& ctx, HitProducts& products,
+                                      GEventDataCollection& eventDataCollection,
+                                      std::unordered_set<int>& ancestor_track_ids,
+                                      bool& has_event_mode_payload, bool& has_run_mode_payload) const {
+	if (save_all_ancestors) {
+		const auto track_ids = products.hit->getTids();
+		ancestor_track_ids.insert(track_ids.begin(), track_ids.end());
+	}
+
+	if (ctx.mode == CollectionMode::event) {
+		if (products.accepted) {
+			products.digi_data->includeVariable("hitn", static_cast<int>(products.output_hit_index));
+			run_action->record_analysis_digitized(ctx.sdName, *products.digi_data);
+			eventDataCollection.addDetectorDigitizedData(ctx.sdName, std::move(products.digi_data));
+			has_event_mode_payload = true;
+		}
+	}
+	else if (ctx.mode == CollectionMode::run) {
+		if (products.accepted) {
+			run_action->record_analysis_digitized(ctx.sdName, *products.digi_data);
+			run_action->collect_event_data_collections(ctx.sdName, std::move(products.digi_data));
+			has_run_mode_payload = true;
+		}
+	}
+	else if (ctx.mode == CollectionMode::frame) {
+		if (products.accepted) {
+			run_action->record_analysis_digitized(ctx.sdName, *products.digi_data);
+			run_action->collect_frame_hit(*products.digi_data);
+		}
+	}
+
+	if (!products.collect_true) { return; }
+
+	auto& true_data = products.true_data;
+	if (save_original_track && track_provenance != nullptr && true_data != nullptr) {
+		const int           tid = products.hit->getTid();
+		const G4ThreeVector op  = track_provenance->originalTrackMomentum(tid);
+		true_data->includeVariable("otid", track_provenance->originalTrackId(tid));
+		true_data->includeVariable("opid", track_provenance->originalTrackPid(tid));
+		true_data->includeVariable("opx", op.getX());
+		true_data->includeVariable("opy", op.getY());
+		true_data->includeVariable("opz", op.getZ());
+	}
+	if (true_data != nullptr) { run_action->record_analysis_true(ctx.sdName, *true_data); }
+	if (ctx.mode == CollectionMode::event) {
+		eventDataCollection.addDetectorTrueInfoData(ctx.sdName, std::move(true_data));
+		has_event_mode_payload = true;
+	}
+}
+
+// The same hash as the per-event seeds, keyed by (helper seed, phase, chunk) instead of (seed, run, event).
+void GEventAction::seedHelperEngine(long helper_seed, int phase, size_t chunk) {
+	const auto seeds           = GPrimaryGeneratorAction::eventSeeds(helper_seed, phase, static_cast<int>(chunk));
+	long       engine_seeds[3] = {seeds[0], seeds[1], 0};
+	G4Random::setTheSeeds(engine_seeds);
+}
+
+// Split the event's collections in chunks, digitize the chunks on helper threads, and route the
+// products serially so the event content and order match the serial path.
+void GEventAction::digitize_collections_in_parallel(const std::vector<CollectionContext>& collections,
+                                                    long helper_seed,
+                                                    GEventDataCollection& eventDataCollection,
+                                                    std::unordered_set<int>& ancestor_track_ids,
+                                                    bool& has_event_mode_payload,
+                                                    bool& has_run_mode_payload) const {
+	struct Chunk
+	{
+		size_t collection;
+		size_t begin;
+		size_t end;
+	};
+
+	std::vector<std::vector<HitProducts>> products(collections.size());
+	std::vector<Chunk>                    chunks;
+	for (size_t c = 0; c < collections.size(); ++c) {
+		const size_t nhits = collections[c].hits->GetSize();
+		products[c].resize(nhits);
+		for (size_t begin = 0; begin < nhits; begin += digitization_chunk) {
+			chunks.push_back({c, begin, std::min(nhits, begin + digitization_chunk)});
+		}
+	}
+
+	log->info(2, FUNCTION_NAME, " digitizing ", chunks.size(), " chunks on ",
+	          std::min(digitization_pool->size(), chunks.size()), " helper threads");
+
+	// A task exception is rethrown here, on the worker thread, after the helpers are idle again.
+	digitization_pool->run(chunks.size(), [&](size_t task) {
+		const auto& chunk = chunks[task];
+		seedHelperEngine(helper_seed, 0, task);
+		digitize_hits(collections[chunk.collection], chunk.begin, chunk.end, products[chunk.collection]);
+	});
+
+	// Accepted event-mode hits are numbered in hit order, which only the serial pass can do.
+	for (size_t c = 0; c < collections.size(); ++c) {
+		size_t accepted_hit_index = 0;
+		for (size_t hitIndex = 0; hitIndex < products[c].size(); ++hitIndex) {
+			if (products[c][hitIndex].hit == nullptr) { continue; }
+			assign_output_index(collections[c], hitIndex, products[c][hitIndex], accepted_hit_index);
+		}
+	}
+
+	digitization_pool->run(chunks.size(), [&](size_t task) {
+		const auto& chunk = chunks[task];
+		seedHelperEngine(helper_seed, 1, task);
+		collect_true_info(collections[chunk.collection], chunk.begin, chunk.end, products[chunk.collection]);
+	});
+
+	for (size_t c = 0; c < collections.size(); ++c) {
+		for (auto& hit_products : products[c]) {
+			if (hit_products.hit == nullptr) { continue; }
+			route_hit_products(collections[c], hit_products, eventDataCollection, ancestor_track_ids,
+			                   has_event_mode_payload, has_run_mode_payload);
+		}
+	}
+}
+
 // Send the completed event-data object to every configured worker-thread streamer.
 void GEventAction::publish_event_data(const std::shared_ptr<GEventDataCollection>& event_data) const {
 	if (run_action == nullptr || event_data == nullptr) {
@@ -6,9 +6,14 @@
 // gemc
 #include <gemc/gbase/gbase.h>
 #include <gemc/actions/run/gRunAction.h>
+#include "gEventSkim.h"
+#include "gHelperPool.h"
 
 // c++
 #include <chrono>
+#include <memory>
+#include <unordered_set>
+#include <vector>
 
 class GTrackProvenance;
 
@@ -35,6 +40,16 @@ constexpr const char* SAVE_ALL_ANCESTORS_SWITCH = "save_all_ancestors";
 constexpr const char* NO_DIGITIZED_OPTION = "no_digitized";
 constexpr const char* NO_TRUE_INFO_OPTION = "no_true_info";
 
+/**
+ * \brief Name of the option selecting how many threads digitize one event's hit collections.
+ *
+ * 0 or 1 keeps the serial path. Larger values fan the event's collections, split in chunks of
+ * \c digitization_chunk hits, out to that many helper threads. Output order is unchanged.
+ */
+constexpr const char* DIGITIZATION_THREADS_OPTION = "digitization_threads";
+constexpr const char* DIGITIZATION_CHUNK_OPTION   = "digitization_chunk";
+constexpr int         DEFAULT_DIGITIZATION_CHUNK  = 2000;
+
 /**
  * \brief Namespace containing helpers related to event-action configuration.
  *
@@ -89,6 +104,32 @@ namespace geventaction {
 			"Use \"all\" to disable true-information output for every detector. Default: none.\n \n"
 			"Example: -no_true_info=\"ftof, ecal\"");
 
+		help = "Number of threads used to digitize the hit collections of one event.\n \n";
+		help += guts::GTAB;
+		help += "0 or 1 digitizes serially on the event worker thread (default). Larger values split each\n";
+		help += guts::GTAB;
+		help += "collection in chunks of digitization_chunk hits and process the chunks on a pool of helper\n";
+		help += guts::GTAB;
+		help += "threads. Output content and order match the serial path; plugins drawing random numbers use\n";
+		help += guts::GTAB;
+		help += "per-chunk seeds derived from one worker-engine draw per event, so their sequence is reproducible\n";
+		help += guts::GTAB;
+		help += "but differs from serial mode. Events with a single chunk are always digitized serially; the draw\n";
+		help += guts::GTAB;
+		help += "is made for them too, so the worker's random sequence does not depend on the event sizes.\n \n";
+		help += guts::GTAB;
+		help += "Example: -digitization_threads=4\n";
+		goptions.defineOption(
+			GVariable(DIGITIZATION_THREADS_OPTION, 0, "number of threads digitizing one event"), help);
+		goptions.defineOption(
+			GVariable(DIGITIZATION_CHUNK_OPTION, DEFAULT_DIGITIZATION_CHUNK,
+			          "hits per parallel digitization task"),
+			"Maximum number of hits of one collection handled by a single parallel digitization task.\n"
+			"Only used when digitization_threads > 1. Default: 2000.\n \n"
+			"Example: -digitization_chunk=500");
+
+		goptions += geventskim::defineOptions(EVENTACTION_LOGGER);
+
 		return goptions;
 	}
 } // namespace geventaction
@@ -109,6 +150,7 @@ namespace geventaction {
  * - conversion of hits into digitized payload and true-information payload;
  * - storage of event-mode output in the event data collection;
  * - storage of run-mode output in the run-level collection owned by GRunAction;
+ * - event skim (GEventSkim), which can drop the event or its true information;
  * - publication of completed event data through the worker-thread streamers.
  *
  * Ownership:
@@ -157,15 +199,108 @@ public:
 	 * - retrieve the hit collections associated with the event;
 	 * - resolve the proper digitization routine for each collection;
 	 * - digitize each hit and collect its truth information;
-	 * - route produced payload to event-mode or run-mode accumulation depending on
+	 * - route produced payload to event-mode, run-mode, or frame accumulation depending on
 	 *   the digitizer collection mode;
+	 * - hand the event frame-mode hits to the run frame builder;
 	 * - publish the event data once all event-mode collections have been processed.
 	 *
 	 * \param event Geant4 event descriptor for the event being completed.
 	 */
 	void EndOfEventAction(const G4Event* event) override;
 
+	/**
+	 * \brief Seeds the calling thread's random engine for one parallel digitization task.
+	 *
+	 * The engine seeds are a fixed hash of the event's helper seed, the phase and the chunk index,
+	 * so a chunk sees the same random sequence whichever helper thread runs it.
+	 *
+	 * \param helper_seed Seed drawn from the worker engine once per event.
+	 * \param phase 0 for digitization, 1 for true-information collection.
+	 * \param chunk Index of the chunk in the event.
+	 */
+	static void seedHelperEngine(long helper_seed, int phase, size_t chunk);
+
 private:
+	/**
+	 * \brief Per-event view of one hit collection and the routine that digitizes it.
+	 *
+	 * Resolved once per collection so per-hit work, serial or parallel, only reads plain fields.
+	 */
+	struct CollectionContext
+	{
+		std::string                           sdName;
+		GHitsCollection*                      hits = nullptr;
+		std::shared_ptr<GDynamicDigitization> routine;
+		CollectionMode                        mode                  = CollectionMode::event;
+		bool                                  no_digitized          = false;
+		bool                                  no_true_info          = false;
+		bool                                  also_reject_true_info = true;
+	};
+
+	/**
+	 * \brief Products of one hit, kept in hit order until they are routed to the output containers.
+	 */
+	struct HitProducts
+	{
+		GHit*                           hit = nullptr;
+		std::unique_ptr<GDigitizedData> digi_data;
+		std::unique_ptr<GTrueInfoData>  true_data;
+		bool                            accepted         = false;
+		bool                            collect_true     = false;
+		size_t                          output_hit_index = 0;
+	};
+
+	/**
+	 * \brief Digitizes hits \p begin to \p end of a collection and applies the routine's threshold
+	 * and efficiency policies, through the routine's collection-level entry points.
+	 *
+	 * Touches only those hits and their own products, so distinct ranges can be processed concurrently.
+	 */
+	void digitize_hits(const CollectionContext& ctx, size_t begin, size_t end, std::vector<HitProducts>& products) const;
+
+	/**
+	 * \brief Decides whether true information is needed for a hit and assigns its output index.
+	 *
+	 * Must run in hit order: event-mode accepted hits are numbered by \p accepted_hit_index.
+	 */
+	void assign_output_index(const CollectionContext& ctx, size_t hitIndex, HitProducts& products,
+	                         size_t& accepted_hit_index) const;
+
+	/**
+	 * \brief Returns whether the true information of a detector has a consumer in this run.
+	 *
+	 * True information feeds the streamers selecting it, the event skim, and the GUI analysis.
+	 * Detectors listed in \c -no_true_info never collect it.
+	 */
+	[[nodiscard]] bool needs_true_info(const std::string& sdName) const;
+
+	/// Collects, in one routine call, the true information of the hits in \p begin to \p end that requested it.
+	void collect_true_info(const CollectionContext& ctx, size_t begin, size_t end,
+	                       std::vector<HitProducts>& products) const;
+
+	/**
+	 * \brief Moves one hit's products into the event or run containers, in hit order.
+	 *
+	 * Also records analysis samples, original-track provenance and ancestor track ids.
+	 */
+	void route_hit_products(const CollectionContext& ctx, HitProducts& products,
+	                        GEventDataCollection& eventDataCollection,
+	                        std::unordered_set<int>& ancestor_track_ids,
+	                        bool& has_event_mode_payload, bool& has_run_mode_payload) const;
+
+	/**
+	 * \brief Digitizes the given collections on helper threads and routes the products in serial order.
+	 *
+	 * Phase one digitizes hit chunks concurrently; output indices are then assigned serially; phase
+	 * two collects true information concurrently; products are finally routed collection by
+	 * collection, hit by hit, exactly as the serial path does. Each task seeds its helper engine
+	 * with seedHelperEngine() from \p helper_seed.
+	 */
+	void digitize_collections_in_parallel(const std::vector<CollectionContext>& collections, long helper_seed,
+	                                      GEventDataCollection& eventDataCollection,
+	                                      std::unordered_set<int>& ancestor_track_ids,
+	                                      bool& has_event_mode_payload, bool& has_run_mode_payload) const;
+
 	/**
 	 * \brief Publishes a completed event data collection to all worker-thread streamers.
 	 *
@@ -225,8 +360,20 @@ private:
 	/// Worker-local provenance registry shared with the corresponding tracking action.
 	std::shared_ptr<GTrackProvenance> track_provenance;
 
+	/// Event selection applied before publishing; constructed after the logger exists.
+	GEventSkim skim;
+
 	bool save_original_track = false;
 	bool save_all_ancestors  = false;
+
+	/// Helper threads used to digitize one event; values below 2 select the serial path.
+	int digitization_threads = 0;
+
+	/// Maximum number of hits handled by one parallel digitization task.
+	size_t digitization_chunk = DEFAULT_DIGITIZATION_CHUNK;
+
+	/// Persistent helper threads of the parallel path; null when digitization is serial.
+	std::unique_ptr<GHelperPool> digitization_pool;
 };
 
 // looping over output factories
@@ -0,0 +1,90 @@
+// gemc
+#include "gEventSkim.h"
+#include "gEventAction.h"
+#include "../gactionConventions.h"
+
+// c++
+#include <algorithm>
+#include <charconv>
+#include <sstream>
+
+// See header for API docs.
+GEventSkim::GEventSkim(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log) {
+	parse_conditions(gopts, log, SKIM_MIN_HITS_OPTION, Quantity::hits);
+	parse_conditions(gopts, log, SKIM_MIN_EDEP_OPTION, Quantity::edep);
+	keep_rejected_events = gopts->getSwitch(SKIM_KEEP_REJECTED_SWITCH);
+
+	// Rejected hits keep their true information unless also_reject_true_info is set, so the
+	// true-information count only stands in for detectors that are never digitized.
+	std::string not_digitized = gopts->getOptionalScalarString(NO_DIGITIZED_OPTION).value_or("");
+	std::replace(not_digitized.begin(), not_digitized.end(), ',', ' ');
+	std::istringstream names(not_digitized);
+	std::string        name;
+	while (names >> name) {
+		for (auto& condition : conditions) {
+			if (condition.quantity == Quantity::hits && (name == "all" || name == condition.detector)) {
+				condition.counts_true_info = true;
+			}
+		}
+	}
+
+	if (enabled()) {
+		log->info(1, "Event skim enabled with ", conditions.size(), " condition(s)",
+		          keep_rejected_events ? ", rejected events are published without true information" : "");
+	}
+}
+
+// Each entry is detector:value. The detector name may itself not contain ':'.
+void GEventSkim::parse_conditions(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log,
+                                  const std::string& option, Quantity quantity) {
+	std::string entries = gopts->getOptionalScalarString(option).value_or("");
+	std::replace(entries.begin(), entries.end(), ',', ' ');
+
+	std::istringstream stream(entries);
+	std::string        entry;
+	while (stream >> entry) {
+		const auto separator = entry.rfind(':');
+		double     threshold = 0;
+		bool       valid     = separator != std::string::npos && separator > 0 && separator + 1 < entry.size();
+		if (valid) {
+			const char* first  = entry.data() + separator + 1;
+			const char* last   = entry.data() + entry.size();
+			const auto  result = std::from_chars(first, last, threshold);
+			valid              = result.ec == std::errc() && result.ptr == last && threshold >= 0;
+		}
+		if (!valid) {
+			log->error(gaction::ERR_SKIM_OPTION_INVALID, "invalid ", option, " entry <", entry,
+			           ">: expected detector:value with a non-negative value");
+		}
+		conditions.push_back({entry.substr(0, separator), quantity, threshold});
+	}
+}
+
+// See header for API docs.
+bool GEventSkim::accept(const GEventDataCollection& event_data) const {
+	const auto& collections = event_data.getDataCollectionMap();
+
+	for (const auto& condition : conditions) {
+		const auto it = collections.find(condition.detector);
+		if (it == collections.end() || it->second == nullptr) { return false; }
+
+		const auto& true_infos = it->second->getTrueInfoData();
+		double      value      = 0;
+		if (condition.quantity == Quantity::hits) {
+			value = static_cast<double>(condition.counts_true_info ? true_infos.size()
+			                                                       : it->second->getDigitizedData().size());
+		}
+		else {
+			for (const auto& true_info : true_infos) {
+				if (true_info != nullptr) { value += true_info->getDoubleVariable("totalEDeposited"); }
+			}
+		}
+		if (value < condition.threshold) { return false; }
+	}
+	return true;
+}
+
+// See header for API docs.
+bool GEventSkim::uses_detector(const std::string& detector) const {
+	return std::ranges::any_of(conditions, [&](const Condition& condition) { return condition.detector == detector; });
+}
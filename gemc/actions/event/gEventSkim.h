@@ -0,0 +1,131 @@
+#pragma once
+
+// gemc
+#include <gemc/goptions/goptions.h>
+#include <gemc/glogging/glogger.h>
+#include <gemc/gdata/event/gEventDataCollection.h>
+
+// c++
+#include <string>
+#include <vector>
+
+/**
+ * \file gEventSkim.h
+ * \brief Declares GEventSkim, the event-level selection evaluated before event output is published.
+ *
+ * @ingroup gactions_module
+ */
+
+constexpr const char* SKIM_MIN_HITS_OPTION      = "skim_min_hits";
+constexpr const char* SKIM_MIN_EDEP_OPTION      = "skim_min_edep";
+constexpr const char* SKIM_KEEP_REJECTED_SWITCH = "skim_keep_rejected";
+
+/**
+ * \brief Namespace containing the skim option definitions.
+ *
+ * @ingroup gactions_module
+ */
+namespace geventskim {
+	/**
+	 * \brief Returns the options controlling the event skim.
+	 *
+	 * \param logger Logger scope the options belong to.
+	 * \return A GOptions object holding the skim options.
+	 */
+	inline GOptions defineOptions(const std::string& logger) {
+		GOptions goptions(logger);
+
+		std::string help = "Publish only events with at least N hits in the listed detectors.\n \n";
+		help += guts::GTAB;
+		help += "The value is a comma- or whitespace-separated list of detector:N pairs. A detector hit\n";
+		help += guts::GTAB;
+		help += "count is the number of digitized hits, or of true-information hits when the detector is\n";
+		help += guts::GTAB;
+		help += "listed in no_digitized. All listed conditions, together with skim_min_edep, must pass.\n \n";
+		help += guts::GTAB;
+		help += "Example: -skim_min_hits=\"ecal:3, ftof:1\"\n";
+		goptions.defineOption(
+			GVariable(SKIM_MIN_HITS_OPTION, std::nullopt, "minimum hit multiplicity per detector"), help);
+
+		help = "Publish only events depositing at least E MeV in the listed detectors.\n \n";
+		help += guts::GTAB;
+		help += "The value is a comma- or whitespace-separated list of detector:E pairs. The deposited\n";
+		help += guts::GTAB;
+		help += "energy is the sum of the true-information totalEDeposited variable, so the detector must\n";
+		help += guts::GTAB;
+		help += "not be listed in no_true_info. All listed conditions, together with skim_min_hits, must pass.\n \n";
+		help += guts::GTAB;
+		help += "Example: -skim_min_edep=\"ecal:150\"\n";
+		goptions.defineOption(
+			GVariable(SKIM_MIN_EDEP_OPTION, std::nullopt, "minimum deposited energy (MeV) per detector"), help);
+
+		goptions.defineSwitch(SKIM_KEEP_REJECTED_SWITCH,
+		                      "publish skim-rejected events without their true information");
+
+		return goptions;
+	}
+} // namespace geventskim
+
+
+/**
+ * @class GEventSkim
+ * \brief Compiled event-selection predicates over a GEventDataCollection.
+ *
+ * The skim options are parsed once, at construction, into a flat list of
+ * (detector, quantity, threshold) conditions. accept() then only walks that list,
+ * so events rejected by the skim cost nothing beyond their digitization.
+ *
+ * @ingroup gactions_module
+ */
+class GEventSkim
+{
+public:
+	/**
+	 * \brief Parses the skim options.
+	 *
+	 * Malformed entries are fatal and reported through \p log.
+	 *
+	 * \param gopts Shared configuration holding the skim options.
+	 * \param log Logger used for diagnostics.
+	 */
+	GEventSkim(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log);
+
+	/// True when at least one condition is configured.
+	[[nodiscard]] bool enabled() const { return !conditions.empty(); }
+
+	/// True when rejected events are still published, without their true information.
+	[[nodiscard]] bool keep_rejected() const { return keep_rejected_events; }
+
+	/**
+	 * \brief Evaluates every condition on a completed event.
+	 *
+	 * \param event_data Event payload produced by the event action.
+	 * \return true when all conditions pass, or when no condition is configured.
+	 */
+	[[nodiscard]] bool accept(const GEventDataCollection& event_data) const;
+
+	/// True when a condition reads \p detector, whose true information is then needed even if no output publishes it.
+	[[nodiscard]] bool uses_detector(const std::string& detector) const;
+
+private:
+	/// Event quantity compared against a condition threshold.
+	enum class Quantity
+	{
+		hits,
+		edep
+	};
+
+	struct Condition
+	{
+		std::string detector;
+		Quantity    quantity;
+		double      threshold;
+		bool        counts_true_info = false; ///< hits condition on a detector listed in no_digitized
+	};
+
+	void parse_conditions(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log,
+	                      const std::string& option, Quantity quantity);
+
+	std::vector<Condition> conditions;
+	bool                   keep_rejected_events = false;
+};
@@ -0,0 +1,70 @@
+// gemc
+#include "gHelperPool.h"
+
+// c++
+#include <utility>
+
+// See header for API docs.
+
+GHelperPool::GHelperPool(std::size_t nhelpers, HelperInit helper_init) : init(std::move(helper_init)) {
+	helpers.reserve(nhelpers);
+	for (std::size_t h = 0; h < nhelpers; ++h) {
+		helpers.emplace_back([this, h] { helper_loop(h); });
+	}
+}
+
+GHelperPool::~GHelperPool() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		stopping = true;
+	}
+	batch_ready.notify_all();
+	// The helpers are joined by their jthread_alias destructors.
+}
+
+void GHelperPool::run(std::size_t batch_size, const std::function<void(std::size_t)>& batch_task) {
+	if (batch_size == 0 || helpers.empty()) { return; }
+
+	std::unique_lock<std::mutex> lock(mutex);
+	task    = &batch_task;
+	ntasks  = batch_size;
+	busy    = helpers.size();
+	failure = nullptr;
+	next_task.store(0);
+	++generation;
+	lock.unlock();
+	batch_ready.notify_all();
+
+	lock.lock();
+	batch_done.wait(lock, [this] { return busy == 0; });
+	task = nullptr;
+	if (failure) { std::rethrow_exception(std::exchange(failure, nullptr)); }
+}
+
+void GHelperPool::helper_loop(std::size_t index) {
+	if (init) { init(index); }
+
+	std::uint64_t seen = 0;
+	while (true) {
+		std::unique_lock<std::mutex> lock(mutex);
+		batch_ready.wait(lock, [&] { return stopping || generation != seen; });
+		if (stopping) { return; }
+		seen                   = generation;
+		const auto*       job  = task;
+		const std::size_t njob = ntasks;
+		lock.unlock();
+
+		for (std::size_t t = next_task++; t < njob; t = next_task++) {
+			try { (*job)(t); }
+			catch (...) {
+				// Keep the first failure and drain the counter so no further task starts.
+				std::lock_guard<std::mutex> failure_lock(mutex);
+				if (!failure) { failure = std::current_exception(); }
+				next_task.store(njob);
+			}
+		}
+
+		lock.lock();
+		if (--busy == 0) { batch_done.notify_one(); }
+	}
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+// gemc
+#include "gthreads.h"
+
+// c++
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * \file gHelperPool.h
+ * \brief Declares GHelperPool, the persistent helper threads of one worker thread.
+ *
+ * @ingroup gactions_module
+ */
+
+/**
+ * \class GHelperPool
+ * \brief Fixed set of helper threads that run batches of indexed tasks for their owning thread.
+ *
+ * The helpers are started once and reused for every batch, so per-thread state built on them
+ * (random engines, digitization contexts) survives from one event to the next. The owning thread
+ * submits a batch with run() and waits for it; helpers pull task indices from a shared counter, so
+ * uneven tasks balance themselves.
+ *
+ * An exception thrown by a task stops the batch: remaining tasks are not started, and the first
+ * exception is rethrown by run() on the owning thread once every helper is idle again.
+ */
+class GHelperPool
+{
+public:
+	/// Called once on each helper thread, with the helper index, before it runs any task.
+	using HelperInit = std::function<void(std::size_t)>;
+
+	/**
+	 * \brief Starts the helper threads.
+	 *
+	 * \param nhelpers Number of helper threads; must be positive.
+	 * \param init Optional per-helper initialization, run on the helper thread.
+	 */
+	explicit GHelperPool(std::size_t nhelpers, HelperInit init = {});
+
+	/// Stops and joins the helpers.
+	~GHelperPool();
+
+	GHelperPool(const GHelperPool&)            = delete;
+	GHelperPool& operator=(const GHelperPool&) = delete;
+
+	/**
+	 * \brief Runs task(0) ... task(ntasks - 1) on the helpers and waits for all of them.
+	 *
+	 * Must be called from the owning thread only.
+	 *
+	 * \param ntasks Number of tasks in the batch.
+	 * \param task Callable invoked with each task index.
+	 * \throws Whatever the first failing task threw.
+	 */
+	void run(std::size_t ntasks, const std::function<void(std::size_t)>& task);
+
+	/// Number of helper threads.
+	[[nodiscard]] std::size_t size() const { return helpers.size(); }
+
+private:
+	/// Body of helper \p index: waits for batches and runs their tasks until stopped.
+	void helper_loop(std::size_t index);
+
+	std::mutex              mutex;
+	std::condition_variable batch_ready;    ///< Signals a new batch or shutdown to the helpers.
+	std::condition_variable batch_done;     ///< Signals the owning thread that all helpers are idle.
+
+	const std::function<void(std::size_t)>* task       = nullptr; ///< Current batch, guarded by mutex.
+	std::size_t                              ntasks     = 0;
+	std::uint64_t                            generation = 0;       ///< Incremented for each batch.
+	std::size_t                              busy       = 0;       ///< Helpers still working on the batch.
+	bool                                     stopping   = false;
+	std::exception_ptr                       failure;              ///< First exception of the batch.
+	std::atomic<std::size_t>                 next_task{0};
+
+	HelperInit init;
+
+	/// Declared last so the threads are joined before the state they use is destroyed.
+	std::vector<jthread_alias> helpers;
+};
@@ -0,0 +1,91 @@
+#include "event/gEventAction.h"
+
+// C++
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \file event_skim_example.cc
+ * \brief Focused unit-test executable for the event skim predicates.
+ *
+ * The skim options are parsed from the command line given by the meson test:
+ *
+ * \code
+ * ./event_skim_example -skim_min_hits="ecal:2, ftof:2" -skim_min_edep="ecal:5" -no_digitized=ftof
+ * \endcode
+ *
+ * Synthetic events then exercise each condition. The ecal collections hold more true-information
+ * hits than digitized hits, as when threshold or efficiency rejected hits and also_reject_true_info is
+ * off: the ecal multiplicity must count the digitized hits only. ftof is listed in no_digitized, so
+ * its multiplicity counts true-information hits.
+ */
+
+namespace {
+
+// One detector's share of a synthetic event: digitized hits, then the edep of each true-information hit.
+void add_detector(GEventDataCollection& event, const std::shared_ptr<GOptions>& gopts, const std::string& detector,
+                  int digitized, const std::vector<double>& edeps) {
+	for (int i = 0; i < digitized; i++) { event.addDetectorDigitizedData(detector, GDigitizedData::create(gopts)); }
+	for (const double edep : edeps) {
+		auto true_info = std::make_unique<GTrueInfoData>(gopts, std::vector<GIdentifier>{{"sector", 1}});
+		true_info->includeVariable("totalEDeposited", edep);
+		event.addDetectorTrueInfoData(detector, std::move(true_info));
+	}
+}
+
+bool check(const GEventSkim& skim, const GEventDataCollection& event, bool expected, const std::string& what) {
+	if (skim.accept(event) == expected) { return true; }
+	std::cerr << "event_skim: " << what << (expected ? " should be accepted\n" : " should be rejected\n");
+	return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto options = geventaction::defineOptions();
+	options += gevent_data::defineOptions();
+	auto gopts = std::make_shared<GOptions>(argc, argv, options);
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, EVENTACTION_LOGGER);
+
+	const GEventSkim skim(gopts, log);
+	if (!skim.enabled() || skim.keep_rejected() || !skim.uses_detector("ecal") || !skim.uses_detector("ftof") ||
+	    skim.uses_detector("ctof")) {
+		std::cerr << "event_skim: options parsed into the wrong conditions\n";
+		return EXIT_FAILURE;
+	}
+
+	// One digitized ecal hit out of three true-information hits: the rejected hits do not count.
+	GEventDataCollection rejected_hits(gopts, GEventHeader::create(gopts));
+	add_detector(rejected_hits, gopts, "ecal", 1, {2, 2, 2});
+	add_detector(rejected_hits, gopts, "ftof", 0, {1, 1});
+
+	// Two digitized ecal hits pass, and ftof passes on its true-information count.
+	GEventDataCollection passing(gopts, GEventHeader::create(gopts));
+	add_detector(passing, gopts, "ecal", 2, {2, 2, 2});
+	add_detector(passing, gopts, "ftof", 0, {1, 1});
+
+	// Enough hits, but 4 MeV in ecal is below the 5 MeV threshold.
+	GEventDataCollection low_edep(gopts, GEventHeader::create(gopts));
+	add_detector(low_edep, gopts, "ecal", 2, {2, 2});
+	add_detector(low_edep, gopts, "ftof", 0, {1, 1});
+
+	// A single ftof true-information hit.
+	GEventDataCollection one_ftof(gopts, GEventHeader::create(gopts));
+	add_detector(one_ftof, gopts, "ecal", 3, {2, 2, 2});
+	add_detector(one_ftof, gopts, "ftof", 0, {1});
+
+	// No ftof collection at all.
+	GEventDataCollection no_ftof(gopts, GEventHeader::create(gopts));
+	add_detector(no_ftof, gopts, "ecal", 3, {2, 2, 2});
+
+	const bool passed = check(skim, rejected_hits, false, "an event with rejected ecal hits") &&
+		check(skim, passing, true, "an event passing every condition") &&
+		check(skim, low_edep, false, "an event below the ecal edep threshold") &&
+		check(skim, one_ftof, false, "an event with one ftof hit") &&
+		check(skim, no_ftof, false, "an event without ftof");
+
+	return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,100 @@
+#include "event/gHelperPool.h"
+
+// C++
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * \file helper_pool_example.cc
+ * \brief Focused unit-test executable for GHelperPool.
+ *
+ * Every task of a batch must run exactly once, on a helper thread, and run() must return only when
+ * all of them are done. The per-helper initialization runs once on each helper, however many
+ * batches follow. A throwing task stops its batch, run() rethrows it on the owning thread, and the
+ * pool stays usable for the next batch. An empty batch returns at once.
+ */
+
+namespace {
+
+bool check(bool condition, const std::string& what) {
+	if (!condition) { std::cerr << "helper_pool: " << what << "\n"; }
+	return condition;
+}
+
+} // namespace
+
+int main() {
+	constexpr std::size_t nhelpers = 4;
+
+	std::mutex                init_mutex;
+	std::set<std::size_t>     initialized;
+	std::set<std::thread::id> helper_threads;
+	std::atomic<int>          init_calls{0};
+	GHelperPool               pool(nhelpers, [&](std::size_t helper) {
+		std::lock_guard<std::mutex> lock(init_mutex);
+		initialized.insert(helper);
+		helper_threads.insert(std::this_thread::get_id());
+		init_calls++;
+	});
+	if (!check(pool.size() == nhelpers, "pool size")) { return EXIT_FAILURE; }
+
+	// Several batches of uneven sizes on the same helpers.
+	for (const std::size_t ntasks : {1UL, 3UL, 4UL, 17UL, 1000UL}) {
+		std::vector<std::atomic<int>> runs(ntasks);
+		std::atomic<bool>             on_owner{false};
+		const auto                    owner = std::this_thread::get_id();
+		pool.run(ntasks, [&](std::size_t task) {
+			if (std::this_thread::get_id() == owner) { on_owner = true; }
+			runs[task]++;
+		});
+
+		bool once = true;
+		for (const auto& count : runs) { once = once && count.load() == 1; }
+		if (!check(once, "every task of a batch of " + std::to_string(ntasks) + " runs exactly once") ||
+		    !check(!on_owner, "tasks run on the helpers, not on the owning thread")) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(init_mutex);
+		if (!check(init_calls == static_cast<int>(nhelpers) && initialized.size() == nhelpers &&
+		           helper_threads.size() == nhelpers, "the initialization runs once on each helper")) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	// A failing task stops the batch and is rethrown on the owning thread.
+	std::atomic<int> started{0};
+	bool             rethrown = false;
+	try {
+		pool.run(100000, [&](std::size_t task) {
+			started++;
+			if (task == 10) { throw std::runtime_error("task 10 failed"); }
+		});
+	}
+	catch (const std::runtime_error& e) { rethrown = std::string(e.what()) == "task 10 failed"; }
+	if (!check(rethrown, "the task exception is rethrown by run()") ||
+	    !check(started < 100000, "no task starts once the batch has failed")) {
+		return EXIT_FAILURE;
+	}
+
+	// The pool survives the failure, and an empty batch never calls the task.
+	std::atomic<int> after{0};
+	pool.run(8, [&](std::size_t) { after++; });
+	bool empty_called = false;
+	pool.run(0, [&](std::size_t) { empty_called = true; });
+	if (!check(after == 8, "the pool runs the batch after a failed one") ||
+	    !check(!empty_called, "an empty batch runs no task")) {
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
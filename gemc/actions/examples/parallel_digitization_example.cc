@@ -0,0 +1,167 @@
+#include "event/gEventAction.h"
+
+// gemc
+#include "gFluxDigitization.h"
+#include "gdynamicdigitization_options.h"
+
+// geant4
+#include "Randomize.hh"
+
+// C++
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \file parallel_digitization_example.cc
+ * \brief Focused unit-test executable comparing serial and parallel digitization output.
+ *
+ * A collection of test hits is digitized and its true information collected twice: in one batch,
+ * as the serial path of GEventAction does, and in chunks on a GHelperPool, as its parallel path
+ * does, each task seeding its helper engine with GEventAction::seedHelperEngine(). With the flux
+ * routine the two outputs must be identical, record by record. A routine drawing random numbers
+ * must give the same output for the same helper seed whatever the number of helpers, and a
+ * different one for another helper seed.
+ */
+
+namespace {
+
+constexpr std::size_t nhits = 23;
+constexpr std::size_t chunk = 4;
+
+/// Flux digitization with a random smearing, to check that chunk results do not depend on the helper.
+class SmearedFluxDigitization : public GFluxDigitization
+{
+public:
+	using GFluxDigitization::GFluxDigitization;
+
+	std::unique_ptr<GDigitizedData> digitizeHitImpl(GHit* ghit, size_t hitn) override {
+		auto gdata = GFluxDigitization::digitizeHitImpl(ghit, hitn);
+		gdata->includeVariable("smearedEdep", G4RandGauss::shoot(ghit->getTotalEnergyDeposited(), 1.0));
+		return gdata;
+	}
+};
+
+struct Output
+{
+	std::vector<std::unique_ptr<GDigitizedData>> digitized;
+	std::vector<std::unique_ptr<GTrueInfoData>>  trueInfo;
+};
+
+std::vector<size_t> output_hit_indices(std::size_t begin, std::size_t end) {
+	std::vector<size_t> hitns;
+	for (std::size_t i = begin; i < end; i++) { hitns.push_back(i + 1); }
+	return hitns;
+}
+
+Output digitize_serially(GDynamicDigitization& routine, const std::vector<GHit*>& hits) {
+	Output output{std::vector<std::unique_ptr<GDigitizedData>>(hits.size()),
+	              std::vector<std::unique_ptr<GTrueInfoData>>(hits.size())};
+	routine.digitizeHits(hits, 0, output.digitized);
+	routine.collectHitsTrueInformation(hits, output_hit_indices(0, hits.size()), output.trueInfo);
+	return output;
+}
+
+Output digitize_in_chunks(GDynamicDigitization& routine, const std::vector<GHit*>& hits, std::size_t nhelpers,
+                          long helper_seed) {
+	GHelperPool pool(nhelpers, [](std::size_t helper) {
+		GDynamicDigitization::bindThreadContextSlot(GDynamicDigitization::helperContextSlot(0, helper));
+	});
+
+	Output output{std::vector<std::unique_ptr<GDigitizedData>>(hits.size()),
+	              std::vector<std::unique_ptr<GTrueInfoData>>(hits.size())};
+	const std::size_t nchunks = (hits.size() + chunk - 1) / chunk;
+
+	pool.run(nchunks, [&](std::size_t task) {
+		const std::size_t                            begin = task * chunk;
+		const std::size_t                            end   = std::min(hits.size(), begin + chunk);
+		std::vector<GHit*>                           range(hits.begin() + begin, hits.begin() + end);
+		std::vector<std::unique_ptr<GDigitizedData>> digitized(range.size());
+		GEventAction::seedHelperEngine(helper_seed, 0, task);
+		routine.digitizeHits(range, begin, digitized);
+		for (std::size_t i = 0; i < range.size(); i++) { output.digitized[begin + i] = std::move(digitized[i]); }
+	});
+
+	pool.run(nchunks, [&](std::size_t task) {
+		const std::size_t                           begin = task * chunk;
+		const std::size_t                           end   = std::min(hits.size(), begin + chunk);
+		std::vector<GHit*>                          range(hits.begin() + begin, hits.begin() + end);
+		std::vector<std::unique_ptr<GTrueInfoData>> trueInfo(range.size());
+		GEventAction::seedHelperEngine(helper_seed, 1, task);
+		routine.collectHitsTrueInformation(range, output_hit_indices(begin, end), trueInfo);
+		for (std::size_t i = 0; i < range.size(); i++) { output.trueInfo[begin + i] = std::move(trueInfo[i]); }
+	});
+
+	return output;
+}
+
+bool same_true_info(const GTrueInfoData& a, const GTrueInfoData& b) {
+	if (a.getDoubleVariablesView() != b.getDoubleVariablesView() ||
+	    a.getStringVariablesView() != b.getStringVariablesView()) {
+		return false;
+	}
+	const auto& trackA = a.getTrackInfo();
+	const auto& trackB = b.getTrackInfo();
+	if (trackA == nullptr || trackB == nullptr) { return trackA == trackB; }
+	return same_true_info(*trackA, *trackB);
+}
+
+bool same_output(const Output& a, const Output& b, const std::string& what) {
+	for (std::size_t i = 0; i < nhits; i++) {
+		const auto& da = a.digitized[i];
+		const auto& db = b.digitized[i];
+		if (da == nullptr || db == nullptr || da->getIntObservablesView() != db->getIntObservablesView() ||
+		    da->getDblObservablesView() != db->getDblObservablesView()) {
+			std::cerr << "parallel_digitization: " << what << ": digitized hit " << i << " differs\n";
+			return false;
+		}
+		const auto& ta = a.trueInfo[i];
+		const auto& tb = b.trueInfo[i];
+		if (ta == nullptr || tb == nullptr || !same_true_info(*ta, *tb)) {
+			std::cerr << "parallel_digitization: " << what << ": true information of hit " << i << " differs\n";
+			return false;
+		}
+	}
+	return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gdynamicdigitization::defineOptions());
+
+	std::vector<std::unique_ptr<GHit>> owned;
+	std::vector<GHit*>                 hits;
+	for (std::size_t i = 0; i < nhits; i++) {
+		owned.emplace_back(GHit::create(gopts));
+		hits.push_back(owned.back().get());
+	}
+
+	GFluxDigitization flux(gopts);
+	flux.set_loggers(gopts);
+	SmearedFluxDigitization smeared(gopts);
+	smeared.set_loggers(gopts);
+	if (!flux.defineReadoutSpecs() || !smeared.defineReadoutSpecs()) { return EXIT_FAILURE; }
+
+	// Chunked on helpers, the deterministic routine gives the serial output.
+	const auto serial = digitize_serially(flux, hits);
+	if (!same_output(serial, digitize_in_chunks(flux, hits, 3, 12345), "flux serial and parallel")) {
+		return EXIT_FAILURE;
+	}
+
+	// Random numbers depend on the helper seed and the chunk only.
+	const auto two_helpers  = digitize_in_chunks(smeared, hits, 2, 12345);
+	const auto four_helpers = digitize_in_chunks(smeared, hits, 4, 12345);
+	if (!same_output(two_helpers, four_helpers, "smeared flux with 2 and 4 helpers")) { return EXIT_FAILURE; }
+
+	const auto other_seed = digitize_in_chunks(smeared, hits, 4, 54321);
+	if (other_seed.digitized[0]->getDblObservablesView() == four_helpers.digitized[0]->getDblObservablesView()) {
+		std::cerr << "parallel_digitization: another helper seed gives the same smearing\n";
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -18,8 +18,8 @@
  * `-- 3
  * \endcode
  *
- * It verifies original-track resolution, ancestor deduplication and ordering, event reset, and the
- * memory-saving original-only mode. Real Geant4 integration is exercised by the GEMC example tests.
+ * It verifies original-track resolution, ancestor deduplication and ordering, repeated ancestor
+ * requests, event reset, and the memory-saving original-only mode. Real Geant4 integration is exercised by the GEMC example tests.
  */
 
 namespace {
@@ -43,6 +43,12 @@ int main() {
 		return EXIT_FAILURE;
 	}
 
+	// Descendants read the original pid and momentum from the primary's single record.
+	if (provenance.originalTrackPid(4) != 11 || provenance.originalTrackMomentum(4) != G4ThreeVector(1, 2, 3)) {
+		std::cerr << "Incorrect original track pid or momentum\n";
+		return EXIT_FAILURE;
+	}
+
 	// Request overlapping paths, including a duplicate, and require every track exactly once.
 	const auto ancestors = provenance.ancestorsForTracks({4, 3, 4});
 	if (ancestors.size() != 4) {
@@ -57,6 +63,12 @@ int main() {
 		}
 	}
 
+	// Collection marks are reset after each call, so a second request sees the same chain.
+	if (provenance.ancestorsForTracks({3}).size() != 2) {
+		std::cerr << "Ancestor collection marks leaked across calls\n";
+		return EXIT_FAILURE;
+	}
+
 	// Clearing at the next event boundary must remove both mappings and full records.
 	provenance.clear();
 	if (provenance.originalTrackId(4) != 0 || !provenance.ancestorsForTracks({4}).empty()) {
@@ -30,6 +30,9 @@ namespace gaction {
 inline constexpr int ERR_GRUNACTION_NOT_EXISTING = 1201;
 inline constexpr int ERR_GDIGIMAP_NOT_EXISTING = 1202;
 inline constexpr int ERR_STREAMERMAP_NOT_EXISTING = 1203;
+inline constexpr int ERR_SKIM_OPTION_INVALID = 1204;
+inline constexpr int ERR_EVENT_SEEDING_INVALID = 1205;
+inline constexpr int ERR_FRAME_GRID_INVALID = 1206;
 ///@}
 
 /**
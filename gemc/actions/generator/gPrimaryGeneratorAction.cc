@@ -2,14 +2,22 @@
 #include "gparticle_options.h"
 #include "gparticle_reader.h"
 #include "gPrimaryGeneratorAction.h"
+#include "../gactionConventions.h"
+#include <gemc/eventDispenser/eventDispenser.h>
 
 // geant4
 #include "G4Event.hh"
+#include "Randomize.hh"
+
+// c++
+#include <cstdint>
 
 thread_local GParticleEvent GPrimaryGeneratorAction::current_generated_particles;
 thread_local GParticleEvent GPrimaryGeneratorAction::current_generated_tracked_particles;
 thread_local GParticleRecordEvent GPrimaryGeneratorAction::current_generated_particle_records;
 thread_local GParticleRecordEvent GPrimaryGeneratorAction::current_generated_tracked_particle_records;
+thread_local std::array<int, 2> GPrimaryGeneratorAction::current_event_seeds{};
+thread_local int GPrimaryGeneratorAction::current_replayed_event = -1;
 
 namespace {
 GParticleRecord make_particle_record(const GparticleRuntimeRecord& particle) {
@@ -34,6 +42,19 @@ void append_runtime_records(GParticleRecordEvent& records, const GparticlePtr& p
 	}
 }
 
+// SplitMix64 finalizer: a bijective mix, so distinct inputs cannot collide before truncation.
+std::uint64_t mix64(std::uint64_t x) {
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+// Fold a 64-bit hash into a seed in [1, 2^31 - 1], accepted by every CLHEP engine.
+int to_engine_seed(std::uint64_t x) {
+	return static_cast<int>(x % 0x7fffffffULL) + 1;
+}
+
 void append_untracked_file_records(GParticleRecordEvent& records, const GParticleRecordEvent& source_records) {
 	for (const auto& record : source_records) {
 		if (record.type != 1) {
@@ -52,6 +73,7 @@ GPrimaryGeneratorAction::GPrimaryGeneratorAction(std::shared_ptr<GOptions> gopts
 	    gparticle::getGParticlesFromOption(gopts, log))) {
 	gparticleFileEvents          = gparticle::getGParticleEventsFromSources(gopts, log);
 	allGparticleFileRecordEvents = gparticle::getGParticleRecordEventsFromSources(gopts, log);
+	configure_event_seeding(gopts);
 
 	if (gparticles->empty() && allGparticleFileRecordEvents.empty()) {
 		auto default_particle = Gparticle::create_default_gparticle(log);
@@ -67,6 +89,7 @@ GPrimaryGeneratorAction::GPrimaryGeneratorAction(std::shared_ptr<GOptions> gopts
 	gparticles(std::move(particles)) {
 	gparticleFileEvents          = gparticle::getGParticleEventsFromSources(gopts, log);
 	allGparticleFileRecordEvents = gparticle::getGParticleRecordEventsFromSources(gopts, log);
+	configure_event_seeding(gopts);
 
 	if (gparticles->empty() && allGparticleFileRecordEvents.empty()) {
 		auto default_particle = Gparticle::create_default_gparticle(log);
@@ -79,6 +102,9 @@ GPrimaryGeneratorAction::GPrimaryGeneratorAction(std::shared_ptr<GOptions> gopts
 // For each configured particle definition, configure the shared particle gun and
 // inject the corresponding primary information into the current event.
 void GPrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent) {
+	// Seeding must precede every random draw of the event, including particle generation.
+	seed_event_engine(anEvent);
+
 	current_generated_particles.clear();
 	current_generated_tracked_particles.clear();
 	current_generated_particle_records.clear();
@@ -89,7 +115,8 @@ void GPrimaryGeneratorAction::GeneratePrimaries(G4Event* anEvent) {
 	                                           gparticles->begin(),
 	                                           gparticles->end());
 
-	const auto event_id = anEvent->GetEventID();
+	// Re-simulated events take their file-backed particles from the original event.
+	const auto event_id = current_replayed_event >= 0 ? current_replayed_event : anEvent->GetEventID();
 	if (event_id >= 0 && static_cast<size_t>(event_id) < allGparticleFileRecordEvents.size()) {
 		const auto& event_particles = allGparticleFileRecordEvents[static_cast<size_t>(event_id)];
 		append_untracked_file_records(current_generated_particle_records, event_particles);
@@ -139,3 +166,60 @@ const GParticleRecordEvent& GPrimaryGeneratorAction::currentGeneratedParticleRec
 const GParticleRecordEvent& GPrimaryGeneratorAction::currentGeneratedTrackedParticleRecords() {
 	return current_generated_tracked_particle_records;
 }
+
+const std::array<int, 2>& GPrimaryGeneratorAction::currentEventSeeds() {
+	return current_event_seeds;
+}
+
+int GPrimaryGeneratorAction::currentReplayedEvent() {
+	return current_replayed_event;
+}
+
+std::array<int, 2> GPrimaryGeneratorAction::eventSeeds(long job_seed, int run, int event) {
+	const std::uint64_t key = mix64(mix64(static_cast<std::uint64_t>(job_seed)) ^ static_cast<std::uint32_t>(run)) ^
+		static_cast<std::uint32_t>(event);
+	const std::uint64_t hash = mix64(key);
+	return {to_engine_seed(hash), to_engine_seed(mix64(hash))};
+}
+
+void GPrimaryGeneratorAction::configure_event_seeding(const std::shared_ptr<GOptions>& gopts) {
+	simulate_events = eventDispenser::simulateEvents(gopts, log);
+
+	seed_per_event = !simulate_events.empty() ||
+		(gopts->doesOptionExist(SEED_PER_EVENT_SWITCH) && gopts->getSwitch(SEED_PER_EVENT_SWITCH));
+	if (!seed_per_event) { return; }
+
+	const auto configured_seed = gopts->doesOptionExist("seed") ? gopts->getOptionalScalarInt("seed") : std::nullopt;
+	if (!configured_seed) {
+		log->error(gaction::ERR_EVENT_SEEDING_INVALID, SEED_PER_EVENT_SWITCH, " and ", SIMULATE_EVENTS_OPTION,
+		           " need an explicit -seed so events can be reproduced");
+	}
+	job_seed = *configured_seed;
+	user_run = gopts->doesOptionExist("run") ? gopts->getOptionalScalarInt("run").value_or(0) : 0;
+	log->info(1, "Seeding every event from job seed ", job_seed, ", run and event number");
+}
+
+void GPrimaryGeneratorAction::seed_event_engine(const G4Event* event) {
+	current_event_seeds    = {};
+	current_replayed_event = -1;
+	if (!seed_per_event) { return; }
+
+	// In re-simulation mode, event i of the run stands in for the i-th listed event. Its Geant4
+	// event id stays sequential, as frame building and the streamers expect; the listed number
+	// drives the seeds and file-backed particles and is recorded in the event header.
+	const auto event_index = event->GetEventID();
+	int        event_number = event_index;
+	if (event_index >= 0 && static_cast<size_t>(event_index) < simulate_events.size()) {
+		event_number           = simulate_events[static_cast<size_t>(event_index)];
+		current_replayed_event = event_number;
+	}
+
+	// The gemc run number, not the Geant4 run id, which counts every /run/beamOn of the session.
+	const int run_id    = EventDispenser::dispensedRunNumber().value_or(user_run);
+	current_event_seeds = eventSeeds(job_seed, run_id, event_number);
+	long seeds[3]       = {current_event_seeds[0], current_event_seeds[1], 0};
+	G4Random::setTheSeeds(seeds);
+
+	log->info(2, "Event ", event_index, " of run ", run_id, " seeded as event ", event_number, " with ",
+	          current_event_seeds[0], " ", current_event_seeds[1]);
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 
@@ -8,6 +9,7 @@
 #include <gemc/gbase/gbase.h>
 #include <gemc/gparticle/gparticle_options.h>
 #include <gemc/gparticle/gparticle_reader.h>
+#include <gemc/eventDispenser/eventDispenser_options.h>
 
 // geant4
 #include "G4VUserPrimaryGeneratorAction.hh"
@@ -21,6 +23,7 @@
  */
 
 constexpr const char* GPRIMARYGENERATORACTION_LOGGER = "generator";
+constexpr const char* SEED_PER_EVENT_SWITCH          = "seed_per_event";
 
 /**
  * \brief Namespace containing helpers related to primary-generator configuration.
@@ -32,15 +35,43 @@ namespace gprimaryaction {
 /**
  * \brief Returns the options associated with the primary-generator action scope.
  *
- * In the current implementation this helper returns a logger-scoped GOptions object
- * without adding dedicated primary-generator switches directly in this file.
- * Generator behavior is instead mainly driven by the particle definitions loaded
- * through the generator support code.
+ * Particle definitions are loaded through the generator support code; this scope only
+ * adds the per-event seeding controls, applied before any primary is generated.
  *
  * \return A GOptions object scoped to the primary-generator logger name.
  */
 inline GOptions defineOptions() {
-	return GOptions(GPRIMARYGENERATORACTION_LOGGER);
+	GOptions goptions(GPRIMARYGENERATORACTION_LOGGER);
+
+	std::string help = "Seed the random engine of every event from (seed, run, event number).\n \n";
+	help += guts::GTAB;
+	help += "Each event then draws the same random sequence whichever worker thread processes it, so\n";
+	help += guts::GTAB;
+	help += "output is reproducible event by event for any nthreads, and jobs can be split across nodes.\n";
+	help += guts::GTAB;
+	help += "The two seeds are recorded in the event header. Requires -seed.\n \n";
+	help += guts::GTAB;
+	help += "Example: -seed=123 -seed_per_event\n";
+	goptions.defineSwitch(SEED_PER_EVENT_SWITCH, "seed each event from the job seed, run and event number");
+
+	help = "Re-simulate only the listed event numbers of a seed_per_event job.\n \n";
+	help += guts::GTAB;
+	help += "The value is a comma- or whitespace-separated list of event numbers. It implies\n";
+	help += guts::GTAB;
+	help += "seed_per_event and sets the number of events to the list size; each listed event is generated\n";
+	help += guts::GTAB;
+	help += "with the seeds and gparticlefile entry of its original event number, which the event header\n";
+	help += guts::GTAB;
+	help += "records as the replayed event. Entries must be distinct non-negative integers. Use the same\n";
+	help += guts::GTAB;
+	help += "-seed and -run as the original job. Cannot be combined with run_weights, whose split of the\n";
+	help += guts::GTAB;
+	help += "events among runs is random.\n \n";
+	help += guts::GTAB;
+	help += "Example: -seed=123 -simulate_events=\"17, 2048\"\n";
+	goptions.defineOption(GVariable(SIMULATE_EVENTS_OPTION, std::nullopt, "event numbers to re-simulate"), help);
+
+	return goptions;
 }
 
 } // namespace gprimaryaction
@@ -149,7 +180,58 @@ public:
 	 */
 	static const GParticleRecordEvent& currentGeneratedTrackedParticleRecords();
 
+	/**
+	 * \brief Returns the seeds the current event's engine was set to.
+	 *
+	 * \return Thread-local seeds for the active event, zeros unless \c seed_per_event is active.
+	 */
+	static const std::array<int, 2>& currentEventSeeds();
+
+	/**
+	 * \brief Returns the original event number the current event re-simulates.
+	 *
+	 * \return Thread-local listed event number, or -1 unless \c simulate_events is active.
+	 */
+	static int currentReplayedEvent();
+
+	/**
+	 * \brief Derives the two engine seeds of one event.
+	 *
+	 * The mapping is a fixed integer hash of its inputs, so the same (seed, run, event)
+	 * always gives the same seeds. Both seeds are in [1, 2^31 - 1].
+	 *
+	 * \param job_seed Seed of the job (the \c seed option).
+	 * \param run gemc run number (the \c -run option or \c run_weights entry), not the Geant4 run id.
+	 * \param event Event number.
+	 * \return The two seeds.
+	 */
+	static std::array<int, 2> eventSeeds(long job_seed, int run, int event);
+
 private:
+	/// Reads seed_per_event and simulate_events. Shared by both constructors.
+	void configure_event_seeding(const std::shared_ptr<GOptions>& gopts);
+
+	/// Re-seeds the engine for the event being generated and resolves the replayed event number.
+	void seed_event_engine(const G4Event* event);
+
+	/// True when every event is seeded from (job seed, run, event).
+	bool seed_per_event = false;
+
+	/// Job seed used by seed_per_event.
+	long job_seed = 0;
+
+	/// Run number (the \c -run option) used when no EventDispenser run is being dispatched.
+	int user_run = 0;
+
+	/// Event numbers to re-simulate: event i of the run is generated as event simulate_events[i].
+	std::vector<int> simulate_events;
+
+	/// \brief Thread-local seeds of the current event.
+	static thread_local std::array<int, 2> current_event_seeds;
+
+	/// \brief Thread-local original event number of the current event, -1 outside re-simulation.
+	static thread_local int current_replayed_event;
+
 	/**
 	 * \brief Particle-gun instance used to materialize configured primaries into the event.
 	 *
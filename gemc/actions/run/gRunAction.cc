@@ -3,12 +3,17 @@
 #include "gRun.h"
 #include "../gactionConventions.h"
 #include "gutsConventions.h"
+#include "gutilities.h"
 
 // geant4
 #include "G4Threading.hh"
 
+// c++
+#include <algorithm>
+
 std::mutex GRunAction::completed_run_data_mutex;
 GRunAction::CompletedRunData GRunAction::completed_worker_run_data;
+std::shared_ptr<GFrameBuilder> GRunAction::frame_builder;
 
 
 // Construct the run action and retain access to shared configuration and
@@ -49,6 +54,8 @@ void GRunAction::BeginOfRunAction(const G4Run *aRun) {
 	// Reset the per-run mode flags before scanning the digitization routines.
 	need_a_thread_streamer = false;
 	need_a_run_streamer = false;
+	need_a_frame_streamer = false;
+	event_frame_hits.clear();
 
 	// Inspect the available digitization routines to determine whether this run
 	// requires event-mode publication, run-mode publication, or both.
@@ -64,6 +71,8 @@ void GRunAction::BeginOfRunAction(const G4Run *aRun) {
 			} else if (digiRoutine->collection_mode() == CollectionMode::run) {
 				to_normalize[plugin] = digiRoutine->variables_to_normalize();
 				need_a_run_streamer = true;
+			} else if (digiRoutine->collection_mode() == CollectionMode::frame) {
+				need_a_frame_streamer = true;
 			}
 		}
 	} else {
@@ -109,9 +118,9 @@ void GRunAction::BeginOfRunAction(const G4Run *aRun) {
 			          " for run ", run, ". Number of events to be processed: ", neventsThisRun);
 		}
 	}
-	// The master thread owns run-mode publication, so it opens the run streamers
-	// only when at least one digitizer accumulates payload at run scope.
-	else if (IsMaster() && need_a_run_streamer) {
+	// The master thread owns run-mode and frame publication, so it opens its streamers
+	// only when at least one digitizer accumulates payload at run scope or in frames.
+	else if (IsMaster() && (need_a_run_streamer || need_a_frame_streamer)) {
 		if (gstreamer_run_map == nullptr) {
 			log->info(1, "Defining run gstreamers for run ", run);
 			gstreamer_run_map = gstreamer::gstreamersMapPtr(goptions);
@@ -137,6 +146,9 @@ void GRunAction::BeginOfRunAction(const G4Run *aRun) {
 			          guts::KGRN, name, guts::RST,
 			          " for run ", run, ". Number of events to be processed: ", neventsThisRun);
 		}
+
+		// Workers start the run after the master, so the builder is in place before any event ends.
+		if (need_a_frame_streamer) { create_frame_builder(); }
 	}
 }
 
@@ -184,34 +196,48 @@ void GRunAction::EndOfRunAction(const G4Run *aRun) {
 		return;
 	}
 
-	if (IsMaster() && need_a_run_streamer) {
-		// Gather all worker-produced run data for this run and merge them into a
-		// single master-side run-data object before publication.
-		auto completed_run_data = take_completed_worker_run_data();
-		log->info(2, FUNCTION_NAME,
-		          " master collected ", static_cast<int>(completed_run_data.size()),
-		          " worker run_data object(s) for run ", runNumber);
+	if (IsMaster() && (need_a_run_streamer || need_a_frame_streamer)) {
+		if (need_a_run_streamer) {
+			// Gather all worker-produced run data for this run and merge them into a
+			// single master-side run-data object before publication.
+			auto completed_run_data = take_completed_worker_run_data();
+			log->info(2, FUNCTION_NAME,
+			          " master collected ", static_cast<int>(completed_run_data.size()),
+			          " worker run_data object(s) for run ", runNumber);
 
-		std::shared_ptr<GRunDataCollection> merged_run_data;
+			std::shared_ptr<GRunDataCollection> merged_run_data;
 
-		for (auto &worker_run_data: completed_run_data) {
-			if (worker_run_data == nullptr) {
-				continue;
-			}
+			for (auto &worker_run_data: completed_run_data) {
+				if (worker_run_data == nullptr) {
+					continue;
+				}
+
+				// Create the merged destination lazily only if there is at least one
+				// valid worker contribution to merge.
+				if (merged_run_data == nullptr) {
+					auto merged_header = std::make_unique<GRunHeader>(goptions, runNumber, thread_id);
+					merged_run_data = std::make_shared<GRunDataCollection>(goptions, std::move(merged_header));
+				}
 
-			// Create the merged destination lazily only if there is at least one
-			// valid worker contribution to merge.
-			if (merged_run_data == nullptr) {
-				auto merged_header = std::make_unique<GRunHeader>(goptions, runNumber, thread_id);
-				merged_run_data = std::make_shared<GRunDataCollection>(goptions, std::move(merged_header));
+				merged_run_data->merge(*worker_run_data);
 			}
 
-			merged_run_data->merge(*worker_run_data);
+			// Publish the merged run-level payload once, after all workers have contributed.
+			if (merged_run_data != nullptr) {
+				publish_run_data(merged_run_data);
+			}
 		}
 
-		// Publish the merged run-level payload once, after all workers have contributed.
-		if (merged_run_data != nullptr) {
-			publish_run_data(merged_run_data);
+		// All workers have ended the run: the frames still held can no longer receive hits.
+		if (frame_builder != nullptr) {
+			frame_builder->flush();
+			log->info(1, FUNCTION_NAME, " run ", runNumber, ": ", frame_builder->getFramesEmitted(), " frames published");
+			frames_published += frame_builder->getFramesEmitted();
+			if (frame_builder->getLateHits() > 0) {
+				log->warning(FUNCTION_NAME, " run ", runNumber, ": ", frame_builder->getLateHits(),
+				             " frame-mode hits earlier than their event start fell in frames already published and were dropped");
+			}
+			frame_builder.reset();
 		}
 
 		if (gstreamer_run_map == nullptr) {
@@ -258,6 +284,77 @@ auto GRunAction::take_completed_worker_run_data() -> CompletedRunData {
 }
 
 
+// Build one frame hit from the streaming-readout observables of a frame-mode digitized hit.
+void GRunAction::collect_frame_hit(const GDigitizedData& digi_data) {
+	const auto& observables = digi_data.getIntObservablesView();
+	const auto  crate       = observables.find(CRATESTRINGID);
+	const auto  slot        = observables.find(SLOTSTRINGID);
+	const auto  channel     = observables.find(CHANNELSTRINGID);
+	const auto  charge      = observables.find(CHARGEATELECTRONICS);
+	const auto  time        = observables.find(TIMEATELECTRONICS);
+	if (crate == observables.end() || slot == observables.end() || channel == observables.end() ||
+	    charge == observables.end() || time == observables.end()) {
+		log->info(2, FUNCTION_NAME, " frame-mode hit without streaming-readout observables skipped");
+		return;
+	}
+
+	event_frame_hits.push_back({static_cast<double>(time->second), crate->second, slot->second, channel->second,
+	                            charge->second});
+}
+
+// Hand this event's frame hits to the shared builder, which may publish the frames it completes.
+void GRunAction::complete_frame_event(int event_id) {
+	if (frame_builder != nullptr) { frame_builder->addEvent(event_id, event_frame_hits); }
+	event_frame_hits.clear();
+}
+
+// Create the builder shared by all workers, on the readout grid of the frame-mode digitizers.
+//
+// The sink publishes through the master-owned streamers, but it is called by whichever worker
+// completes a frame. This is safe only because GFrameBuilder calls the sink with its lock held:
+// frames reach the streamers one at a time, and the master touches them again only in
+// EndOfRunAction, after every worker has ended the run.
+void GRunAction::create_frame_builder() {
+	std::shared_ptr<const GReadoutSpecs> specs;
+	for (const auto &[plugin, digiRoutine]: *digitization_routines_map) {
+		if (digiRoutine->collection_mode() != CollectionMode::frame) { continue; }
+
+		const auto& routine_specs = digiRoutine->readoutSpecs;
+		if (routine_specs == nullptr) {
+			log->error(gaction::ERR_FRAME_GRID_INVALID, FUNCTION_NAME, " frame-mode plugin ", plugin,
+			           " has no readout specs");
+		}
+		if (specs == nullptr) { specs = routine_specs; }
+		else if (specs->getTimeWindow() != routine_specs->getTimeWindow() ||
+		         specs->getGridStartTime() != routine_specs->getGridStartTime()) {
+			log->error(gaction::ERR_FRAME_GRID_INVALID, FUNCTION_NAME, " frame-mode plugin ", plugin,
+			           " uses timeWindow ", routine_specs->getTimeWindow(), " and gridStartTime ",
+			           routine_specs->getGridStartTime(), ", other frame-mode plugins use ", specs->getTimeWindow(),
+			           " and ", specs->getGridStartTime(), ": all frames must share one time grid");
+		}
+	}
+
+	std::vector<std::shared_ptr<GStreamer>> frame_streamers;
+	for (const auto &[name, gstreamer]: *gstreamer_run_map) {
+		if (gstreamer->getStreamType() == "stream") { frame_streamers.push_back(gstreamer); }
+	}
+	if (frame_streamers.empty()) {
+		log->warning(FUNCTION_NAME, " frame-mode digitizers are present but no gstreamer has type \"stream\":",
+		             " frames will not be written");
+		return;
+	}
+
+	const double event_time_size = gutilities::getG4Number(goptions->getRequiredScalarString(EVENT_TIME_SIZE_OPTION));
+	const int    frame_buffer    = goptions->getRequiredScalarInt(FRAME_BUFFER_OPTION);
+
+	frame_builder = std::make_shared<GFrameBuilder>(
+		specs->getTimeWindow(), specs->getGridStartTime(), event_time_size,
+		[frame_streamers](const GFrameDataCollection& frame) {
+			for (const auto& gstreamer : frame_streamers) { gstreamer->publishFrameRunData(&frame); }
+		},
+		log, static_cast<std::size_t>(std::max(0, frame_buffer)), frames_published);
+}
+
 // Publish the merged run-level payload to every configured master-side run streamer.
 void GRunAction::publish_run_data(const std::shared_ptr<GRunDataCollection> &run_data_collaction) const {
 	if (run_data_collaction == nullptr) {
@@ -339,108 +436,3 @@ void GRunAction::normalize_run_data(const std::shared_ptr<GRunDataCollection> &r
 	}
 }
 
-
-// (Legacy/experimental streaming logic remains commented out below.)
-
-// TODO: 2 more is too much we need some calculation here
-// int nFramesToCreate = neventsThisRun * eventDuration / frameDuration + 2;
-
-// if (stream) {
-// 	if (frameStreamVerbosity >= GVERBOSITY_SUMMARY) {
-// 		cout << SROLOGHEADER << " current nframes in the buffer: " << frameRunData.size() << ", new frames to create: " << nFramesToCreate;
-// 		cout << ", last frame id created: " << lastFrameCreated << endl;
-// 	}
-//
-// 	for (int f = lastFrameCreated; f < lastFrameCreated + nFramesToCreate; f++) {
-// 		GFrameDataCollectionHeader* gframeHeader = new GFrameDataCollectionHeader(f + 1, frameDuration, verbosity);
-// 		GFrameDataCollection*       frameData    = new GFrameDataCollection(gframeHeader, verbosity);
-// 		frameRunData.push_back(frameData);
-// 	}
-//
-// 	lastFrameCreated += nFramesToCreate;
-// 	if (frameStreamVerbosity >= GVERBOSITY_SUMMARY) {
-// 		cout << SROLOGHEADER << nFramesToCreate << " new frames, buffer size is now " << frameRunData.size();
-// 		cout << ", last frame id created: " << lastFrameCreated << endl;
-// 	}
-// }
-
-
-// looping over run data and filling frameRunData
-// need to remember last event number here
-// if (stream) {
-// 	for (auto eventDataCollection : theRun->getRunData()) {
-// 		int absoluteEventNumber = eventIndex + eventDataCollection->getEventNumber();
-//
-// 		// filling frameRunData with this eventDataCollection
-// 		for (auto [detectorName, gdataCollection] : *eventDataCollection->getDataCollectionMap()) {
-// 			for (auto hitDigitizedData : *gdataCollection->getDigitizedData()) {
-// 				int timeAtelectronic = hitDigitizedData->getTimeAtElectronics();
-// 					int frameIndex = eventFrameIndex(absoluteEventNumber, timeAtelectronic);
-// 					frameRunData[frameIndex]->addIntegralPayload(formPayload(hitDigitizedData), verbosity);
-// 				}
-// 			}
-// 		}
-// 	}
-// }
-
-
-// now flushing all frames past eventIndex
-
-// if (stream) {
-// 	// updating eventIndex
-// 	eventIndex += neventsThisRun;
-//
-// 	for (auto [factoryName, streamerFactory] : *gstreamerFactoryMap) {
-// 		if (streamerFactory->getStreamType() == "stream" && frameRunData.size() > 0) {
-// 			// need to look for additional frame to flush
-// 			int nFramesToFlush = nFramesToCreate - 2;
-//
-// 			if (frameStreamVerbosity >= GVERBOSITY_SUMMARY) { cout << SROLOGHEADER << "number of frames to flush: " << nFramesToFlush << endl; }
-// 			for (auto fid = 0; fid < nFramesToFlush; fid++) {
-// 				logSummary("Streaming frame id <" + to_string(frameRunData.front()->getFrameID()) + " using streamer factory >" + factoryName + "<");
-// 				streamerFactory->publishFrameRunData(goptions, frameRunData.front());
-// 				delete frameRunData.front();
-// 				frameRunData.erase(frameRunData.begin());
-// 			}
-// 		}
-// 	}
-// }
-
-
-// determine the frame ID based on event number, eventDuration, frameDuration and number of threads
-// add frameData to frameRunData if it's not present
-// int GRunAction::eventFrameIndex(int eventNumber, double timeAtElectronics) {
-// 	int absoluteHitTime = eventNumber * eventDuration + timeAtElectronics;
-// 	int frameID         = absoluteHitTime / frameDuration + 1;
-// 	int frameIndex      = -1;
-//
-// 	// cout << "eventNumber: " << eventNumber << ", absoluteHitTime: " << absoluteHitTime << ", frameID: " << frameID << endl;
-//
-// 	for (size_t f = 0; f < frameRunData.size(); f++) { if (frameRunData[f]->getFrameID() == frameID) { frameIndex = (int)f; } }
-// 	// cout << "eventNumber: " << eventNumber << ", absoluteHitTime: " << absoluteHitTime << ", frameIndex: " << frameIndex << endl;
-//
-// 	return frameIndex;
-// }
-
-// vector<int> GRunAction::formPayload(GDigitizedData* digitizedData) {
-// 	vector<int> payload;
-//
-// 	int crate   = digitizedData->getIntObservable(CRATESTRINGID);
-// 	int slot    = digitizedData->getIntObservable(SLOTSTRINGID);
-// 	int channel = digitizedData->getIntObservable(CHANNELSTRINGID);
-// 	int q       = digitizedData->getIntObservable(CHARGEATELECTRONICS);
-// 	int time    = digitizedData->getIntObservable(TIMEATELECTRONICS);
-//
-// 	payload.push_back(crate);
-// 	payload.push_back(slot);
-// 	payload.push_back(channel);
-// 	payload.push_back(q);
-// 	payload.push_back(time);
-//
-// 	return payload;
-// }
-//
-// bool GRunAction::findFrameID(int fid) {
-// 	for (auto frame : frameRunData) { if (frame->getFrameID() == fid) { return true; } }
-// 	return false;
-// }
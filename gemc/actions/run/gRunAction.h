@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -15,6 +16,7 @@
 #include <gemc/gdynamicDigitization/gdynamicdigitization.h>
 #include <gemc/gstreamer/gstreamer.h>
 #include <gemc/gdata/run/gRunDataCollection.h>
+#include <gemc/gdata/frame/gFrameBuilder.h>
 #include <gemc/actions/gactionConventions.h>
 
 
@@ -27,6 +29,15 @@
 
 constexpr const char* GRUNACTION_LOGGER = "grunaction";
 
+/**
+ * \brief Name of the option setting the time between the starts of consecutive events.
+ *
+ * Frame-mode digitizers place event \c n at \c n times this interval on the streaming-readout time axis.
+ */
+constexpr const char* EVENT_TIME_SIZE_OPTION = "event_time_size";
+constexpr const char* FRAME_BUFFER_OPTION    = "frame_buffer";
+constexpr int         DEFAULT_FRAME_BUFFER   = 4096;
+
 /**
  * \brief Namespace containing helpers related to run-action configuration.
  *
@@ -38,7 +49,35 @@ namespace grunaction {
 	 *
 	 * \return A GOptions object scoped to the run-action logger name.
 	 */
-	inline GOptions defineOptions() { return GOptions(GRUNACTION_LOGGER); }
+	inline GOptions defineOptions() {
+		GOptions goptions(GRUNACTION_LOGGER);
+
+		std::string help = "Time between the starts of two consecutive events in streaming-readout frames.\n \n";
+		help += guts::GTAB;
+		help += "Used by frame-mode digitizers: event n starts at n times this value, and each hit is placed\n";
+		help += guts::GTAB;
+		help += "in the frame containing the event start plus its time at electronics. Frames have the length\n";
+		help += guts::GTAB;
+		help += "and grid origin of the digitizer readout specs (timeWindow, gridStartTime).\n \n";
+		help += guts::GTAB;
+		help += "Example: -event_time_size=\"250*ns\"\n";
+		goptions.defineOption(
+			GVariable(EVENT_TIME_SIZE_OPTION, "250*ns", "time between consecutive events in frame mode"), help);
+
+		help = "Maximum number of streaming-readout frames held in memory.\n \n";
+		help += guts::GTAB;
+		help += "Frames are written once no event still in flight can contribute to them. When a slow event\n";
+		help += guts::GTAB;
+		help += "holds back more than this many frames, threads finishing later events wait for it.\n";
+		help += guts::GTAB;
+		help += "0 removes the limit. Default: 4096.\n \n";
+		help += guts::GTAB;
+		help += "Example: -frame_buffer=1000\n";
+		goptions.defineOption(
+			GVariable(FRAME_BUFFER_OPTION, DEFAULT_FRAME_BUFFER, "maximum number of frames held in memory"), help);
+
+		return goptions;
+	}
 } // namespace grunaction
 
 
@@ -56,13 +95,17 @@ namespace grunaction {
  * - determine whether event-mode and/or run-mode streamers are needed;
  * - open and close the appropriate streamer connections;
  * - accumulate run-mode data on worker threads;
- * - gather and publish merged run-mode data on the master thread.
+ * - gather and publish merged run-mode data on the master thread;
+ * - assemble frame-mode hits of all workers into time-ordered frames, published by the master streamers.
  *
  * Threading model:
  * - Worker threads can own thread streamer maps used for event publication.
  * - The master thread can own a run streamer map used for merged run publication.
  * - Worker-produced run data are moved into a protected static pool and consumed
  *   later by the master thread at run end.
+ * - The frame builder is created by the master before the workers start the run and flushed
+ *   after they end it. Workers add their events to it; completed frames are published from
+ *   whichever worker completes them, under the builder lock.
  *
  * @ingroup gactions_module
  */
@@ -123,6 +166,22 @@ public:
 		return gstreamer_threads_map != nullptr;
 	}
 
+	/**
+	 * \brief Returns whether a worker-thread streamer publishes the true information of a detector.
+	 *
+	 * Each streamer compiles its output selection at run start. When none selects the true
+	 * information of \p sdName, the event action does not collect it for publication.
+	 *
+	 * \param sdName Sensitive detector name.
+	 * \return true when at least one thread streamer selects the detector true information.
+	 */
+	[[nodiscard]] bool streams_true_info(const std::string& sdName) const {
+		if (gstreamer_threads_map == nullptr) { return false; }
+		return std::ranges::any_of(*gstreamer_threads_map, [&](const auto& entry) {
+			return entry.second->getSelection().selectsTrueInfo(sdName);
+		});
+	}
+
 	/** \brief Return whether this run action has a GUI Analyzer shard. */
 	[[nodiscard]] bool analysis_enabled() const { return analysis_shard != nullptr; }
 
@@ -204,6 +263,26 @@ public:
 		header->increment_events_with_payload();
 	}
 
+	/**
+	 * \brief Stages one frame-mode digitized hit of the current event.
+	 *
+	 * The hit must carry the streaming-readout observables (crate, slot, channel,
+	 * chargeAtElectronics, timeAtElectronics); hits without them are skipped.
+	 *
+	 * \param digi_data Digitized hit of a frame-mode digitizer.
+	 */
+	void collect_frame_hit(const GDigitizedData& digi_data);
+
+	/**
+	 * \brief Hands the staged frame-mode hits of one event to the shared frame builder.
+	 *
+	 * Must be called once for every event of the run, also when it produced no frame-mode hits,
+	 * because frames are only completed once all earlier events are in.
+	 *
+	 * \param event_id Geant4 event id, which fixes the event start time.
+	 */
+	void complete_frame_event(int event_id);
+
 private:
 	using CompletedRunData = std::vector<std::unique_ptr<GRunDataCollection>>;
 
@@ -272,6 +351,15 @@ private:
 	 */
 	void EndOfRunAction(const G4Run* run) override;
 
+	/**
+	 * \brief Creates the shared frame builder for the frame-mode digitizers of this run.
+	 *
+	 * All frame-mode digitizers must share the same readout time grid. Completed frames are
+	 * published to the master streamers of type \c "stream", and their IDs continue those of the
+	 * frames published in the previous runs.
+	 */
+	void create_frame_builder();
+
 	/**
 	 * \brief Publishes merged run data to all available master-side run streamers.
 	 *
@@ -311,7 +399,7 @@ private:
 	std::shared_ptr<const gstreamer::gstreamersMap> gstreamer_threads_map;
 
 	/**
-	 * \brief Master-thread run streamer map, created lazily when run-mode publication is needed.
+	 * \brief Master-thread streamer map, created lazily when run-mode or frame publication is needed.
 	 */
 	std::shared_ptr<const gstreamer::gstreamersMap> gstreamer_run_map;
 
@@ -333,6 +421,24 @@ private:
 	 */
 	bool need_a_run_streamer = false;
 
+	/**
+	 * \brief True when at least one digitization routine assembles its hits into frames.
+	 */
+	bool need_a_frame_streamer = false;
+
+	/// \brief Frame-mode hits of the event being processed by this thread.
+	std::vector<GFrameHit> event_frame_hits;
+
+	/**
+	 * \brief Builder shared by all workers of the current run, or null without frame-mode digitizers.
+	 *
+	 * Set by the master before the workers begin the run and reset after they end it.
+	 */
+	static std::shared_ptr<GFrameBuilder> frame_builder;
+
+	/// \brief Frames published by the master in the previous runs; the next run numbers its frames after them.
+	long frames_published = 0;
+
 	/**
 	 * \brief Mutex protecting access to the shared pool of completed worker run data.
 	 */
@@ -370,31 +476,3 @@ private:
 	std::unordered_map<std::string, std::vector<std::string>> to_normalize;
 };
 
-
-// vector of frame data in the run (local thread, merged in GRun::Merge in the global thread)
-//	std::vector<GFrameDataCollection*> frameRunData;
-
-//
-// int    eventIndex       = 0;                           // added to the absolute event number, increases with each run
-// int    lastFrameCreated = 0;                           // keeping track of the last frame created
-//
-// // determine the frame ID based on event number, eventDuration, frameDuration
-// // TODO: this should be in gdata?
-// int  eventFrameIndex(int eventNumber, double timeAtElectronics);
-// bool findFrameID(int fid);
-//
-// // decide whether to write or not to stream the frame based on event number, eventDuration, frameDuration and number of threads
-// // streaming the frame also deletes it from frameRunData
-// // TODO: this should be in gdata?
-// bool shouldWriteFrameID(int eventNumber, long int frameID);
-//
-// // TODO: this should be in gdata?
-// std::vector<int> formPayload(GDigitizedData* digitizedData);
-
-
-// in the constructur we had:
-
-// frameDuration = 64000;
-// eventDuration = gutilities::getG4Number(goptions->getRequiredScalarString("eventTimeSize"));
-
-// stream = gopt->getSwitch("stream");
@@ -1,14 +1,33 @@
 #include "gSteppingAction.h"
 #include "../gactionConventions.h"
+#include <gemc/gdynamicDigitization/gscoreAndKill.h>
+
+// c++
+#include <algorithm>
 
 // Geant4
 #include "G4OpticalPhoton.hh"
 #include "G4Step.hh"
+#include "G4SteppingManager.hh"
 #include "G4Track.hh"
 
 void GSteppingAction::UserSteppingAction(const G4Step* step) {
 	G4Track* track = step->GetTrack();
 
+	// A sensitive detector scored this track and stopped it (score-and-kill): drop the secondaries
+	// created in this step. Secondaries of earlier steps are kept, which fKillTrackAndSecondaries
+	// would discard too. Tracks stopped or killed by anything else are left alone.
+	if (GScoreAndKill::takeStoppedTrack(track)) {
+		G4TrackVector* secondaries = fpSteppingManager->GetfSecondary();
+		const auto     nThisStep   = std::min<std::size_t>(step->GetNumberOfSecondariesInCurrentStep(),
+		                                                    secondaries->size());
+		for (std::size_t i = secondaries->size() - nThisStep; i < secondaries->size(); i++) {
+			delete (*secondaries)[i];
+		}
+		secondaries->resize(secondaries->size() - nThisStep);
+		return;
+	}
+
 	// Optical photons rarely take more than ~20 steps in Cherenkov detectors; a photon
 	// exceeding this is trapped (e.g. total internal reflection in a volume with no
 	// absorption length) and would step forever.
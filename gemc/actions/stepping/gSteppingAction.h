@@ -11,6 +11,9 @@
  *   internal reflection in volumes with no absorption length would otherwise bounce forever
  * - any track is killed after \c gaction::MAX_TRACK_STEPS steps (e.g. stuck in a magnetic field loop)
  * - tracks touching the Kryptonite material are killed
+ *
+ * It also completes the score-and-kill requests of the sensitive detectors: a track they stopped and
+ * marked with GScoreAndKill::markStoppedTrack() loses the secondaries of the current step.
  */
 class GSteppingAction : public G4UserSteppingAction
 {
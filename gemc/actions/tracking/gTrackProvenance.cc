@@ -5,6 +5,7 @@
 #include "G4Track.hh"
 
 // C++
+#include <algorithm>
 #include <cstddef>
 
 GTrackProvenance::GTrackProvenance(bool save_ancestors) : save_ancestor_records(save_ancestors) {
@@ -13,8 +14,7 @@ GTrackProvenance::GTrackProvenance(bool save_ancestors) : save_ancestor_records(
 
 void GTrackProvenance::clear() {
 	original_track_ids.assign(1, 0);
-	original_track_pids.assign(1, 0);
-	original_track_momenta.assign(1, G4ThreeVector());
+	original_tracks.assign(1, OriginalTrack());
 	track_records.clear();
 	if (save_ancestor_records) { track_records.resize(1); }
 }
@@ -23,10 +23,6 @@ void GTrackProvenance::ensureCapacity(int track_id) {
 	if (track_id < 0) { return; }
 	const auto required_size = static_cast<std::size_t>(track_id) + 1;
 	if (original_track_ids.size() < required_size) { original_track_ids.resize(required_size, 0); }
-	if (original_track_pids.size() < required_size) { original_track_pids.resize(required_size, 0); }
-	if (original_track_momenta.size() < required_size) {
-		original_track_momenta.resize(required_size, G4ThreeVector());
-	}
 	if (save_ancestor_records && track_records.size() < required_size) {
 		track_records.resize(required_size);
 	}
@@ -43,20 +39,23 @@ void GTrackProvenance::record(int pid, int track_id, int parent_id, double kinet
 
 	ensureCapacity(track_id);
 
-	const int           original_id       = parent_id == 0 ? track_id : originalTrackId(parent_id);
-	const int           original_pid      = parent_id == 0 ? pid : originalTrackPid(parent_id);
-	const G4ThreeVector original_momentum = parent_id == 0 ? momentum : originalTrackMomentum(parent_id);
-	original_track_ids[track_id]     = original_id;
-	original_track_pids[track_id]    = original_pid;
-	original_track_momenta[track_id] = original_momentum;
+	// Only original tracks store their pid and momentum; descendants store the original ID.
+	if (parent_id == 0) {
+		original_track_ids[track_id] = track_id;
+		if (original_tracks.size() <= static_cast<std::size_t>(track_id)) {
+			original_tracks.resize(static_cast<std::size_t>(track_id) + 1);
+		}
+		original_tracks[track_id] = {pid, momentum};
+	}
+	else {
+		original_track_ids[track_id] = originalTrackId(parent_id);
+	}
 
 	if (!save_ancestor_records) { return; }
 
 	track_records[track_id] = {
 		pid,
-		track_id,
 		parent_id,
-		original_id,
 		kinetic_energy,
 		momentum,
 		vertex
@@ -69,37 +68,50 @@ int GTrackProvenance::originalTrackId(int track_id) const {
 }
 
 int GTrackProvenance::originalTrackPid(int track_id) const {
-	if (track_id <= 0 || static_cast<std::size_t>(track_id) >= original_track_pids.size()) { return 0; }
-	return original_track_pids[track_id];
+	const int original_id = originalTrackId(track_id);
+	if (original_id <= 0 || static_cast<std::size_t>(original_id) >= original_tracks.size()) { return 0; }
+	return original_tracks[original_id].pid;
 }
 
 G4ThreeVector GTrackProvenance::originalTrackMomentum(int track_id) const {
-	if (track_id <= 0 || static_cast<std::size_t>(track_id) >= original_track_momenta.size()) {
+	const int original_id = originalTrackId(track_id);
+	if (original_id <= 0 || static_cast<std::size_t>(original_id) >= original_tracks.size()) {
 		return G4ThreeVector();
 	}
-	return original_track_momenta[track_id];
+	return original_tracks[original_id].momentum;
 }
 
-std::vector<GTrackRecord> GTrackProvenance::ancestorsForTracks(
-	const std::unordered_set<int>& track_ids) const {
+std::vector<GTrackRecord> GTrackProvenance::ancestorsForTracks(const std::unordered_set<int>& track_ids) {
 	std::vector<GTrackRecord> ancestors;
 	if (!save_ancestor_records) { return ancestors; }
 
-	std::vector<bool> selected(track_records.size(), false);
-	std::size_t selected_count = 0;
+	if (selected.size() < track_records.size()) { selected.resize(track_records.size(), 0); }
+	selected_ids.clear();
 	for (int track_id : track_ids) {
 		while (track_id > 0 && static_cast<std::size_t>(track_id) < track_records.size() && !selected[track_id]) {
 			const auto& record = track_records[track_id];
-			if (record.tid == 0) { break; }
-			selected[track_id] = true;
-			++selected_count;
+			if (record.mtid < 0) { break; }
+			selected[track_id] = 1;
+			selected_ids.push_back(track_id);
 			track_id = record.mtid;
 		}
 	}
 
-	ancestors.reserve(selected_count);
-	for (std::size_t track_id = 1; track_id < track_records.size(); ++track_id) {
-		if (selected[track_id]) { ancestors.push_back(track_records[track_id]); }
+	// Sorting the collected IDs costs O(k log k) in the bank size instead of a scan of every track.
+	std::sort(selected_ids.begin(), selected_ids.end());
+	ancestors.reserve(selected_ids.size());
+	for (int track_id : selected_ids) {
+		const auto& record = track_records[track_id];
+		ancestors.push_back({
+			record.pid,
+			track_id,
+			record.mtid,
+			original_track_ids[track_id],
+			record.kinetic_energy,
+			record.momentum,
+			record.vertex
+		});
+		selected[track_id] = 0;
 	}
 	return ancestors;
 }
@@ -26,8 +26,10 @@ struct GTrackRecord
 /**
  * \brief Worker-local, event-scoped track ancestry registry.
  *
- * Track IDs are used as vector indices. Original-track-only mode retains one integer per track;
- * full records are retained only when ancestor output is requested.
+ * Track IDs are used as indices into flat per-event arrays whose capacity is reused across
+ * events. Original-track-only mode retains one integer per track, plus the pid and momentum of
+ * each original (primary) track; compact ancestor records are retained only when ancestor
+ * output is requested.
  */
 class GTrackProvenance
 {
@@ -42,15 +44,41 @@ public:
 	[[nodiscard]] int originalTrackId(int track_id) const;
 	[[nodiscard]] int originalTrackPid(int track_id) const;
 	[[nodiscard]] G4ThreeVector originalTrackMomentum(int track_id) const;
-	[[nodiscard]] std::vector<GTrackRecord> ancestorsForTracks(
-		const std::unordered_set<int>& track_ids) const;
+
+	/**
+	 * \brief Returns the records of the given tracks and all their ancestors, once each, sorted by track ID.
+	 *
+	 * Each chain is walked only up to the first track already collected for this call, so shared
+	 * ancestors are visited once however many hit tracks descend from them.
+	 */
+	[[nodiscard]] std::vector<GTrackRecord> ancestorsForTracks(const std::unordered_set<int>& track_ids);
 
 private:
+	/// Initial information of an original (primary) track, shared by all its descendants.
+	struct OriginalTrack
+	{
+		int           pid = 0;
+		G4ThreeVector momentum;
+	};
+
+	/// Ancestor record without the fields derivable from its index: tid is the index, otid is in original_track_ids.
+	struct AncestorRecord
+	{
+		int           pid  = 0;
+		int           mtid = -1; ///< -1 marks a track that was never recorded
+		double        kinetic_energy = 0;
+		G4ThreeVector momentum;
+		G4ThreeVector vertex;
+	};
+
 	void ensureCapacity(int track_id);
 
-	bool                       save_ancestor_records = false;
-	std::vector<int>           original_track_ids;
-	std::vector<int>           original_track_pids;
-	std::vector<G4ThreeVector> original_track_momenta;
-	std::vector<GTrackRecord>  track_records;
+	bool                        save_ancestor_records = false;
+	std::vector<int>            original_track_ids;
+	std::vector<OriginalTrack>  original_tracks;
+	std::vector<AncestorRecord> track_records;
+
+	/// Per-track "already collected" marks for ancestorsForTracks(), reset through selected_ids only.
+	std::vector<char> selected;
+	std::vector<int>  selected_ids;
 };
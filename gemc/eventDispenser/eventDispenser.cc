@@ -20,6 +20,8 @@
 
 using namespace std;
 
+std::atomic<int> EventDispenser::dispensed_run{-1};
+
 namespace {
 void closeOpenGeometryBeforeBeamOn(const std::shared_ptr<GLogger>& log) {
 	auto* geometryManager = G4GeometryManager::GetInstanceIfExist();
@@ -45,6 +47,17 @@ EventDispenser::EventDispenser(
 	userRunno        = gopt->getRequiredScalarInt("run");
 	neventsToProcess = gopt->getRequiredScalarInt("n");
 
+	// Re-simulation of a list of events (see the generator simulate_events option) replaces -n.
+	if (const auto events = eventDispenser::simulateEvents(gopt, log); !events.empty()) {
+		// The run_weights split is drawn at random, so the run of each listed event could not be reproduced.
+		if (filename) {
+			log->error(eventDispenser::ERR_SIMULATE_EVENTS_INVALID, SIMULATE_EVENTS_OPTION,
+			           " cannot be combined with run_weights: re-simulate each run with its own -run");
+		}
+		neventsToProcess = static_cast<int>(events.size());
+		log->info(1, "Re-simulating ", neventsToProcess, " listed events");
+	}
+
 	// Detect offscreen mode once at construction so processEvents() needs no vis headers.
 	// g4view is only defined when g4display options are included (e.g. in the full gemc app).
 	if (gopt->doesOptionExist("g4view")) {
@@ -196,6 +209,7 @@ int EventDispenser::processEvents() {
 
 		log->info(1, "Starting run ", runNumber, " with ", nevents, " events.");
 		if (analysisAccumulator != nullptr) { analysisAccumulator->setCurrentRunNumber(runNumber); }
+		dispensed_run.store(runNumber, std::memory_order_release);
 		// Tag the next G4Run with this run number. Guarded because standalone/unit-test
 		// contexts (e.g. the event_dispenser example) may run without a G4RunManager.
 		if (G4RunManager* g4rm = G4RunManager::GetRunManager()) { g4rm->SetRunIDCounter(runNumber); }
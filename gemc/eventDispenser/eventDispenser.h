@@ -4,6 +4,7 @@
 #include <gemc/ganalysis/gAnalysisAccumulator.h>
 #include <gemc/gdynamicDigitization/gdynamicdigitization.h>
 
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
@@ -134,6 +135,9 @@ private:
 	/** \brief GUI-only service that communicates the simulation run number to worker shards. */
 	std::shared_ptr<GAnalysisAccumulator> analysisAccumulator;
 
+	/// Run number of the run being dispatched, -1 before the first one. Read by worker threads.
+	static std::atomic<int> dispensed_run;
+
 public:
 	/**
 	 * \brief Returns the computed run-to-event allocation.
@@ -186,6 +190,21 @@ public:
 	 */
 	int processEvents();
 
+	/**
+	 * \brief Returns the run number of the events being processed.
+	 *
+	 * \details
+	 * Set by \ref processEvents() before each \c /run/beamOn, so worker threads can read the
+	 * run number of the event they process. Unlike the Geant4 run id, it is the \c -run option
+	 * or the \c run_weights entry, whatever the number of \c /run/beamOn commands issued before.
+	 *
+	 * \return The dispatched run number, empty before the first run is dispatched.
+	 */
+	[[nodiscard]] static std::optional<int> dispensedRunNumber() {
+		const int run = dispensed_run.load(std::memory_order_acquire);
+		return run >= 0 ? std::optional<int>(run) : std::nullopt;
+	}
+
 	/**
 	 * \brief Returns whether at least one \c /run/beamOn has been issued.
 	 *
@@ -16,4 +16,9 @@ namespace eventDispenser {
  */
 inline constexpr int ERR_EVENTDISTRIBUTIONFILENOTFOUND = 701;
 
+/**
+ * \brief Malformed, negative or duplicate entry in the \c simulate_events list.
+ */
+inline constexpr int ERR_SIMULATE_EVENTS_INVALID = 702;
+
 } // namespace eventDispenser
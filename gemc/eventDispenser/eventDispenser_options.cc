@@ -1,8 +1,15 @@
 // eventDispenser
 #include "eventDispenser_options.h"
+#include "eventDispenserConventions.h"
 
 // gemc
 #include "gdynamicdigitization_options.h"
+#include "gutilities.h"
+
+// c++
+#include <algorithm>
+#include <charconv>
+#include <unordered_set>
 
 /**
  * \file eventDispenser_options.cc
@@ -58,4 +65,27 @@ GOptions defineOptions() {
 
 	return goptions;
 }
+
+std::vector<int> simulateEvents(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log) {
+	std::vector<int> events;
+	if (!gopts->doesOptionExist(SIMULATE_EVENTS_OPTION)) { return events; }
+
+	std::string list = gopts->getOptionalScalarString(SIMULATE_EVENTS_OPTION).value_or("");
+	std::replace(list.begin(), list.end(), ',', ' ');
+
+	std::unordered_set<int> listed;
+	for (const auto& entry : gutilities::getStringVectorFromString(list)) {
+		int        event  = -1;
+		const auto result = std::from_chars(entry.data(), entry.data() + entry.size(), event);
+		if (result.ec != std::errc() || result.ptr != entry.data() + entry.size() || event < 0) {
+			log->error(ERR_SIMULATE_EVENTS_INVALID, "invalid ", SIMULATE_EVENTS_OPTION, " entry <", entry,
+			           ">: expected a non-negative event number");
+		}
+		if (!listed.insert(event).second) {
+			log->error(ERR_SIMULATE_EVENTS_INVALID, "event ", event, " is listed twice in ", SIMULATE_EVENTS_OPTION);
+		}
+		events.push_back(event);
+	}
+	return events;
+}
 } // namespace eventDispenser
@@ -2,6 +2,11 @@
 
 // glibrary
 #include <gemc/goptions/goptions.h>
+#include <gemc/glogging/glogger.h>
+
+// c++
+#include <memory>
+#include <vector>
 
 /**
  * \file eventDispenser_options.h
@@ -19,6 +24,13 @@
  */
 constexpr const char* EVENTDISPENSER_LOGGER = "eventdispenser";
 
+/**
+ * \brief Option listing the event numbers to re-simulate.
+ *
+ * Defined by the generator options; the dispenser reads it to set the number of events.
+ */
+constexpr const char* SIMULATE_EVENTS_OPTION = "simulate_events";
+
 /**
  * \namespace eventDispenser
  * \brief Namespace containing the Event Dispenser module option definitions.
@@ -39,4 +51,16 @@ namespace eventDispenser {
  * \return A \c GOptions instance containing all option definitions for this module.
  */
 GOptions defineOptions();
+
+/**
+ * \brief Parses the \c simulate_events list.
+ *
+ * The value is a comma- or whitespace-separated list of event numbers. Malformed, negative and
+ * duplicate entries are reported through \p log as \c ERR_SIMULATE_EVENTS_INVALID.
+ *
+ * \param gopts Options holding \c simulate_events, possibly undefined.
+ * \param log Logger used to report invalid entries.
+ * \return The listed event numbers in order, empty when the option is absent or empty.
+ */
+std::vector<int> simulateEvents(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log);
 } // namespace eventDispenser
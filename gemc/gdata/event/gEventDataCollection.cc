@@ -5,10 +5,14 @@
  * Non-Doxygen implementation summary:
  * - creates detector entries lazily on first insertion
  * - transfers ownership of truth and digitized hit objects into detector-local containers
+ * - keeps one track record per detector and track id, shared by the hits of that track in the detector
+ * - freezes the completed event into detector-grouped raw-pointer views shared by all streamers
+ * - builds the flat per-hit truth layout once per event, when a streamer first asks for it
  * - defines example/test counters for the event container and event header factories
  */
 
 #include "gEventDataCollection.h"
+#include <gemc/gdata/gdataMemory.h>
 
 // Counter reserved for tests and future example helpers.
 std::atomic<int> GEventDataCollection::globalEventDataCollectionCounter{1};
@@ -17,17 +21,24 @@ std::atomic<int> GEventDataCollection::globalEventDataCollectionCounter{1};
 std::atomic<int> GEventHeader::globalEventHeaderCounter{1};
 
 void GEventDataCollection::addDetectorTrueInfoData(const std::string& sdName, std::unique_ptr<GTrueInfoData> data) {
+	check_not_frozen("addDetectorTrueInfoData");
+
 	// Create the detector entry on first insertion.
 	if (gdataCollectionMap.find(sdName) == gdataCollectionMap.end()) {
 		gdataCollectionMap[sdName] = std::make_unique<GDataCollection>();
 	}
 
+	// Hits refer to their track record by its position in the event track table.
+	if (data->getTrackInfo()) { data->includeVariable(TRACKINDEXSTRINGID, internTrackInfo(sdName, *data)); }
+
 	// Event-level insertion transfers ownership of the hit-side object to the detector container.
 	gdataCollectionMap[sdName]->addTrueInfoData(std::move(data));
 	log->info(2, "GEventDataCollection: added new detector TrueInfoData for ", sdName);
 }
 
 void GEventDataCollection::addDetectorDigitizedData(const std::string& sdName, std::unique_ptr<GDigitizedData> data) {
+	check_not_frozen("addDetectorDigitizedData");
+
 	// Create the detector entry on first insertion.
 	if (gdataCollectionMap.find(sdName) == gdataCollectionMap.end()) {
 		gdataCollectionMap[sdName] = std::make_unique<GDataCollection>();
@@ -36,4 +47,105 @@ void GEventDataCollection::addDetectorDigitizedData(const std::string& sdName, s
 	// Event-level insertion transfers ownership of the hit-side object to the detector container.
 	gdataCollectionMap[sdName]->addDigitizedData(std::move(data));
 	log->info(2, "GEventDataCollection: added new detector DigitizedData for ", sdName);
-}
\ No newline at end of file
+}
+
+std::size_t GEventDataCollection::estimatedBytes() const {
+	if (frozen) { return frozenBytes; }
+
+	std::size_t bytes = sizeof(GEventDataCollection) + sizeof(GEventHeader);
+
+	for (const auto& [sdName, collection] : gdataCollectionMap) {
+		bytes += sizeof(decltype(gdataCollectionMap)::value_type) + gdata::MAP_NODE_OVERHEAD;
+		bytes += gdata::heapBytes(sdName) + collection->estimatedBytes();
+	}
+
+	// Each track record is counted once, however many hits share it.
+	bytes += trackTrueInfos.capacity() * sizeof(std::shared_ptr<const GTrueInfoData>);
+	for (const auto& [sdName, trackIndexById] : trackIndexByDetector) {
+		bytes += trackIndexById.size() * (sizeof(decltype(trackIndexById)::value_type) + 2 * sizeof(void*));
+	}
+	for (const auto& track : trackTrueInfos) { bytes += track->estimatedBytes(); }
+
+	// Particle names are the only heap-owning members of the banks.
+	for (const auto* bank : {&generated_particles, &generated_tracked_particles}) {
+		bytes += bank->capacity() * sizeof(GGeneratedParticleData);
+		for (const auto& particle : *bank) { bytes += gdata::heapBytes(particle.name); }
+	}
+	bytes += gdata::heapBytes(ancestor_particles);
+
+	return bytes;
+}
+
+void GEventDataCollection::freeze() {
+	if (frozen) { return; }
+
+	// The hit objects are owned through unique_ptr, so these addresses stay valid while the event lives.
+	detectorViews.reserve(gdataCollectionMap.size());
+	for (const auto& [sdName, collection] : gdataCollectionMap) {
+		auto& view  = detectorViews.emplace_back();
+		view.sdName = &sdName;
+
+		view.trueInfo.reserve(collection->getTrueInfoData().size());
+		for (const auto& hit : collection->getTrueInfoData()) { view.trueInfo.push_back(hit.get()); }
+
+		view.digitized.reserve(collection->getDigitizedData().size());
+		for (const auto& hit : collection->getDigitizedData()) { view.digitized.push_back(hit.get()); }
+	}
+
+	trackTrueInfoView.reserve(trackTrueInfos.size());
+	for (const auto& track : trackTrueInfos) { trackTrueInfoView.push_back(track.get()); }
+
+	frozenBytes = estimatedBytes() + trackTrueInfoView.capacity() * sizeof(void*);
+	for (const auto& view : detectorViews) {
+		frozenBytes += (view.trueInfo.capacity() + view.digitized.capacity()) * sizeof(void*);
+	}
+	frozen = true;
+	log->info(2, "GEventDataCollection: froze ", detectorViews.size(), " detectors, about ", frozenBytes, " bytes");
+}
+
+void GEventDataCollection::flattenTrueInfo() {
+	if (!frozen || trueInfoFlattened) { return; }
+	trueInfoFlattened = true;
+
+	for (auto& view : detectorViews) {
+		view.flatTrueInfo.reserve(view.trueInfo.size());
+		for (const auto* hit : view.trueInfo) {
+			if (!hit->getTrackInfo()) {
+				view.flatTrueInfo.push_back(hit);
+				continue;
+			}
+			flatTrueInfoCopies.push_back(hit->flattened());
+			view.flatTrueInfo.push_back(flatTrueInfoCopies.back().get());
+			frozenBytes += flatTrueInfoCopies.back()->estimatedBytes();
+		}
+		frozenBytes += view.flatTrueInfo.capacity() * sizeof(void*);
+	}
+	log->info(2, "GEventDataCollection: flattened ", flatTrueInfoCopies.size(), " truth hits");
+}
+
+int GEventDataCollection::internTrackInfo(const std::string& sdName, GTrueInfoData& hit) {
+	const auto& track = hit.getTrackInfo();
+
+	// Records are matched by detector and track id: a routine may override the track record, so
+	// another detector's record of the same track can differ. Records without a track id are kept
+	// as they are.
+	const auto tid            = static_cast<int>(track->getDoubleVariable("tid", -1));
+	auto&      trackIndexById = trackIndexByDetector[sdName];
+	if (tid >= 0) {
+		if (const auto it = trackIndexById.find(tid); it != trackIndexById.end()) {
+			hit.setTrackInfo(trackTrueInfos[it->second]);
+			return it->second;
+		}
+	}
+
+	const auto index = static_cast<int>(trackTrueInfos.size());
+	trackTrueInfos.push_back(track);
+	if (tid >= 0) { trackIndexById.emplace(tid, index); }
+	return index;
+}
+
+void GEventDataCollection::check_not_frozen(const char* operation) const {
+	if (frozen) {
+		log->error(ERR_EVENTFROZEN, "GEventDataCollection::", operation, " called after the event was frozen");
+	}
+}
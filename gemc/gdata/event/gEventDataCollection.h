@@ -38,6 +38,7 @@
 // C++
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 constexpr const char* GEVENTDATA_LOGGER = "gevent_data";
@@ -111,6 +112,28 @@ struct GAncestorData
 
 using GAncestorBank = std::vector<GAncestorData>;
 
+/**
+ * \brief Read-only, detector-grouped view of the hits of one detector in a frozen event.
+ *
+ * \details
+ * The pointers refer to hit objects owned by the event's GDataCollection entries and stay valid for
+ * the lifetime of the event. Streamers consume these vectors directly instead of rebuilding them.
+ */
+struct GDetectorView
+{
+	/// Sensitive detector name, owned by the event detector map.
+	const std::string* sdName = nullptr;
+
+	/// Truth hits of the detector, in insertion order.
+	std::vector<const GTrueInfoData*> trueInfo;
+
+	/// Digitized hits of the detector, in insertion order.
+	std::vector<const GDigitizedData*> digitized;
+
+	/// Truth hits in the flat per-hit layout, filled by GEventDataCollection::flattenTrueInfo().
+	std::vector<const GTrueInfoData*> flatTrueInfo;
+};
+
 namespace gevent_data {
 
 /**
@@ -163,6 +186,11 @@ inline auto defineOptions() -> GOptions {
  *
  * The class does not enforce structural invariants such as matching truth and digitized counts.
  * Applications that require such guarantees should validate them at a higher level.
+ *
+ * Once filled, the event is frozen with \ref GEventDataCollection::freeze "freeze()": the
+ * detector-grouped hit views and the memory estimate are built once, and every streamer publishing
+ * the event reads them instead of walking the detector map again. Hit data can no longer be added or
+ * removed afterwards.
  */
 class GEventDataCollection : public GBase<GEventDataCollection>
 {
@@ -187,6 +215,11 @@ public:
 	 * If the detector key does not exist yet, a new GDataCollection is created automatically.
 	 * Ownership of \p data is transferred to the target detector entry.
 	 *
+	 * A track record attached to \p data is entered in the event track table, once per detector and
+	 * track id: hits of a track already seen in the same detector are pointed at the existing record.
+	 * Records are not shared across detectors, whose digitization routines may build them differently.
+	 * The hit stores the record position as \c TRACKINDEXSTRINGID.
+	 *
 	 * \param sdName Sensitive detector name used as the map key.
 	 * \param data   Truth object to store.
 	 */
@@ -264,6 +297,32 @@ public:
 		return generated_tracked_particles;
 	}
 
+	/** \brief Drops the true information of every detector, keeping digitized data and particle banks. */
+	void clearTrueInfoData() {
+		check_not_frozen("clearTrueInfoData");
+		for (auto& [sdName, collection] : gdataCollectionMap) { collection->clearTrueInfoData(); }
+		trackTrueInfos.clear();
+		trackIndexByDetector.clear();
+	}
+
+	/**
+	 * \brief Returns the track records of the event, in first-seen order.
+	 *
+	 * \details
+	 * Each record holds the track-level truth shared by all the hits of one track. Hits refer to
+	 * their record by position through \c TRACKINDEXSTRINGID.
+	 *
+	 * \return Const reference to the event track table.
+	 */
+	[[nodiscard]] auto getTrackTrueInfos() const -> const std::vector<std::shared_ptr<const GTrueInfoData>>& {
+		return trackTrueInfos;
+	}
+
+	/// \brief Raw-pointer view of the track table built by \ref GEventDataCollection::freeze "freeze()".
+	[[nodiscard]] auto getTrackTrueInfoView() const -> const std::vector<const GTrueInfoData*>& {
+		return trackTrueInfoView;
+	}
+
 	/** \brief Stores the initial states of hit-producing tracks and their ancestors. */
 	void setAncestors(GAncestorBank ancestors) {
 		ancestor_particles = std::move(ancestors);
@@ -276,6 +335,38 @@ public:
 	/** \brief Reports whether ancestor output was requested for this event. */
 	[[nodiscard]] bool hasAncestorBank() const { return ancestor_bank_enabled; }
 
+	/**
+	 * \brief Builds the read-only detector views and the memory estimate of the completed event.
+	 *
+	 * \details
+	 * Called once, after the last hit has been added and before the event is handed to the
+	 * streamers. Calling it again has no effect. Adding or clearing hit data afterwards is reported
+	 * with \ref ERR_EVENTFROZEN.
+	 */
+	void freeze();
+
+	/**
+	 * \brief Fills the flat per-hit layout of the truth hits of every detector view.
+	 *
+	 * \details
+	 * Hits with a track record are copied once with GTrueInfoData::flattened(); hits without one are
+	 * already flat and are referenced as they are. The copies are owned by the event, so all the
+	 * streamers writing the flat layout share them. Calling it again, or before
+	 * \ref GEventDataCollection::freeze "freeze()", has no effect. The detector views are updated in
+	 * place, so references to them stay valid.
+	 */
+	void flattenTrueInfo();
+
+	/// \brief Whether \ref GEventDataCollection::freeze "freeze()" has been called.
+	[[nodiscard]] bool isFrozen() const { return frozen; }
+
+	/**
+	 * \brief Returns the detector-grouped hit views, in detector-name order.
+	 *
+	 * \return Views built by \ref GEventDataCollection::freeze "freeze()"; empty before it.
+	 */
+	[[nodiscard]] auto getDetectorViews() const -> const std::vector<GDetectorView>& { return detectorViews; }
+
 	/**
 	 * \brief Returns the event number stored in the owned header.
 	 *
@@ -286,6 +377,18 @@ public:
 	 */
 	[[nodiscard]] auto getEventNumber() const -> int { return gevent_header->getG4LocalEvn(); }
 
+	/**
+	 * \brief Estimated memory held by this event, in bytes.
+	 *
+	 * \details
+	 * Sums the detector collections, the track table and the generated-particle and ancestor banks. Streamers use
+	 * it to bound the memory of the events they buffer before writing them. Once the event is
+	 * frozen the value computed by \ref GEventDataCollection::freeze "freeze()" is returned.
+	 *
+	 * \return Approximate size in bytes.
+	 */
+	[[nodiscard]] std::size_t estimatedBytes() const;
+
 	/**
 	 * \brief Creates a minimal example event containing one detector entry and one hit pair.
 	 *
@@ -330,6 +433,26 @@ private:
 	GAncestorBank ancestor_particles;
 	bool          ancestor_bank_enabled = false;
 
+	/// Track records shared by the hits of the event, and their position by detector and track id.
+	std::vector<std::shared_ptr<const GTrueInfoData>>             trackTrueInfos;
+	std::unordered_map<std::string, std::unordered_map<int, int>> trackIndexByDetector;
+
+	/// Detector views, track view and memory estimate built by freeze().
+	std::vector<GDetectorView>        detectorViews;
+	std::vector<const GTrueInfoData*> trackTrueInfoView;
+	std::size_t                       frozenBytes = 0;
+	bool                              frozen      = false;
+
+	/// Flat copies of the truth hits that have a track record, built by flattenTrueInfo().
+	std::vector<std::unique_ptr<GTrueInfoData>> flatTrueInfoCopies;
+	bool                                        trueInfoFlattened = false;
+
+	/// Reports hit-data changes made after freeze().
+	void check_not_frozen(const char* operation) const;
+
+	/// Enters the track record of \p hit, a hit of detector \p sdName, in the track table; returns its position.
+	int internTrackInfo(const std::string& sdName, GTrueInfoData& hit);
+
 	/// Static thread-safe counter reserved for tests or future example helpers.
 	static std::atomic<int> globalEventDataCollectionCounter;
 };
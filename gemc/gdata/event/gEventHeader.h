@@ -4,6 +4,7 @@
 #include <gemc/gbase/gbase.h>
 
 // C++
+#include <array>
 #include <atomic>
 #include <string>
 
@@ -62,6 +63,8 @@ inline GOptions defineOptions() {
  * - the local event number
  * - the thread identifier used for diagnostics
  * - a construction-time timestamp string
+ * - the per-event random seeds, when the event engine was seeded per event
+ * - the number of the original event it re-simulates, in \c simulate_events jobs
  *
  * Ownership:
  * - this object is typically owned exclusively by GEventDataCollection
@@ -135,6 +138,44 @@ public:
 	 */
 	[[nodiscard]] inline int getThreadID() const { return threadID; }
 
+	/**
+	 * \brief Records the seeds the event random engine was set to before generation.
+	 *
+	 * \param seed1 First seed.
+	 * \param seed2 Second seed.
+	 */
+	inline void setRandomSeeds(int seed1, int seed2) { randomSeeds = {seed1, seed2}; }
+
+	/// True when per-event random seeds were recorded.
+	[[nodiscard]] inline bool hasRandomSeeds() const { return randomSeeds[0] != 0; }
+
+	/**
+	 * \brief Returns the per-event random seeds.
+	 *
+	 * \return The two recorded seeds, or zeros when the event was not seeded per event.
+	 */
+	[[nodiscard]] inline const std::array<int, 2>& getRandomSeeds() const { return randomSeeds; }
+
+	/**
+	 * \brief Records the number of the original event this event re-simulates.
+	 *
+	 * The local event number stays the sequential Geant4 event id; this is the listed event
+	 * number whose seeds and generator input were used.
+	 *
+	 * \param evn Original event number.
+	 */
+	inline void setReplayedEvent(int evn) { replayedEvent = evn; }
+
+	/// True when the event re-simulates an event of an earlier job.
+	[[nodiscard]] inline bool hasReplayedEvent() const { return replayedEvent >= 0; }
+
+	/**
+	 * \brief Returns the number of the original event this event re-simulates.
+	 *
+	 * \return The original event number, or -1 when the event is not a re-simulation.
+	 */
+	[[nodiscard]] inline int getReplayedEvent() const { return replayedEvent; }
+
 private:
 	/// Event number local to the current run or example sequence.
 	int g4localEventNumber;
@@ -164,6 +205,12 @@ private:
 	/// Timestamp string assigned at construction.
 	std::string timeStamp;
 
+	/// Per-event random seeds, zero when not seeded per event.
+	std::array<int, 2> randomSeeds{};
+
+	/// Original event number in re-simulation jobs, -1 otherwise.
+	int replayedEvent = -1;
+
 	/// Static thread-safe event counter used only by \ref GEventHeader::create "create()".
 	static std::atomic<int> globalEventHeaderCounter;
 };
\ No newline at end of file
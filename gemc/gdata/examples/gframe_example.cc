@@ -39,6 +39,15 @@
  *
  * This example constructs three such payloads and inserts them into the frame collection.
  *
+ * \section gdata_frame_builder Frames from events
+ * The second part simulates events on several threads and hands them, out of order, to a
+ * GFrameBuilder. The example checks that frames come out in order and without gaps, and that every
+ * hit lands in exactly one frame.
+ *
+ * A third part builds the frames of a later run while one event is never added and the frame buffer
+ * is bounded: the threads adding later events stop waiting for it after the maximum wait, the frames
+ * come out at the flush, and their IDs continue those of the previous run.
+ *
  * \section gdata_frame_usage Usage
  * Compile this file together with the frame classes and the logging/options utilities. Run it to:
  * - print the frame ID and computed frame time
@@ -52,22 +61,123 @@
  */
 
 // gdata
+#include "frame/gFrameBuilder.h"
 #include "frame/gFrameDataCollection.h"
 #include "frame/gFrameHeader.h"
 #include "gEventDataCollection.h"
 
 // gemc
 #include "glogger.h"
+#include "gthreads.h"
 #include <gtouchable_options.h>
 
 // c++
+#include <atomic>
+#include <chrono>
 #include <iostream>
 #include <string>
 #include <vector>
 
 using namespace std;
 
-// TODO: Run this in multiple threads and collect results into frames, similar to a runAction-style aggregator.
+/**
+ * \brief Simulates events on several threads and assembles them into frames.
+ *
+ * \details
+ * Each event holds a few hits spread over 600 time units, longer than the 250 units between
+ * events, so frames collect hits from several events and events spill into later frames. Threads
+ * pull event numbers from a shared counter and finish them in any order.
+ *
+ * \param nevents  Number of events.
+ * \param nthreads Number of worker threads.
+ * \param log      Logger used by the frames and for the report.
+ */
+static void build_frames_in_threads(int nevents, int nthreads, const std::shared_ptr<GLogger>& log) {
+	constexpr int    hitsPerEvent  = 4;
+	constexpr double eventDuration = 250;
+
+	long nframes = 0, npayloads = 0;
+	long previousID = 0;
+
+	// The sink runs under the builder lock, so it can update the counters without its own.
+	GFrameBuilder builder(
+		1000, 0, eventDuration,
+		[&](const GFrameDataCollection& frame) {
+			if (frame.getFrameID() != previousID + 1) {
+				log->error(ERR_WRONGPAYLOAD, "frame ", frame.getFrameID(), " emitted after frame ", previousID);
+			}
+			previousID = frame.getFrameID();
+			npayloads  += static_cast<long>(frame.getIntegralPayload().size());
+			++nframes;
+		},
+		log);
+
+	std::atomic<int> next{0};
+	{
+		std::vector<jthread_alias> pool;
+		pool.reserve(nthreads);
+		for (int tid = 0; tid < nthreads; ++tid) {
+			pool.emplace_back([&] {
+				for (int evn = next++; evn < nevents; evn = next++) {
+					std::vector<GFrameHit> hits;
+					for (int h = 0; h < hitsPerEvent; ++h) {
+						hits.push_back({static_cast<double>((evn * 37 + h * 151) % 600), 1, h, evn % 16, 100 + h});
+					}
+					builder.addEvent(evn, hits);
+				}
+			});
+		}
+	}
+	builder.flush();
+
+	cout << "Frames built from " << nevents << " events: " << nframes << ", payloads: " << npayloads
+		<< ", late hits: " << builder.getLateHits() << endl;
+
+	if (npayloads != static_cast<long>(nevents) * hitsPerEvent || builder.getLateHits() != 0) {
+		log->error(ERR_WRONGPAYLOAD, "expected ", nevents * hitsPerEvent, " payloads, got ", npayloads);
+	}
+}
+
+/**
+ * \brief Builds the frames of a later run in which one event never arrives.
+ *
+ * \details
+ * Event 0 is never added and at most two frames may be pending. Without the maximum wait the
+ * thread adding event 3 would wait forever. The flush then emits every frame, numbered after the
+ * \p previousFrames frames of the previous run.
+ *
+ * \param previousFrames Frames published in the previous run.
+ * \param log            Logger used by the frames and for the report.
+ */
+static void build_frames_with_missing_event(long previousFrames, const std::shared_ptr<GLogger>& log) {
+	constexpr int nevents = 8;
+
+	long previousID = previousFrames, npayloads = 0;
+	GFrameBuilder builder(
+		100, 0, 100,
+		[&](const GFrameDataCollection& frame) {
+			if (frame.getFrameID() != previousID + 1) {
+				log->error(ERR_WRONGPAYLOAD, "frame ", frame.getFrameID(), " emitted after frame ", previousID);
+			}
+			previousID = frame.getFrameID();
+			npayloads  += static_cast<long>(frame.getIntegralPayload().size());
+		},
+		log, 2, previousFrames, std::chrono::milliseconds(50));
+
+	for (int evn = 1; evn < nevents; ++evn) { builder.addEvent(evn, {{10, 1, 0, evn, 100}}); }
+	if (builder.getFramesEmitted() != 0 || builder.getPendingFrames() != nevents - 1) {
+		log->error(ERR_WRONGPAYLOAD, "frames were emitted before the missing event");
+	}
+	builder.flush();
+
+	cout << "Frames built without event 0: " << builder.getFramesEmitted() << ", IDs " << previousFrames + 1 << " to "
+		<< previousID << endl;
+
+	if (previousID != previousFrames + nevents || npayloads != nevents - 1) {
+		log->error(ERR_WRONGPAYLOAD, "expected frames ", previousFrames + 1, " to ", previousFrames + nevents, " with ",
+		           nevents - 1, " payloads, got up to ", previousID, " with ", npayloads);
+	}
+}
 
 /**
  * \brief Entry point for the frame example.
@@ -79,10 +189,9 @@ using namespace std;
  * - creates one frame header and one frame container
  * - inserts three example packed payload vectors
  * - prints the frame metadata and each stored payload
- * - deletes the frame container, which also deletes the owned header and payload objects
- *
- * This example intentionally uses the raw-pointer ownership pattern currently implemented by
- * GFrameDataCollection so the generated documentation matches the actual API contract.
+ * - builds frames from events simulated on several threads
+ * - builds the frames of a later run in which one event is missing
+ * - releases the frame container, which also releases the owned header and payload objects
  *
  * \param argc Argument count forwarded to GOptions.
  * \param argv Argument vector forwarded to GOptions.
@@ -100,8 +209,8 @@ int main(int argc, char* argv[]) {
 	double   frameDuration = 33.33; // Example frame duration, with units defined by the caller.
 
 	// Create the frame header and transfer ownership into the frame collection.
-	auto frameHeader = new GFrameHeader(frameID, frameDuration, log);
-	auto frameData   = new GFrameDataCollection(frameHeader, log);
+	auto frameHeader = std::make_unique<GFrameHeader>(frameID, frameDuration, log);
+	auto frameData   = std::make_unique<GFrameDataCollection>(std::move(frameHeader), log);
 
 	// Build three packed payload vectors matching the fixed crate/slot/channel/charge/time layout.
 	vector<int> payload1 = {1, 2, 3, 100, 50};
@@ -116,12 +225,12 @@ int main(int argc, char* argv[]) {
 	cout << "Frame ID: " << frameData->getFrameID() << endl;
 	cout << "Frame Header Time: " << frameData->getHeader()->getTime() << endl;
 
-	const vector<GIntegralPayload*>* payloads = frameData->getIntegralPayload();
-	cout << "Number of integral payloads: " << payloads->size() << endl;
+	const auto& payloads = frameData->getIntegralPayload();
+	cout << "Number of integral payloads: " << payloads.size() << endl;
 
 	// Print each stored payload in its fixed exported order.
-	for (size_t i = 0; i < payloads->size(); ++i) {
-		vector<int> p = (*payloads)[i]->getPayload();
+	for (size_t i = 0; i < payloads.size(); ++i) {
+		vector<int> p = payloads[i]->getPayload();
 		cout << "Payload " << (i + 1) << ": ";
 		for (auto v : p) {
 			cout << v << " ";
@@ -129,7 +238,8 @@ int main(int argc, char* argv[]) {
 		cout << endl;
 	}
 
-	delete frameData; // Deletes the header and all payloads owned by the collection.
+	build_frames_in_threads(400, 4, log);
+	build_frames_with_missing_event(1000, log);
 
 	return EXIT_SUCCESS;
 }
@@ -0,0 +1,88 @@
+/**
+ * \file track_records.cc
+ * \anchor track_records
+ * \brief Checks how GEventDataCollection shares track records and builds the flat truth layout.
+ *
+ * \details
+ * Summary:
+ * - two hits of the same track in one detector share one record of the event track table
+ * - a detector whose routine builds a different record for the same track keeps its own record
+ * - the flat truth layout is built once per event, holds the track variables of the right record,
+ *   and references hits without a track record as they are
+ */
+
+#include "event/gEventDataCollection.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::shared_ptr<const GTrueInfoData> trackRecord(const std::shared_ptr<GOptions>& gopts, int tid, int pid) {
+	auto track = std::make_shared<GTrueInfoData>(gopts, std::vector<GIdentifier>{});
+	track->includeVariable("tid", tid);
+	track->includeVariable("pid", pid);
+	return track;
+}
+
+std::unique_ptr<GTrueInfoData> hit(const std::shared_ptr<GOptions>& gopts, double edep,
+                                   std::shared_ptr<const GTrueInfoData> track) {
+	auto data = std::make_unique<GTrueInfoData>(gopts, std::vector<GIdentifier>{{"sector", 1}});
+	data->includeVariable("totalEDeposited", edep);
+	data->setTrackInfo(std::move(track));
+	return data;
+}
+
+bool check(bool condition, const std::string& what) {
+	if (!condition) { std::cerr << "track_records: " << what << "\n"; }
+	return condition;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gevent_data::defineOptions());
+	auto event = std::make_shared<GEventDataCollection>(gopts, GEventHeader::create(gopts));
+
+	// Track 7 in "ctof" twice, with separately built but equal records, then in "ecal" with a record
+	// of its own, as an overridden collectTrackTrueInformationImpl() would build it.
+	event->addDetectorTrueInfoData("ctof", hit(gopts, 1.0, trackRecord(gopts, 7, 11)));
+	event->addDetectorTrueInfoData("ctof", hit(gopts, 2.0, trackRecord(gopts, 7, 11)));
+	event->addDetectorTrueInfoData("ecal", hit(gopts, 3.0, trackRecord(gopts, 7, 22)));
+	event->addDetectorTrueInfoData("ecal", hit(gopts, 4.0, nullptr));
+	event->freeze();
+
+	const auto& views = event->getDetectorViews();
+	if (!check(views.size() == 2, "two detector views expected")) { return EXIT_FAILURE; }
+	const auto& ctof = views[0].trueInfo;
+	const auto& ecal = views[1].trueInfo;
+
+	const bool records =
+		check(event->getTrackTrueInfos().size() == 2, "one record per detector and track expected") &&
+		check(ctof[0]->getTrackInfo() == ctof[1]->getTrackInfo(), "hits of one track in one detector share a record") &&
+		check(ctof[1]->getDoubleVariable(TRACKINDEXSTRINGID, -1) == 0, "ctof hits point at record 0") &&
+		check(ecal[0]->getDoubleVariable(TRACKINDEXSTRINGID, -1) == 1, "the ecal hit points at record 1") &&
+		check(ecal[0]->getDoubleVariable("pid") == 22, "the ecal hit keeps the ecal record");
+	if (!records) { return EXIT_FAILURE; }
+
+	// Every streamer asking for the flat layout gets the same copies.
+	event->flattenTrueInfo();
+	const auto firstFlat = views[1].flatTrueInfo;
+	event->flattenTrueInfo();
+
+	const auto& flatCtof = views[0].flatTrueInfo;
+	const auto& flatEcal = views[1].flatTrueInfo;
+	const bool  flat =
+		check(flatCtof.size() == 2 && flatEcal.size() == 2, "one flat hit per truth hit expected") &&
+		check(flatEcal == firstFlat, "the flat layout is built once per event") &&
+		check(flatCtof[0]->getTrackInfo() == nullptr, "flat hits hold no track record") &&
+		check(flatCtof[0]->getDoubleVariablesView().count("pid") == 1, "flat hits hold the track variables") &&
+		check(flatCtof[0]->getDoubleVariablesView().count(TRACKINDEXSTRINGID) == 0, "flat hits drop the track index") &&
+		check(flatEcal[0]->getDoubleVariable("pid") == 22, "the flat ecal hit holds the ecal record") &&
+		check(flatEcal[1] == ecal[1], "hits without a track record are not copied");
+
+	return flat ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,133 @@
+/**
+ * \file gFrameBuilder.cc
+ * \brief Implements GFrameBuilder.
+ *
+ * Non-Doxygen implementation summary:
+ * - places each hit of an added event in its frame, creating the frame on first use
+ * - tracks the lowest event number not added yet, with the events added ahead of it in a set
+ * - emits, in order, every frame ending before the start time of that event
+ * - optionally holds back threads adding later events while too many frames are pending, for at most
+ *   maxWait per missing event
+ */
+
+#include "gFrameBuilder.h"
+
+// c++
+#include <algorithm>
+#include <cmath>
+
+GFrameBuilder::GFrameBuilder(double frameDuration_, double gridStartTime_, double eventDuration_, FrameSink sink_,
+                             std::shared_ptr<GLogger> logger, std::size_t maxPendingFrames_, long frameIDOffset_,
+                             std::chrono::milliseconds maxWait_)
+	: frameDuration(frameDuration_), gridStartTime(gridStartTime_), eventDuration(eventDuration_),
+	  sink(std::move(sink_)), log(std::move(logger)), maxPendingFrames(maxPendingFrames_),
+	  frameIDOffset(frameIDOffset_), maxWait(maxWait_) {
+	if (frameDuration <= 0 || eventDuration <= 0) {
+		log->error(ERR_WRONGFRAMEGRID, "frame duration ", frameDuration, " and event duration ", eventDuration,
+		           " must both be positive");
+	}
+	log->info(1, "GFrameBuilder: frameDuration=", frameDuration, ", gridStartTime=", gridStartTime,
+	          ", eventDuration=", eventDuration, ", first frame ID=", frameIDOffset + 1);
+}
+
+long GFrameBuilder::frameID(double absoluteTime) const {
+	return static_cast<long>(std::floor((absoluteTime - gridStartTime) / frameDuration)) + 1;
+}
+
+void GFrameBuilder::addEvent(long eventNumber, const std::vector<GFrameHit>& hits) {
+	const double eventStart = static_cast<double>(eventNumber) * eventDuration;
+
+	std::unique_lock lock(mutex);
+
+	// Only the event closing the gap may grow the pending frames past the limit, unless that event
+	// did not arrive within maxWait: then nobody is held back until it does.
+	if (maxPendingFrames > 0) {
+		const auto may_add = [&] {
+			return eventNumber <= nextEvent || pendingFrames.size() < maxPendingFrames || stalledEvent == nextEvent;
+		};
+		if (!eventsAdvanced.wait_for(lock, maxWait, may_add)) {
+			stalledEvent = nextEvent;
+			log->warning("GFrameBuilder: event ", nextEvent, " was not added within ", maxWait.count(),
+			             " ms, frames are held past the frame buffer limit until it is");
+			eventsAdvanced.notify_all();
+		}
+	}
+
+	for (const auto& hit : hits) {
+		const double absoluteTime = eventStart + hit.time;
+		const long   fid          = frameID(absoluteTime);
+		if (fid <= lastEmitted) {
+			++lateHits;
+			continue;
+		}
+
+		auto& frame = pendingFrames[fid];
+		if (frame == nullptr) {
+			frame = std::make_unique<GFrameDataCollection>(
+				std::make_unique<GFrameHeader>(fid + frameIDOffset, frameDuration, log), log);
+		}
+		const double frameStart = gridStartTime + static_cast<double>(fid - 1) * frameDuration;
+		frame->addIntegralPayload(hit.crate, hit.slot, hit.channel, hit.charge,
+		                          static_cast<int>(absoluteTime - frameStart));
+	}
+
+	// Close the gap below the lowest missing event, if this event filled it.
+	if (eventNumber == nextEvent) {
+		++nextEvent;
+		for (auto ahead = eventsAhead.begin(); ahead != eventsAhead.end() && *ahead == nextEvent;) {
+			ahead = eventsAhead.erase(ahead);
+			++nextEvent;
+		}
+		eventsAdvanced.notify_all();
+	}
+	else if (eventNumber > nextEvent) { eventsAhead.insert(eventNumber); }
+	else { log->warning("GFrameBuilder: event ", eventNumber, " was already added"); }
+
+	// Events not added yet start at nextEvent * eventDuration or later: the frames before it are complete.
+	emitUpTo(frameID(static_cast<double>(nextEvent) * eventDuration) - 1);
+}
+
+void GFrameBuilder::flush() {
+	std::scoped_lock lock(mutex);
+
+	long lastFrame = frameID(static_cast<double>(nextEvent) * eventDuration) - 1;
+	if (!pendingFrames.empty()) { lastFrame = std::max(lastFrame, pendingFrames.rbegin()->first); }
+	emitUpTo(lastFrame);
+
+	if (!eventsAhead.empty()) {
+		log->warning("GFrameBuilder: event ", nextEvent, " was never added, ", eventsAhead.size(),
+		             " later events were added after it");
+	}
+}
+
+void GFrameBuilder::emitUpTo(long lastFrame) {
+	for (long fid = lastEmitted + 1; fid <= lastFrame; ++fid) {
+		auto pending = pendingFrames.find(fid);
+		if (pending != pendingFrames.end()) {
+			sink(*pending->second);
+			pendingFrames.erase(pending);
+		}
+		else {
+			const GFrameDataCollection empty(std::make_unique<GFrameHeader>(fid + frameIDOffset, frameDuration, log),
+			                                 log);
+			sink(empty);
+		}
+		lastEmitted = fid;
+		++framesEmitted;
+	}
+}
+
+long GFrameBuilder::getFramesEmitted() const {
+	std::scoped_lock lock(mutex);
+	return framesEmitted;
+}
+
+long GFrameBuilder::getLateHits() const {
+	std::scoped_lock lock(mutex);
+	return lateHits;
+}
+
+std::size_t GFrameBuilder::getPendingFrames() const {
+	std::scoped_lock lock(mutex);
+	return pendingFrames.size();
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+/**
+ * \file gFrameBuilder.h
+ * \brief Defines GFrameBuilder, which assembles time-ordered frames from independently simulated events.
+ *
+ * \details
+ * Events are simulated independently, possibly on many threads and out of order. For streaming
+ * readout they are placed on a common time axis: event \c n starts at \c n * eventDuration, and a
+ * hit at time \c t within its event has the absolute time
+ * \code
+ * n * eventDuration + t
+ * \endcode
+ * The absolute time axis is cut in fixed-length frames aligned on a grid:
+ * \code
+ * frameID = floor((absoluteTime - gridStartTime) / frameDuration) + 1
+ * \endcode
+ * which is the same 1-based convention used by GReadoutSpecs::timeCellIndex().
+ *
+ * A frame is complete once every event that could still add hits to it has been added. Hits are
+ * not earlier than the start of their event, so once all events below \c n are in, every frame
+ * ending before \c n * eventDuration is complete and is emitted, in frame order.
+ */
+
+#include "gFrameDataCollection.h"
+
+// c++
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <vector>
+
+/**
+ * \brief One readout hit of an event, placed on the event time axis.
+ * \ingroup gdata_frame_collection
+ */
+struct GFrameHit
+{
+	double time;    ///< Hit time relative to the start of its event, in the units of the frame grid.
+	int    crate;   ///< Crate number.
+	int    slot;    ///< Slot number inside the crate.
+	int    channel; ///< Channel number inside the slot.
+	int    charge;  ///< Integrated charge or ADC proxy.
+};
+
+/**
+ * \brief Thread-safe assembler of time-ordered frames.
+ * \ingroup gdata_frame_collection
+ *
+ * \details
+ * Worker threads hand each completed event to \ref GFrameBuilder::addEvent "addEvent()". The
+ * builder keeps only frames that may still receive hits and passes every completed frame to the
+ * sink, in increasing frame ID and without gaps: frames without hits are emitted empty, so the
+ * output stream covers the simulated time continuously.
+ *
+ * Memory is bounded by the events in flight: pending frames span the time from the oldest event
+ * not yet added to the latest hit of the events already added. Events are handed out to worker
+ * threads in order, so this window is usually a few events per thread. A thread that is descheduled
+ * while holding the oldest event can still let the others run far ahead; with \c maxPendingFrames
+ * set, threads adding later events then wait until that event is in and frames can be emitted. The
+ * thread holding the oldest event never waits, so the wait ends as long as every event is added.
+ * An event that is never added, for example because its thread failed, would block every later
+ * event: once threads have waited \c maxWait for it, the builder stops holding them back until that
+ * event is in, and its frames are emitted by \ref GFrameBuilder::flush "flush()" at the end of the run.
+ *
+ * A hit that falls in an already emitted frame, or before the first frame of the grid, can only
+ * come from a hit earlier than the start of its event. Such hits are dropped and counted in
+ * \ref GFrameBuilder::getLateHits "getLateHits()".
+ *
+ * The payload time of each hit is its time from the start of its frame, truncated to an integer.
+ *
+ * Event numbers, and so the frame grid, start from 0 in every run. The frame IDs written in the
+ * headers are the grid IDs shifted by \c frameIDOffset, so that a builder created for a later run can
+ * continue the numbering of the frames already published.
+ *
+ * The sink is called with the builder lock held: frames reach it one at a time and in order,
+ * whichever thread completed them.
+ */
+class GFrameBuilder
+{
+public:
+	/// \brief Receives each completed frame. The frame is released when the call returns.
+	using FrameSink = std::function<void(const GFrameDataCollection&)>;
+
+	/**
+	 * \brief Construct a frame builder.
+	 *
+	 * \details
+	 * Non-positive \p frameDuration or \p eventDuration are reported with \ref ERR_WRONGFRAMEGRID.
+	 *
+	 * \param frameDuration Length of one frame.
+	 * \param gridStartTime Start of frame 1 on the absolute time axis.
+	 * \param eventDuration Time between the starts of two consecutive events.
+	 * \param sink          Callback receiving each completed frame.
+	 * \param logger        Logger shared with the frames built here.
+	 * \param maxPendingFrames Pending frames above which threads adding later events wait; 0 never waits.
+	 * \param frameIDOffset Added to the grid ID of each frame to give its header ID.
+	 * \param maxWait Longest wait for a missing event before threads stop being held back for it.
+	 */
+	GFrameBuilder(double frameDuration, double gridStartTime, double eventDuration, FrameSink sink,
+	              std::shared_ptr<GLogger> logger, std::size_t maxPendingFrames = 0, long frameIDOffset = 0,
+	              std::chrono::milliseconds maxWait = std::chrono::seconds(60));
+
+	GFrameBuilder(const GFrameBuilder&)            = delete;
+	GFrameBuilder& operator=(const GFrameBuilder&) = delete;
+
+	/**
+	 * \brief Add the hits of one completed event and emit the frames it completes.
+	 *
+	 * \details
+	 * Every event number, starting from 0, must be added exactly once, also for events without hits:
+	 * frames are only emitted once all earlier events are in.
+	 *
+	 * \param eventNumber Event number, which fixes the event start time.
+	 * \param hits        Hits of the event.
+	 */
+	void addEvent(long eventNumber, const std::vector<GFrameHit>& hits);
+
+	/**
+	 * \brief Emit every remaining frame, up to the last one holding hits.
+	 *
+	 * \details
+	 * Called at the end of the run, once no event can still be added.
+	 */
+	void flush();
+
+	/**
+	 * \brief Returns the frame ID containing an absolute time.
+	 *
+	 * \param absoluteTime Time on the absolute axis.
+	 * \return 1-based grid ID, before \c frameIDOffset; values below 1 are before the grid start.
+	 */
+	[[nodiscard]] long frameID(double absoluteTime) const;
+
+	/// \brief Number of frames passed to the sink so far.
+	[[nodiscard]] long getFramesEmitted() const;
+
+	/// \brief Number of hits dropped because their frame had already been emitted.
+	[[nodiscard]] long getLateHits() const;
+
+	/// \brief Number of frames currently held in memory.
+	[[nodiscard]] std::size_t getPendingFrames() const;
+
+private:
+	/// Emit frames lastEmitted + 1 to grid ID \p lastFrame. Requires the lock.
+	void emitUpTo(long lastFrame);
+
+	double                    frameDuration;
+	double                    gridStartTime;
+	double                    eventDuration;
+	FrameSink                 sink;
+	std::shared_ptr<GLogger>  log;
+	std::size_t               maxPendingFrames;
+	long                      frameIDOffset;
+	std::chrono::milliseconds maxWait;
+
+	mutable std::mutex      mutex;
+	std::condition_variable eventsAdvanced; ///< Notified when nextEvent moves or an event is declared stalled.
+
+	/// Frames that received hits and are not complete yet, keyed by grid ID.
+	std::map<long, std::unique_ptr<GFrameDataCollection>> pendingFrames;
+
+	/// Events added ahead of nextEvent, waiting for the gap below them to close.
+	std::set<long> eventsAhead;
+
+	long nextEvent     = 0;  ///< Lowest event number not added yet.
+	long stalledEvent  = -1; ///< Missing event the maxWait ran out on; threads are not held back for it.
+	long lastEmitted   = 0;  ///< Frames up to this grid ID have been emitted.
+	long framesEmitted = 0;
+	long lateHits      = 0;
+};
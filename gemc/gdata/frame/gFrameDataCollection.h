@@ -8,28 +8,16 @@
  * A frame collection groups multiple GIntegralPayload objects under a single GFrameHeader.
  * This models streaming/readout output where many channels may fire within a time window.
  *
- * Ownership model (current implementation):
- * - GFrameDataCollection adopts the GFrameHeader pointer passed at construction and deletes it
- *   in the destructor
- * - payloads are allocated with \c new in \ref GFrameDataCollection::addIntegralPayload "addIntegralPayload()"
- *   and deleted in the destructor
- * - the internal payload container is also heap-allocated and deleted in the destructor
- *
- * \note
- * The class uses raw pointers today. If it is modernized in the future, the natural replacement is
- * \c std::unique_ptr<GFrameHeader> together with
- * \c std::vector<std::unique_ptr<GIntegralPayload>>.
- *
- * \warning
- * Because raw pointers are used, callers must follow the ownership rules strictly:
- * - do not delete the header after passing it to the constructor
- * - do not delete payload pointers returned by \ref GFrameDataCollection::getIntegralPayload "getIntegralPayload()"
- * - do not store returned pointers beyond the lifetime of the owning GFrameDataCollection
+ * Ownership model:
+ * - GFrameDataCollection owns its GFrameHeader and its payloads through \c std::unique_ptr
+ * - \ref GFrameDataCollection::getIntegralPayload "getIntegralPayload()" exposes the owned payloads
+ *   read-only; pointers taken from it are valid as long as the collection exists
  */
 
 #include "gFrameHeader.h"
 #include "gIntegralPayload.h"
 #include <gemc/gdata/gdataConventions.h>
+#include <memory>
 #include <vector>
 
 /**
@@ -51,51 +39,21 @@ public:
 	/**
 	 * \brief Construct a frame data collection.
 	 *
-	 * \details
-	 * Ownership:
-	 * - \p header is adopted by this object and deleted in the destructor
-	 *
-	 * Internal storage:
-	 * - the payload pointer vector is allocated on the heap for historical reasons
-	 *
-	 * \param header Frame header pointer. Ownership is transferred to this object.
+	 * \param header Frame header, adopted by this object.
 	 * \param logger Logger instance used for diagnostics.
 	 */
-	GFrameDataCollection(GFrameHeader* header, std::shared_ptr<GLogger> logger)
-		: log(logger), gevent_header(header) {
+	GFrameDataCollection(std::unique_ptr<GFrameHeader> header, std::shared_ptr<GLogger> logger)
+		: log(std::move(logger)), gframe_header(std::move(header)) {
 		log->debug(CONSTRUCTOR, "GFrameDataCollection");
-		integralPayloads = new std::vector<GIntegralPayload*>();
 	}
 
-	// Owns raw pointers freed in the destructor: forbid copy (a shallow copy would double-free)
-	// and move (no current need; re-enable with explicit pointer-nulling move ops if required).
 	GFrameDataCollection(const GFrameDataCollection&)            = delete;
 	GFrameDataCollection& operator=(const GFrameDataCollection&) = delete;
 	GFrameDataCollection(GFrameDataCollection&&)                 = delete;
 	GFrameDataCollection& operator=(GFrameDataCollection&&)      = delete;
 
-	/**
-	 * \brief Destructor.
-	 *
-	 * \details
-	 * Deletes in the following order:
-	 * - the owned frame header
-	 * - all owned payload pointers
-	 * - the payload vector container
-	 *
-	 * \warning
-	 * Any pointers previously returned by \ref GFrameDataCollection::getHeader "getHeader()"
-	 * or \ref GFrameDataCollection::getIntegralPayload "getIntegralPayload()"
-	 * become invalid after destruction.
-	 */
-	~GFrameDataCollection() {
-		log->debug(DESTRUCTOR, "GFrameDataCollection");
-		delete gevent_header;
-		for (auto* payload : *integralPayloads) { delete payload; }
-		delete integralPayloads;
-	}
+	~GFrameDataCollection() { log->debug(DESTRUCTOR, "GFrameDataCollection"); }
 
-public:
 	/**
 	 * \brief Add one integral payload to this frame.
 	 *
@@ -110,30 +68,15 @@ public:
 	 * - payload[3] = charge
 	 * - payload[4] = time
 	 *
-	 * On success:
-	 * - a new GIntegralPayload is allocated and stored internally
-	 *
 	 * On failure:
 	 * - \ref ERR_WRONGPAYLOAD is reported via the logger
 	 * - no payload is added
 	 *
 	 * \param payload Packed payload vector with exactly five integer entries.
 	 */
-	void addIntegralPayload(std::vector<int> payload) const {
+	void addIntegralPayload(const std::vector<int>& payload) {
 		// Decode the fixed packed layout only when the payload size matches the contract.
-		if (payload.size() == 5) {
-			int crate   = payload[0];
-			int slot    = payload[1];
-			int channel = payload[2];
-			int charge  = payload[3];
-			int time    = payload[4];
-
-			// Create and store one owned payload object for this frame.
-			auto gpayload = new GIntegralPayload(crate, slot, channel, charge, time, log);
-			integralPayloads->push_back(gpayload);
-			log->debug(NORMAL, " adding integral payload for crate ", crate, " slot ", slot, " channel ", channel,
-			           " charge ", charge, " time ", time);
-		}
+		if (payload.size() == 5) { addIntegralPayload(payload[0], payload[1], payload[2], payload[3], payload[4]); }
 		else {
 			// Reject malformed packed payloads and keep the collection unchanged.
 			log->error(ERR_WRONGPAYLOAD, "payload size is not 5 but ", payload.size());
@@ -141,53 +84,38 @@ public:
 	}
 
 	/**
-	 * \brief Placeholder for adding event-level information into the frame.
-	 *
-	 * \details
-	 * Intended future usage:
-	 * - accept an event number or event object
-	 * - integrate it into this frame's payload list by collecting channels hit during the frame window
+	 * \brief Add one integral payload from its unpacked fields.
 	 *
-	 * \param evn Event number.
+	 * \param crate   Crate number.
+	 * \param slot    Slot number inside the crate.
+	 * \param channel Channel number inside the slot.
+	 * \param charge  Integrated charge or ADC proxy.
+	 * \param time    Time or TDC proxy.
 	 */
-	void addEvent(int evn);
+	void addIntegralPayload(int crate, int slot, int channel, int charge, int time) {
+		integralPayloads.push_back(std::make_unique<GIntegralPayload>(crate, slot, channel, charge, time, log));
+		log->debug(NORMAL, " adding integral payload for crate ", crate, " slot ", slot, " channel ", channel,
+		           " charge ", charge, " time ", time);
+	}
 
-	/**
-	 * \brief Placeholder decision hook indicating whether this frame should be emitted.
-	 *
-	 * \details
-	 * Intended future usage:
-	 * - decide whether enough data has accumulated
-	 * - decide whether the frame time window has elapsed
-	 * - trigger writing this frame to an output stream
-	 *
-	 * \return \c true if the frame should be written.
-	 */
-	[[nodiscard]] bool shouldWriteFrame() const;
+	/// \brief Reserve room for \p n payloads, for producers that know the frame occupancy in advance.
+	void reserve(std::size_t n) { integralPayloads.reserve(n); }
 
 	/**
 	 * \brief Returns the owned frame header.
 	 *
-	 * \details
-	 * The returned pointer remains valid as long as this GFrameDataCollection exists.
-	 * The header is owned by this object and must not be deleted by the caller.
-	 *
-	 * \return Pointer to the frame header owned by this object.
+	 * \return Pointer to the frame header, valid as long as this GFrameDataCollection exists.
 	 */
-	[[nodiscard]] inline const GFrameHeader* getHeader() const { return gevent_header; }
+	[[nodiscard]] inline const GFrameHeader* getHeader() const { return gframe_header.get(); }
 
 	/**
-	 * \brief Returns the stored payload pointers.
+	 * \brief Returns the stored payloads.
 	 *
-	 * \details
-	 * The returned pointers:
-	 * - are owned by this object
-	 * - remain valid only as long as the collection exists
-	 * - must not be deleted by the caller
-	 *
-	 * \return Pointer to the internal payload vector.
+	 * \return Read-only reference to the owned payloads, in insertion order.
 	 */
-	[[nodiscard]] inline const std::vector<GIntegralPayload*>* getIntegralPayload() const { return integralPayloads; }
+	[[nodiscard]] inline auto getIntegralPayload() const -> const std::vector<std::unique_ptr<GIntegralPayload>>& {
+		return integralPayloads;
+	}
 
 	/**
 	 * \brief Convenience getter for the frame ID.
@@ -197,10 +125,10 @@ public:
 	 *
 	 * \return Frame ID as stored in the header.
 	 */
-	[[nodiscard]] inline long int getFrameID() const { return gevent_header->getFrameID(); }
+	[[nodiscard]] inline long int getFrameID() const { return gframe_header->getFrameID(); }
 
 private:
-	std::shared_ptr<GLogger>        log;                     ///< Logger instance.
-	GFrameHeader*                   gevent_header = nullptr; ///< Owned frame header deleted in the destructor.
-	std::vector<GIntegralPayload*>* integralPayloads;        ///< Owned payload pointers deleted in the destructor.
-};
\ No newline at end of file
+	std::shared_ptr<GLogger>                       log;              ///< Logger instance.
+	std::unique_ptr<GFrameHeader>                  gframe_header;    ///< Owned frame header.
+	std::vector<std::unique_ptr<GIntegralPayload>> integralPayloads; ///< Owned payloads in insertion order.
+};
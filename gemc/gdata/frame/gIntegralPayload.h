@@ -94,6 +94,16 @@ public:
 		return payload;
 	}
 
+	/// \name Field accessors
+	/// \brief Individual fields, for writers that must not build a vector per payload.
+	///@{
+	[[nodiscard]] int getCrate() const { return crate; }
+	[[nodiscard]] int getSlot() const { return slot; }
+	[[nodiscard]] int getChannel() const { return channel; }
+	[[nodiscard]] int getCharge() const { return charge; }
+	[[nodiscard]] int getTime() const { return time; }
+	///@}
+
 private:
 	std::shared_ptr<GLogger> log;     ///< Logger instance used only for diagnostics.
 	int                      crate;   ///< Crate number.
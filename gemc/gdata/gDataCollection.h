@@ -89,7 +89,7 @@ public:
 	 * This method is intended for integrated usage.
 	 *
 	 * Behavior:
-	 * - if the truth vector is empty, a deep copy of \p data becomes the first accumulator entry
+	 * - if the truth vector is empty, a flat copy of \p data becomes the first accumulator entry
 	 * - otherwise, each numeric truth observable from \p data is summed into the first entry
 	 *
 	 * Current integration policy:
@@ -100,8 +100,9 @@ public:
 	 */
 	void collectTrueInfosData(const std::unique_ptr<GTrueInfoData>& data) {
 		// The first integrated contribution creates the detector-local accumulator entry.
+		// The accumulator owns all its variables, track-level ones included.
 		if (trueInfosData.empty()) {
-			trueInfosData.push_back(std::make_unique<GTrueInfoData>(*data));
+			trueInfosData.push_back(data->flattened());
 		}
 		else {
 			// Subsequent contributions add only numeric observables into the first stored entry.
@@ -172,6 +173,9 @@ public:
 		trueInfosData.push_back(std::move(data));
 	}
 
+	/// Drops the true-information entries, keeping the digitized ones.
+	void clearTrueInfoData() { trueInfosData.clear(); }
+
 	/**
 	 * \brief Returns read-only access to the stored truth objects.
 	 *
@@ -213,6 +217,19 @@ public:
 		return digitizedData;
 	}
 
+	/**
+	 * \brief Estimated memory held by this collection and all its hits, in bytes.
+	 *
+	 * \return Approximate size in bytes.
+	 */
+	[[nodiscard]] std::size_t estimatedBytes() const {
+		std::size_t bytes = sizeof(GDataCollection) +
+		                    (trueInfosData.capacity() + digitizedData.capacity()) * sizeof(void*);
+		for (const auto& hit : trueInfosData) { bytes += hit->estimatedBytes(); }
+		for (const auto& hit : digitizedData) { bytes += hit->estimatedBytes(); }
+		return bytes;
+	}
+
 private:
 	/**
 	 * \brief Stored truth objects for this detector.
@@ -11,6 +11,7 @@
 
 #include "gDigitizedData.h"
 #include "gdataConventions.h"
+#include "gdataMemory.h"
 
 // c++
 #include <map>
@@ -220,3 +221,13 @@ std::ostream& operator<<(std::ostream& os, const GDigitizedData& data) {
 	os << "}";
 	return os;
 }
+
+std::size_t GDigitizedData::estimatedBytes() const {
+	return sizeof(GDigitizedData) +
+	       gdata::heapBytes(intObservablesMap) +
+	       gdata::heapBytes(doubleObservablesMap) +
+	       gdata::heapBytes(transientVariablesMap) +
+	       gdata::heapBytes(arrayIntObservablesMap) +
+	       gdata::heapBytes(arrayDoubleObservablesMap) +
+	       gdata::heapBytes(gidentity);
+}
@@ -241,6 +241,22 @@ public:
 	 */
 	[[nodiscard]] std::map<std::string, double> getDblObservablesMap(int which) const;
 
+	/**
+	 * \brief Read-only view of all integer observables, SRO keys included.
+	 *
+	 * \details
+	 * Unlike \ref GDigitizedData::getIntObservablesMap "getIntObservablesMap()" this neither filters
+	 * nor copies, so output writers can walk every hit without allocating.
+	 *
+	 * \return Reference to the stored integer observables.
+	 */
+	[[nodiscard]] auto getIntObservablesView() const -> const std::map<std::string, int>& { return intObservablesMap; }
+
+	/// \brief Read-only view of all floating-point observables, SRO keys included.
+	[[nodiscard]] auto getDblObservablesView() const -> const std::map<std::string, double>& {
+		return doubleObservablesMap;
+	}
+
 	/**
 	 * \brief Returns the conventional \c timeAtElectronics integer observable when present.
 	 *
@@ -311,6 +327,17 @@ public:
 	 */
 	[[nodiscard]] inline const std::vector<GIdentifier>& getIdentity() const { return gidentity; }
 
+	/**
+	 * \brief Estimated memory held by this hit, in bytes.
+	 *
+	 * \details
+	 * Counts the object itself, its observable maps, and its identity. Streamers use it to bound
+	 * the memory of the events they buffer.
+	 *
+	 * \return Approximate size in bytes.
+	 */
+	[[nodiscard]] std::size_t estimatedBytes() const;
+
 	/**
 	 * \brief Creates deterministic example data for tests and examples.
 	 *
@@ -340,6 +367,22 @@ public:
 		return digi_data;
 	}
 
+	/**
+	 * \brief Returns whether a key belongs in the requested filtered view.
+	 *
+	 * \details
+	 * Filtering modes:
+	 * - \c which = 0 : accept non-SRO keys only
+	 * - \c which = 1 : accept SRO keys only
+	 *
+	 * The check uses the conventional key names defined in gdataConventions.h.
+	 *
+	 * \param varName Observable key to classify.
+	 * \param which   Requested filter selector.
+	 * \return \c true if the variable should be included in the selected view.
+	 */
+	[[nodiscard]] static bool validVarName(const std::string& varName, int which);
+
 private:
 	/// Scalar integer observables associated with this digitized hit.
 	std::map<std::string, int> intObservablesMap;
@@ -359,22 +402,6 @@ private:
 	/// Detector identity copied from the originating hit.
 	std::vector<GIdentifier> gidentity;
 
-	/**
-	 * \brief Returns whether a key belongs in the requested filtered view.
-	 *
-	 * \details
-	 * Filtering modes:
-	 * - \c which = 0 : accept non-SRO keys only
-	 * - \c which = 1 : accept SRO keys only
-	 *
-	 * The check uses the conventional key names defined in gdataConventions.h.
-	 *
-	 * \param varName Observable key to classify.
-	 * \param which   Requested filter selector.
-	 * \return \c true if the variable should be included in the selected view.
-	 */
-	[[nodiscard]] static bool validVarName(const std::string& varName, int which);
-
 	/**
 	 * \brief Global example/test counter used by \ref GDigitizedData::create "create()".
 	 *
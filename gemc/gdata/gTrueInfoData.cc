@@ -6,10 +6,13 @@
  * - copies hit identity at construction so the object is independent of the source hit lifetime
  * - stores per-hit variables with overwrite semantics
  * - accumulates numeric variables by summation for integrated usage
+ * - merges the shared track record back into the flat per-hit layout on request
  * - builds a compact identity string for logs and stream output
  */
 
 #include "gTrueInfoData.h"
+#include "gdataMemory.h"
+#include "gdataConventions.h"
 #include <string>
 #include <utility>
 
@@ -22,6 +25,10 @@ GTrueInfoData::GTrueInfoData(const std::shared_ptr<GOptions>& gopts, const GHit*
 	gidentity = ghit->getGID();
 }
 
+GTrueInfoData::GTrueInfoData(const std::shared_ptr<GOptions>& gopts, std::vector<GIdentifier> identity)
+	: GBase(gopts, GTRUEDATA_LOGGER), gidentity(std::move(identity)) {
+}
+
 void GTrueInfoData::includeVariable(const std::string& varName, double value) {
 	// Event-level insertion with overwrite semantics.
 	doubleObservablesMap[varName] = value;
@@ -48,6 +55,28 @@ void GTrueInfoData::accumulateVariable(const std::string& vname, double value) {
 	}
 }
 
+std::map<std::string, double> GTrueInfoData::getDoubleVariablesMap() const {
+	// Hit-level values win over track-level ones with the same key.
+	auto variables = doubleObservablesMap;
+	if (trackInfo) { variables.insert(trackInfo->doubleObservablesMap.begin(), trackInfo->doubleObservablesMap.end()); }
+	return variables;
+}
+
+std::map<std::string, std::string> GTrueInfoData::getStringVariablesMap() const {
+	auto variables = stringVariablesMap;
+	if (trackInfo) { variables.insert(trackInfo->stringVariablesMap.begin(), trackInfo->stringVariablesMap.end()); }
+	return variables;
+}
+
+std::unique_ptr<GTrueInfoData> GTrueInfoData::flattened() const {
+	auto flat                  = std::make_unique<GTrueInfoData>(*this);
+	flat->doubleObservablesMap = getDoubleVariablesMap();
+	flat->stringVariablesMap   = getStringVariablesMap();
+	flat->doubleObservablesMap.erase(TRACKINDEXSTRINGID);
+	flat->trackInfo.reset();
+	return flat;
+}
+
 
 std::ostream& operator<<(std::ostream& os, const GTrueInfoData& data) {
 	auto idString = getIdentityString(data.gidentity);
@@ -82,4 +111,11 @@ std::ostream& operator<<(std::ostream& os, const GTrueInfoData& data) {
 
 	os << "}";
 	return os;
-}
\ No newline at end of file
+}
+
+std::size_t GTrueInfoData::estimatedBytes() const {
+	return sizeof(GTrueInfoData) +
+	       gdata::heapBytes(doubleObservablesMap) +
+	       gdata::heapBytes(stringVariablesMap) +
+	       gdata::heapBytes(gidentity);
+}
@@ -31,6 +31,12 @@
  * - each object stores a copy of the hit identity vector extracted from GHit
  * - the identity is preserved independently of the originating hit lifetime
  *
+ * Track-level truth:
+ * - quantities shared by every hit of a track (pid, vertex, mother and creator process) live in
+ *   one track record per track and event, see \ref GTrueInfoData::setTrackInfo "setTrackInfo()"
+ * - \ref GTrueInfoData::getDoubleVariablesMap "getDoubleVariablesMap()" and
+ *   \ref GTrueInfoData::flattened "flattened()" expand them into the flat per-hit layout
+ *
  * Threading:
  * - regular instances do not share mutable state
  * - the example/test factory \ref GTrueInfoData::create "create()" uses a static atomic counter
@@ -38,6 +44,7 @@
 
 #include <atomic>
 #include <map>
+#include <memory>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -120,6 +127,17 @@ public:
 	 */
 	GTrueInfoData(const std::shared_ptr<GOptions>& gopts, const GHit* ghit);
 
+	/**
+	 * \brief Constructs an empty object with an explicit identity.
+	 *
+	 * \details
+	 * Used for track records, which belong to no single hit and carry an empty identity.
+	 *
+	 * \param gopts    Shared options used to configure logging and related behavior.
+	 * \param identity Identity vector to store.
+	 */
+	GTrueInfoData(const std::shared_ptr<GOptions>& gopts, std::vector<GIdentifier> identity);
+
 	/**
 	 * \brief Stores or overwrites one numeric truth observable.
 	 *
@@ -170,19 +188,34 @@ public:
 	void accumulateVariable(const std::string& vname, double value);
 
 	/**
-	 * \brief Returns a copy of the numeric truth observables.
+	 * \brief Returns a copy of the numeric truth observables, track-level ones included.
 	 *
 	 * \details
 	 * Returning by value preserves encapsulation and prevents external mutation of the internal map.
+	 * The variables of the track record are merged in, so the result has the flat per-hit layout.
 	 *
 	 * \return Copy of the double-valued observables map.
 	 */
-	[[nodiscard]] inline std::map<std::string, double> getDoubleVariablesMap() const {
-		return doubleObservablesMap;
+	[[nodiscard]] std::map<std::string, double> getDoubleVariablesMap() const;
+
+	/**
+	 * \brief Returns one numeric truth observable without copying the map.
+	 *
+	 * \details
+	 * Variables missing from the hit are looked up in its track record.
+	 *
+	 * \param varName Observable key.
+	 * \param fallback Value returned when the observable is not present.
+	 * \return The stored value, or \p fallback.
+	 */
+	[[nodiscard]] inline double getDoubleVariable(const std::string& varName, double fallback = 0) const {
+		const auto it = doubleObservablesMap.find(varName);
+		if (it != doubleObservablesMap.end()) { return it->second; }
+		return trackInfo ? trackInfo->getDoubleVariable(varName, fallback) : fallback;
 	}
 
 	/**
-	 * \brief Returns a copy of the string truth observables.
+	 * \brief Returns a copy of the string truth observables, track-level ones included.
 	 *
 	 * \details
 	 * These values are usually categorical or provenance-oriented and are typically not merged
@@ -190,10 +223,43 @@ public:
 	 *
 	 * \return Copy of the string-valued observables map.
 	 */
-	[[nodiscard]] inline std::map<std::string, std::string> getStringVariablesMap() const {
+	[[nodiscard]] std::map<std::string, std::string> getStringVariablesMap() const;
+
+	/// \brief Read-only view of the hit-level numeric observables, for writers that must not copy them per hit.
+	[[nodiscard]] auto getDoubleVariablesView() const -> const std::map<std::string, double>& {
+		return doubleObservablesMap;
+	}
+
+	/// \brief Read-only view of the hit-level string observables, for writers that must not copy them per hit.
+	[[nodiscard]] auto getStringVariablesView() const -> const std::map<std::string, std::string>& {
 		return stringVariablesMap;
 	}
 
+	/**
+	 * \brief Attaches the track record holding the track-level truth of this hit.
+	 *
+	 * \details
+	 * Hits of the same track share one record, so its variables are stored once per track.
+	 *
+	 * \param track Shared track record, or null to detach.
+	 */
+	void setTrackInfo(std::shared_ptr<const GTrueInfoData> track) { trackInfo = std::move(track); }
+
+	/// \brief The shared track record of this hit; null for hits without one.
+	[[nodiscard]] auto getTrackInfo() const -> const std::shared_ptr<const GTrueInfoData>& { return trackInfo; }
+
+	/**
+	 * \brief Returns a self-contained copy in the flat per-hit layout.
+	 *
+	 * \details
+	 * The copy holds the hit and track variables in its own maps and no track record. The
+	 * \c trackIndex reference added by the event container is dropped, so the result matches the
+	 * layout of hits stored without a track record.
+	 *
+	 * \return Newly allocated flat copy.
+	 */
+	[[nodiscard]] std::unique_ptr<GTrueInfoData> flattened() const;
+
 	/**
 	 * \brief Creates deterministic example data for tests and examples.
 	 *
@@ -237,6 +303,18 @@ public:
 	 */
 	[[nodiscard]] inline const std::vector<GIdentifier>& getIdentity() const { return gidentity; }
 
+	/**
+	 * \brief Estimated memory held by this hit, in bytes.
+	 *
+	 * \details
+	 * Counts the object itself, its observable maps, and its identity. The shared track record is
+	 * not included: the event container counts it once. Streamers use it to bound the memory of
+	 * the events they buffer.
+	 *
+	 * \return Approximate size in bytes.
+	 */
+	[[nodiscard]] std::size_t estimatedBytes() const;
+
 private:
 	/**
 	 * \brief Numeric truth observables.
@@ -267,6 +345,9 @@ private:
 	 */
 	std::vector<GIdentifier> gidentity;
 
+	/// Track-level truth shared by the hits of the same track; null when the hit stores it all.
+	std::shared_ptr<const GTrueInfoData> trackInfo;
+
 	/**
 	 * \brief Global example/test counter used by \ref GTrueInfoData::create "create()".
 	 *
@@ -41,6 +41,8 @@
 constexpr int ERR_GSDETECTORNOTFOUND = 601; ///< Requested sensitive detector entry is missing.
 constexpr int ERR_VARIABLENOTFOUND   = 602; ///< Requested observable key is missing.
 constexpr int ERR_WRONGPAYLOAD       = 603; ///< Packed payload vector has an unexpected size or layout.
+constexpr int ERR_WRONGFRAMEGRID     = 604; ///< Frame or event duration is not positive.
+constexpr int ERR_EVENTFROZEN        = 605; ///< Hit data were modified after the event was frozen.
 /** @} */
 
 /**
@@ -65,3 +67,18 @@ constexpr const char* CHANNELSTRINGID     = "channel"; ///< Channel index within
 constexpr const char* CHARGEATELECTRONICS = "chargeAtElectronics"; ///< Electronics-stage charge or ADC proxy.
 constexpr const char* TIMEATELECTRONICS   = "timeAtElectronics";   ///< Electronics-stage time or TDC proxy.
 /** @} */
+
+/**
+ * \name Track-level truth key names
+ * \brief Keys linking per-hit truth to the per-track records of an event.
+ * \ingroup gdata_module_conventions
+ *
+ * \details
+ * Track-level truth is stored once per track, detector and event. Each hit refers to its record through
+ * \c TRACKINDEXSTRINGID, the position of the record in the event track table, which streamers
+ * publish under the detector name \c TRACKTRUEINFONAME when the track layout is requested.
+ * @{
+ */
+constexpr const char* TRACKINDEXSTRINGID = "trackIndex";  ///< Index of the hit's record in the event track table.
+constexpr const char* TRACKTRUEINFONAME  = "true_tracks"; ///< Output name of the event track table.
+/** @} */
@@ -59,6 +59,8 @@
  * Event-level lifecycle:
  * - GEventDataCollection owns one GEventHeader
  * - GEventDataCollection owns the per-detector map of GDataCollection objects
+ * - GEventDataCollection also owns the event track table: track-level truth (pid, vertices,
+ *   mother, creator process) stored once per track and detector and shared by the hits of that track
  *
  * Run-level lifecycle:
  * - GRunDataCollection owns one GRunHeader and one detector-summary map
@@ -195,8 +197,8 @@
  *
  * Example snippet:
  * \code
- * auto frameHeader = new GFrameHeader(frameID, frameDuration, log);
- * auto frameData   = new GFrameDataCollection(frameHeader, log);
+ * auto frameHeader = std::make_unique<GFrameHeader>(frameID, frameDuration, log);
+ * auto frameData   = std::make_unique<GFrameDataCollection>(std::move(frameHeader), log);
  * frameData->addIntegralPayload({1, 2, 3, 100, 50});
  * \endcode
  *
@@ -0,0 +1,59 @@
+#pragma once
+
+/**
+ * \file gdataMemory.h
+ * \brief Approximate heap-footprint helpers used by the gdata containers.
+ *
+ * \details
+ * Streamers buffer whole events before writing them, so they need a cheap estimate of how much
+ * memory each buffered event holds. These helpers count the bytes owned by the standard containers
+ * used in gdata: the element storage, the per-node overhead of ordered maps, and the heap buffers
+ * of strings too long for the small-string optimization.
+ *
+ * The numbers are estimates, not allocator measurements: they are meant to be stable and fast
+ * enough to be evaluated once per event, and close enough to bound the buffered memory.
+ */
+
+// gemc
+#include <gemc/gtouchable/gtouchable.h>
+
+// c++
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace gdata {
+
+/// \brief Per-node bookkeeping of a red-black tree node: three links and the color.
+inline constexpr std::size_t MAP_NODE_OVERHEAD = 4 * sizeof(void*);
+
+/// \brief Heap bytes owned by a value type with no dynamic storage.
+template <typename T>
+[[nodiscard]] constexpr std::size_t heapBytes(const T&) { return 0; }
+
+/// \brief Heap bytes owned by a string: none while it fits in the small-string buffer.
+[[nodiscard]] inline std::size_t heapBytes(const std::string& s) {
+	return s.capacity() > std::string().capacity() ? s.capacity() + 1 : 0;
+}
+
+/// \brief Heap bytes owned by one identity entry: its name.
+[[nodiscard]] inline std::size_t heapBytes(const GIdentifier& id) { return heapBytes(id.getName()); }
+
+/// \brief Heap bytes owned by a vector, including those owned by its elements.
+template <typename T>
+[[nodiscard]] std::size_t heapBytes(const std::vector<T>& v) {
+	std::size_t bytes = v.capacity() * sizeof(T);
+	for (const auto& element : v) { bytes += heapBytes(element); }
+	return bytes;
+}
+
+/// \brief Heap bytes owned by an ordered map: one node per entry plus what keys and values own.
+template <typename K, typename V>
+[[nodiscard]] std::size_t heapBytes(const std::map<K, V>& m) {
+	std::size_t bytes = m.size() * (sizeof(typename std::map<K, V>::value_type) + MAP_NODE_OVERHEAD);
+	for (const auto& [key, value] : m) { bytes += heapBytes(key) + heapBytes(value); }
+	return bytes;
+}
+
+} // namespace gdata
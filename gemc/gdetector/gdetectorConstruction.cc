@@ -264,8 +264,9 @@ void GDetectorConstruction::ConstructSDandField() {
 					           "> has digitization <", digitization, "> but no identifier.");
 				}
 				const auto &mass = g4volume->GetMass();
+				const auto volume = g4volume->GetSolid()->GetCubicVolume();
 				auto this_gtouchable = std::make_shared<
-					GTouchable>(gopt, digitization, *identity, vdimensions, mass);
+					GTouchable>(gopt, digitization, *identity, vdimensions, mass, volume);
 				sensitiveDetectorsMap[digitization]->registerGVolumeTouchable(g4name, this_gtouchable);
 
 				// Attach the SD to the logical volume (no AddNewDetector call needed for reused SDs).
@@ -414,6 +415,9 @@ void GDetectorConstruction::loadDigitizationPlugins() {
 		if (digitization_routines_map->at(sdname)->defineReadoutSpecs()) {
 			log->info(1, "Digitization routine <" + sdname + "> has been successfully defined.");
 		} else { log->error(ERR_DEFINESPECFAIL, "defineReadoutSpecs failure for <" + sdname + ">"); }
+
+		// Per-step cuts declared by the routine, copied by each sensitive detector on assignment.
+		digitization_routines_map->at(sdname)->definePreHitFilter();
 	}
 }
 
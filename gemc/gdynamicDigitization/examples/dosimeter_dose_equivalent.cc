@@ -0,0 +1,117 @@
+/**
+ * \file dosimeter_dose_equivalent.cc
+ * \brief Checks the dose equivalent of the dosimeter digitization against the photon coefficient table.
+ *
+ * Photon steps of known energy and length are digitized in a cell of known volume, so each step
+ * contributes a known track-length fluence. The dose equivalent divided by that fluence must give the
+ * tabulated coefficient of \c dosimeterData/DoseEq/Data/dose_photon.txt at the table energies, the
+ * linear interpolation of the table between them, and the end values outside the table. A hit with
+ * several steps must give the sum of their contributions in pSv.
+ */
+
+#include "gDosimeterDigitization.h"
+#include "gdynamicdigitization_options.h"
+
+// geant4
+#include "G4DynamicParticle.hh"
+#include "G4Gamma.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4TouchableHistory.hh"
+#include "G4Track.hh"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace {
+
+// Photon rows of dose_photon.txt: kinetic energy (MeV), coefficient (pSv cm2).
+const std::vector<std::pair<double, double>> photonRows = {
+	{0.01, 0.083}, {0.015, 0.85}, {0.02, 1.05}, {0.1, 0.62}, {1, 5.18},
+	{1.5, 6.92},   {3, 10.4},     {4, 10.7},    {100, 9},    {10000, 12.2},
+};
+
+// Cell volume and step length giving a fluence of 0.25 / cm2 per step.
+constexpr double cellVolume = 8 * cm3;
+constexpr double stepLength = 2 * cm;
+constexpr double fluence    = 0.25;
+
+bool close_to(double value, double expected, double tolerance) {
+	if (std::abs(value - expected) <= tolerance * std::abs(expected)) { return true; }
+	std::cerr << "dose equivalent " << value << " pSv, expected " << expected << " pSv\n";
+	return false;
+}
+
+// Digitize one hit made of photon steps with the given kinetic energies and return its dose equivalent.
+double dose_equivalent(GDosimeterDigitization& dosimeter, const std::shared_ptr<GTouchable>& touchable,
+                       const std::vector<double>& energies) {
+	G4TouchableHandle g4touchable = new G4TouchableHistory();
+	G4Track           track(new G4DynamicParticle(G4Gamma::Definition(), G4ThreeVector(0, 0, 1), 1 * MeV), 0,
+	                        G4ThreeVector());
+	track.SetTrackID(1);
+	track.SetParentID(0);
+
+	G4Step step;
+	step.SetTrack(&track);
+
+	GHit hit(touchable);
+	for (const double energy : energies) {
+		auto* pre = step.GetPreStepPoint();
+		pre->SetTouchableHandle(g4touchable);
+		pre->SetMass(0);
+		pre->SetKineticEnergy(energy);
+		pre->SetMomentumDirection(G4ThreeVector(0, 0, 1));
+		step.SetTotalEnergyDeposit(0.1 * energy);
+		step.SetStepLength(stepLength);
+		hit.addHitInfos(&step);
+	}
+
+	return dosimeter.digitizeHit(&hit, 0)->getDblObservable("doseEquivalent");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gdynamicdigitization::defineOptions());
+
+	GDosimeterDigitization dosimeter(gopts);
+	dosimeter.set_loggers(gopts);
+	if (!dosimeter.defineReadoutSpecs() || !dosimeter.loadConstants(1, "default")) { return EXIT_FAILURE; }
+
+	auto touchable = std::make_shared<GTouchable>(gopts, gtouchable::DOSIMETERNAME, "sector: 1",
+	                                              std::vector<double>{}, 1 * kg, cellVolume);
+
+	// Table energies. The grid is uniform in log-energy, so a table energy between two grid nodes
+	// is reproduced to the resampling precision of 256 nodes per decade.
+	for (const auto& [energy, coefficient] : photonRows) {
+		if (!close_to(dose_equivalent(dosimeter, touchable, {energy * MeV}), coefficient * fluence, 5e-3)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Between adjacent table rows the table is linear in energy.
+	for (const auto& [lower, upper] : {std::pair{0, 1}, std::pair{4, 5}, std::pair{6, 7}}) {
+		const auto [e0, c0] = photonRows[lower];
+		const auto [e1, c1] = photonRows[upper];
+		const double middle = 0.5 * (e0 + e1);
+		if (!close_to(dose_equivalent(dosimeter, touchable, {middle * MeV}), 0.5 * (c0 + c1) * fluence, 1e-3)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Outside the table the coefficient is clamped to the end values.
+	if (!close_to(dose_equivalent(dosimeter, touchable, {0.001 * MeV}), 0.083 * fluence, 1e-9) ||
+	    !close_to(dose_equivalent(dosimeter, touchable, {1e5 * MeV}), 12.2 * fluence, 1e-9)) {
+		return EXIT_FAILURE;
+	}
+
+	// Known fluence: 1 MeV and 100 MeV photons each crossing 2 cm of an 8 cm3 cell, 0.25 / cm2 each:
+	// 5.18 * 0.25 + 9 * 0.25 = 3.545 pSv. Decade energies fall on grid nodes, so the sum is exact.
+	if (!close_to(dose_equivalent(dosimeter, touchable, {1 * MeV, 100 * MeV}), 3.545, 1e-9)) { return EXIT_FAILURE; }
+
+	return EXIT_SUCCESS;
+}
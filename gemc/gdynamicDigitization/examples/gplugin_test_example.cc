@@ -64,11 +64,20 @@ bool GPlugin_test_example::loadTTImpl([[maybe_unused]] int runno,
 
 	auto edep = ghit->getTotalEnergyDeposited();
 
-	double digi_time = 0;
+	// Scratch storage comes from the calling thread's context: the plugin instance is shared
+	// by all worker threads, so it must not be written here.
+	auto& context = threadContext<ThreadContext>();
+	context.digitizedHits++;
 
 	// Example time shaping: scale each recorded time and sum.
+	context.scaledTimes.clear();
 	for (auto& time : ghit->getTimes()) {
-		digi_time += time * 10;
+		context.scaledTimes.push_back(time * 10);
+	}
+
+	double digi_time = 0;
+	for (auto scaledTime : context.scaledTimes) {
+		digi_time += scaledTime;
 	}
 
 	digitizedData->includeVariable("voltage", edep);
@@ -77,6 +86,10 @@ bool GPlugin_test_example::loadTTImpl([[maybe_unused]] int runno,
 	return digitizedData;
 }
 
+std::unique_ptr<GDigitizationThreadContext> GPlugin_test_example::makeThreadContextImpl() const {
+	return std::make_unique<ThreadContext>();
+}
+
 // Tells the DLL how to create a GPlugin_test_example in each plugin .so/.dylib.
 // The dynamic plugin loader expects an extern "C" function named GDynamicDigitizationFactory.
 extern "C" GDynamicDigitization* GDynamicDigitizationFactory(const std::shared_ptr<GOptions>& g) {
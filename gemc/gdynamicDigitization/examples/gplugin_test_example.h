@@ -89,6 +89,7 @@ public:
 	 * - creating a GDigitizedData record
 	 * - computing a "voltage" from total deposited energy
 	 * - building a synthetic "digi_time" by scaling and summing hit step times
+	 * - using the per-thread context as scratch storage instead of a shared member
 	 *
 	 * \param ghit Input hit to digitize. Ownership stays with the caller.
 	 * \param hitn Hit index (unused in this example).
@@ -96,7 +97,20 @@ public:
 	 */
 	[[nodiscard]] std::unique_ptr<GDigitizedData> digitizeHitImpl(GHit* ghit, [[maybe_unused]] size_t hitn) override;
 
+	/**
+	 * \brief Creates the per-thread scratch state used by digitizeHitImpl().
+	 *
+	 * \return A new ThreadContext for the calling worker thread.
+	 */
+	[[nodiscard]] std::unique_ptr<GDigitizationThreadContext> makeThreadContextImpl() const override;
+
 private:
+	/// Per-thread scratch state: written while digitizing, so it cannot be a plugin member.
+	struct ThreadContext : GDigitizationThreadContext {
+		std::vector<double> scaledTimes;       ///< Reused buffer of scaled step times.
+		size_t              digitizedHits = 0; ///< Hits digitized by this thread.
+	};
+
 	/// Example scalar configuration value.
 	double var1 = 1;
 
@@ -75,14 +75,19 @@ auto run_simulation_in_threads(int
 				auto gevent_header = GEventHeader::create(gopt);
 				auto eventData     = std::make_unique<GEventDataCollection>(gopt, std::move(gevent_header));
 
-				// Each event has 2 hits in this example.
-				for (unsigned i = 1; i < 3; i++) {
-					auto hit       = GHit::create(gopt);
-					auto true_data = dynamicRoutinesMap->at(plugin_name)->collectTrueInformation(hit, i);
-					auto digi_data = dynamicRoutinesMap->at(plugin_name)->digitizeHit(hit, i);
-
-					eventData->addDetectorDigitizedData("ctof", std::move(digi_data));
-					eventData->addDetectorTrueInfoData("ctof", std::move(true_data));
+				// Each event has 2 hits in this example, digitized as one collection.
+				const auto&         routine = dynamicRoutinesMap->at(plugin_name);
+				std::vector<GHit*>  hits    = {GHit::create(gopt), GHit::create(gopt)};
+				std::vector<size_t> hitns   = {1, 2};
+
+				std::vector<std::unique_ptr<GDigitizedData>> digi_data(hits.size());
+				std::vector<std::unique_ptr<GTrueInfoData>>  true_data(hits.size());
+				routine->digitizeHits(hits, 1, digi_data);
+				routine->collectHitsTrueInformation(hits, hitns, true_data);
+
+				for (size_t i = 0; i < hits.size(); i++) {
+					eventData->addDetectorDigitizedData("ctof", std::move(digi_data[i]));
+					eventData->addDetectorTrueInfoData("ctof", std::move(true_data[i]));
 				}
 
 				log->info(0, "worker ", tid, " event ", evn, " has ",
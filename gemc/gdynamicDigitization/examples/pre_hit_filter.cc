@@ -0,0 +1,151 @@
+/**
+ * \file pre_hit_filter.cc
+ * \brief Checks each cut of GPreHitFilter and the filters the routines build from the options.
+ *
+ * Steps of known particles, deposited energies and times go through filters declaring one cut
+ * at a time: zero and minimum deposited energy, neutral rejection, the PDG allow and deny lists,
+ * and the time window, whose bounds are inclusive. The default filter accepts every step.
+ *
+ * The routines start from a filter that skips zero-energy steps unless \c -recordZeroEdep is
+ * given; the photon detector accepts them in both cases and only lets optical photons through.
+ */
+
+#include "gFluxDigitization.h"
+#include "gPhotonDetectorDigitization.h"
+#include "gdynamicdigitization_options.h"
+
+// geant4
+#include "G4DynamicParticle.hh"
+#include "G4Electron.hh"
+#include "G4Gamma.hh"
+#include "G4OpticalPhoton.hh"
+#include "G4Proton.hh"
+#include "G4SystemOfUnits.hh"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+/// A step of one particle ending at a given global time.
+struct ParticleStep
+{
+	G4Track track;
+	G4Step  step;
+
+	ParticleStep(G4ParticleDefinition* particle, double time)
+		: track(new G4DynamicParticle(particle, G4ThreeVector(0, 0, 1), 1 * MeV), 0, G4ThreeVector()) {
+		step.SetTrack(&track);
+		step.GetPostStepPoint()->SetGlobalTime(time);
+	}
+};
+
+bool check(bool rejects, bool expected, const std::string& what) {
+	if (rejects == expected) { return true; }
+	std::cerr << "pre_hit_filter: " << what << (expected ? " should be rejected\n" : " should be accepted\n");
+	return false;
+}
+
+GPreHitFilter compiled(GPreHitFilter filter) {
+	filter.compile();
+	return filter;
+}
+
+/// Filter a routine built from the given command line stores.
+template <typename Routine>
+GPreHitFilter routine_filter(std::string program, bool recordZeroEdep) {
+	std::string record = "-recordZeroEdep";
+	char*       argv[] = {program.data(), record.data()};
+	auto        gopts  = std::make_shared<GOptions>(recordZeroEdep ? 2 : 1, argv, gdynamicdigitization::defineOptions());
+	Routine     routine(gopts);
+	routine.set_loggers(gopts);
+	routine.definePreHitFilter();
+	return *routine.preHitFilter;
+}
+
+} // namespace
+
+int main([[maybe_unused]] int argc, char* argv[]) {
+	ParticleStep electron(G4Electron::Definition(), 15 * ns);
+	ParticleStep proton(G4Proton::Definition(), 15 * ns);
+	ParticleStep gamma(G4Gamma::Definition(), 15 * ns);
+	ParticleStep photon(G4OpticalPhoton::Definition(), 15 * ns);
+	ParticleStep early(G4Electron::Definition(), 5 * ns);
+	ParticleStep first(G4Electron::Definition(), 10 * ns);
+	ParticleStep last(G4Electron::Definition(), 20 * ns);
+	ParticleStep late(G4Electron::Definition(), 25 * ns);
+
+	const GPreHitFilter none = compiled({});
+
+	GPreHitFilter zero;
+	zero.skipZeroEdep = true;
+	zero              = compiled(zero);
+
+	GPreHitFilter threshold;
+	threshold.minEdep = 1 * keV;
+	threshold         = compiled(threshold);
+
+	GPreHitFilter charged;
+	charged.rejectNeutral = true;
+	charged               = compiled(charged);
+
+	// Unsorted, with a duplicate: compile() sorts the lists for the binary search.
+	GPreHitFilter allowed;
+	allowed.allowedPDG = {2212, 11, 2212};
+	allowed            = compiled(allowed);
+
+	GPreHitFilter denied;
+	denied.deniedPDG = {22};
+	denied           = compiled(denied);
+
+	GPreHitFilter both;
+	both.allowedPDG = {22, 11};
+	both.deniedPDG  = {22};
+	both            = compiled(both);
+
+	GPreHitFilter window;
+	window.minTime = 10 * ns;
+	window.maxTime = 20 * ns;
+	window         = compiled(window);
+
+	const bool rules =
+		check(none.rejects(0, &electron.step), false, "a zero-energy step without cuts") &&
+		check(none.rejects(1 * MeV, &gamma.step), false, "a photon without cuts") &&
+		check(zero.rejects(0, &electron.step), true, "a zero-energy step") &&
+		check(zero.rejects(1 * eV, &electron.step), false, "a step depositing 1 eV") &&
+		check(threshold.rejects(0.5 * keV, &electron.step), true, "a step below the minimum energy") &&
+		check(threshold.rejects(1 * keV, &electron.step), false, "a step at the minimum energy") &&
+		check(charged.rejects(1 * MeV, &gamma.step), true, "a neutral particle") &&
+		check(charged.rejects(1 * MeV, &electron.step), false, "a charged particle") &&
+		check(allowed.rejects(1 * MeV, &electron.step), false, "an allowed electron") &&
+		check(allowed.rejects(1 * MeV, &proton.step), false, "an allowed proton") &&
+		check(allowed.rejects(1 * MeV, &gamma.step), true, "a photon missing from the allow list") &&
+		check(denied.rejects(1 * MeV, &gamma.step), true, "a denied photon") &&
+		check(denied.rejects(1 * MeV, &electron.step), false, "an electron missing from the deny list") &&
+		check(both.rejects(1 * MeV, &gamma.step), true, "a photon both allowed and denied") &&
+		check(both.rejects(1 * MeV, &electron.step), false, "an allowed electron not denied") &&
+		check(window.rejects(1 * MeV, &early.step), true, "a step before the time window") &&
+		check(window.rejects(1 * MeV, &first.step), false, "a step at the window start") &&
+		check(window.rejects(1 * MeV, &electron.step), false, "a step inside the time window") &&
+		check(window.rejects(1 * MeV, &last.step), false, "a step at the window end") &&
+		check(window.rejects(1 * MeV, &late.step), true, "a step after the time window");
+	if (!rules) { return EXIT_FAILURE; }
+
+	// Options: recordZeroEdep turns the zero-energy cut of the routines off.
+	const auto flux         = routine_filter<GFluxDigitization>(argv[0], false);
+	const auto fluxRecorded = routine_filter<GFluxDigitization>(argv[0], true);
+	const auto optical      = routine_filter<GPhotonDetectorDigitization>(argv[0], false);
+	const auto opticalRec   = routine_filter<GPhotonDetectorDigitization>(argv[0], true);
+
+	const bool options =
+		check(flux.rejects(0, &electron.step), true, "a zero-energy flux step without recordZeroEdep") &&
+		check(fluxRecorded.rejects(0, &electron.step), false, "a zero-energy flux step with recordZeroEdep") &&
+		check(flux.rejects(1 * MeV, &gamma.step), false, "a flux photon") &&
+		check(optical.rejects(0, &photon.step), false, "a zero-energy optical photon") &&
+		check(opticalRec.rejects(0, &photon.step), false, "a zero-energy optical photon with recordZeroEdep") &&
+		check(optical.rejects(1 * MeV, &electron.step), true, "an electron in the photon detector");
+
+	return options ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,84 @@
+/**
+ * \file readout_time_cells.cc
+ * \brief Checks GReadoutSpecs::timeCellIndex() against the division it replaces.
+ *
+ * The index is computed with the reciprocal of the time window and falls back to the division near
+ * a cell boundary. For several windows and grid origins, including negative ones, the example
+ * compares it with \c floor((t - gridStartTime) / timeWindow) + 1 at every boundary of a range of
+ * cells, one and two ulps below and above each boundary, and at the cell centers.
+ */
+
+#include "greadoutSpecs.h"
+#include "gdynamicdigitization_options.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <utility>
+
+namespace {
+
+int divisionIndex(double time, double timeWindow, double gridStartTime) {
+	return static_cast<int>(std::floor((time - gridStartTime) / timeWindow) + 1);
+}
+
+bool same_index(const GReadoutSpecs& specs, double time, double timeWindow, double gridStartTime) {
+	const int expected = divisionIndex(time, timeWindow, gridStartTime);
+	const int index    = specs.timeCellIndex(time);
+	if (index == expected) { return true; }
+	std::cerr.precision(17);
+	std::cerr << "time " << time << " with window " << timeWindow << " and start " << gridStartTime << ": index "
+		<< index << ", division gives " << expected << "\n";
+	return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gdynamicdigitization::defineOptions());
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, GDIGITIZATION_LOGGER);
+
+	// Exact boundaries of a simple grid, from both sides, with the 1-based convention.
+	const GReadoutSpecs simple(10, 0, 1, log);
+	constexpr double    inf = std::numeric_limits<double>::infinity();
+	if (simple.timeCellIndex(0) != 1 || simple.timeCellIndex(-1e-9) != 0 ||
+	    simple.timeCellIndex(10) != 2 || simple.timeCellIndex(std::nextafter(10.0, -inf)) != 1 ||
+	    simple.timeCellIndex(-10) != 0 || simple.timeCellIndex(std::nextafter(-10.0, -inf)) != -1) {
+		return EXIT_FAILURE;
+	}
+
+	// Windows whose reciprocal is not exact, and origins on both sides of zero.
+	const double windows[] = {10, 0.1, 3, 1.0 / 3, 2.5, 0.7, 25e-3};
+	const double starts[]  = {0, 12.5, -7.3, -1.0 / 3};
+
+	int checked = 0;
+	for (const double timeWindow : windows) {
+		for (const double gridStartTime : starts) {
+			const GReadoutSpecs specs(timeWindow, gridStartTime, 1, log);
+
+			for (int k = -2000; k <= 2000; k++) {
+				// The boundary as a step time would carry it, and the times just around it.
+				const double boundary = gridStartTime + k * timeWindow;
+				double       below    = boundary;
+				double       above    = boundary;
+				for (int ulp = 0; ulp < 3; ulp++) {
+					if (!same_index(specs, below, timeWindow, gridStartTime) ||
+					    !same_index(specs, above, timeWindow, gridStartTime)) {
+						return EXIT_FAILURE;
+					}
+					below = std::nextafter(below, -inf);
+					above = std::nextafter(above, inf);
+				}
+
+				// Cell centers are far from any boundary and take the reciprocal path.
+				if (!same_index(specs, boundary + 0.5 * timeWindow, timeWindow, gridStartTime)) { return EXIT_FAILURE; }
+				checked += 7;
+			}
+		}
+	}
+
+	std::cout << checked << " times binned as with the division\n";
+	return EXIT_SUCCESS;
+}
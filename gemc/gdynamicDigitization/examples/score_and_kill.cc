@@ -0,0 +1,138 @@
+/**
+ * \file score_and_kill.cc
+ * \brief Checks the parsing of the score_and_kill option and the tracks GScoreAndKill kills.
+ *
+ * The option is given by the meson test:
+ *
+ * \code
+ * ./score_and_kill -score_and_kill="[{detector: flux}, {detector: particle_counter, pids: '11, -11'},
+ *                                    {detector: beamdump_plane, pids: '2112, 22'}]"
+ * \endcode
+ *
+ * Steps of known particles are placed in known volumes, and each routine must kill exactly the
+ * tracks its entries select: routine-wide entries apply to the routine they name only, volume
+ * entries to every routine, in both the \c "<system>/<volume>" and \c "<volume>" forms. Without
+ * entries nothing is killed. The example also checks the per-thread mark the sensitive detector
+ * leaves on a stopped track.
+ */
+
+#include "gscoreAndKill.h"
+#include "gdynamicdigitization_options.h"
+
+// gemc
+#include "gtouchableConventions.h"
+
+// geant4
+#include "G4Box.hh"
+#include "G4DynamicParticle.hh"
+#include "G4Electron.hh"
+#include "G4Gamma.hh"
+#include "G4LogicalVolume.hh"
+#include "G4NavigationHistory.hh"
+#include "G4Neutron.hh"
+#include "G4NistManager.hh"
+#include "G4PVPlacement.hh"
+#include "G4Proton.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4TouchableHistory.hh"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace {
+
+/// A step of one particle in one volume.
+struct VolumeStep
+{
+	G4Track track;
+	G4Step  step;
+
+	VolumeStep(G4ParticleDefinition* particle, G4VPhysicalVolume* volume)
+		: track(new G4DynamicParticle(particle, G4ThreeVector(0, 0, 1), 1 * MeV), 0, G4ThreeVector()) {
+		G4NavigationHistory history;
+		history.SetFirstEntry(volume);
+		step.SetTrack(&track);
+		step.GetPreStepPoint()->SetTouchableHandle(G4TouchableHandle(new G4TouchableHistory(history)));
+	}
+};
+
+G4VPhysicalVolume* volume(const std::string& name) {
+	auto* box     = new G4Box(name, 1 * cm, 1 * cm, 1 * cm);
+	auto* logical = new G4LogicalVolume(box, G4NistManager::Instance()->FindOrBuildMaterial("G4_AIR"), name);
+	return new G4PVPlacement(nullptr, G4ThreeVector(), logical, name, nullptr, false, 0);
+}
+
+bool check(bool kills, bool expected, const std::string& what) {
+	if (kills == expected) { return true; }
+	std::cerr << "score_and_kill: " << what << (expected ? " should be killed\n" : " should not be killed\n");
+	return false;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gdynamicdigitization::defineOptions());
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, GDIGITIZATION_LOGGER);
+
+	GScoreAndKill flux, counter, photon;
+	flux.load(gopts, log, gtouchable::FLUXNAME);
+	counter.load(gopts, log, gtouchable::COUNTERNAME);
+	photon.load(gopts, log, gtouchable::GPHOTON_DETECTORNAME);
+	if (!flux.isActive() || !counter.isActive() || !photon.isActive()) {
+		std::cerr << "score_and_kill: every routine has at least the volume entry\n";
+		return EXIT_FAILURE;
+	}
+
+	auto* plane    = volume("shield/beamdump_plane");
+	auto* bare     = volume("beamdump_plane");
+	auto* detector = volume("shield/detector");
+
+	VolumeStep electron(G4Electron::Definition(), detector);
+	VolumeStep proton(G4Proton::Definition(), detector);
+	VolumeStep neutronPlane(G4Neutron::Definition(), plane);
+	VolumeStep gammaBare(G4Gamma::Definition(), bare);
+	VolumeStep protonPlane(G4Proton::Definition(), plane);
+
+	const bool passed =
+		// flux: routine-wide for every particle; the particle_counter entry is not its own.
+		check(flux.kills(&proton.step), true, "a flux proton") &&
+		check(flux.kills(&electron.step), true, "a flux electron") &&
+		// particle_counter: routine-wide for electrons and positrons only.
+		check(counter.kills(&electron.step), true, "a counter electron") &&
+		check(counter.kills(&proton.step), false, "a counter proton outside beamdump_plane") &&
+		// gPhotonDetector: the volume entry only, in both name forms.
+		check(photon.kills(&electron.step), false, "an electron outside beamdump_plane") &&
+		check(photon.kills(&neutronPlane.step), true, "a neutron in shield/beamdump_plane") &&
+		check(photon.kills(&gammaBare.step), true, "a photon in beamdump_plane") &&
+		check(photon.kills(&protonPlane.step), false, "a proton in beamdump_plane") &&
+		check(counter.kills(&neutronPlane.step), true, "a counter neutron in beamdump_plane");
+	if (!passed) { return EXIT_FAILURE; }
+
+	// Without score_and_kill entries no routine kills anything.
+	char* noEntries[] = {argv[0]};
+	auto  bareOptions = std::make_shared<GOptions>(1, noEntries, gdynamicdigitization::defineOptions());
+	GScoreAndKill none;
+	none.load(bareOptions, log, gtouchable::FLUXNAME);
+	if (none.isActive() || none.kills(&proton.step)) {
+		std::cerr << "score_and_kill: a routine without entries kills tracks\n";
+		return EXIT_FAILURE;
+	}
+
+	// The stopped-track mark belongs to one track and one step, and is taken once.
+	GScoreAndKill::markStoppedTrack(&electron.track);
+	const bool otherTrack = GScoreAndKill::takeStoppedTrack(&proton.track);
+	GScoreAndKill::markStoppedTrack(&electron.track);
+	const bool marked   = GScoreAndKill::takeStoppedTrack(&electron.track);
+	const bool takeOnce = GScoreAndKill::takeStoppedTrack(&electron.track);
+	GScoreAndKill::markStoppedTrack(&electron.track);
+	electron.track.IncrementCurrentStepNumber();
+	const bool laterStep = GScoreAndKill::takeStoppedTrack(&electron.track);
+	if (otherTrack || !marked || takeOnce || laterStep) {
+		std::cerr << "score_and_kill: wrong stopped-track mark\n";
+		return EXIT_FAILURE;
+	}
+
+	return EXIT_SUCCESS;
+}
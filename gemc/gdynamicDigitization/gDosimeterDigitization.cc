@@ -9,7 +9,10 @@
  */
 
 #include "gDosimeterDigitization.h"
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <map>
 
 // See header for API docs.
 bool GDosimeterDigitization::defineReadoutSpecsImpl() {
@@ -38,29 +41,42 @@ std::unique_ptr<GDigitizedData> GDosimeterDigitization::digitizeHitImpl(GHit* gh
 	gdata->includeVariable("etot", etot / MeV);
 	gdata->includeVariable("dose", dose / gemc_units::picogray);
 
-	//log->info(0, FUNCTION_NAME, "Edep: ", etot, ", hitn:", ghit->getEdeps().size());
-
-	// // Per-step information used to build the NIEL-weight.
-	// auto pids = ghit->getPids();
-	//
-	// double nielWeight = 0;
-	//
-	// // Accumulate NIEL factor step-by-step. This treats each step independently and sums
-	// // the interpolated factors for supported particle species.
-	// for (size_t stepIndex = 0; stepIndex < pids.size(); stepIndex++) {
-	// 	// Use absolute PID so negative particle IDs (e.g. -11) are handled.
-	// 	int pid = std::abs(pids[stepIndex]);
-	//
-	// 	// Only a few particle types are supported by the calibration data files.
-	// 	if (pid == 11 || pid == 211 || pid == 2212 || pid == 2112) {
-	// 		// Convert from total energy to kinetic-like quantity used by the NIEL tables
-	// 		// by subtracting the particle rest mass (in MeV).
-	// 		double E   = pEnergies[stepIndex] - pMassMeV[pid];
-	// 		nielWeight += getNielFactorForParticleAtEnergy(pid, E);
-	// 	}
-	// }
-
-	// gdata->includeVariable("nielWeight", nielWeight);
+	// Per-step information used to build the NIEL weight and the dose equivalent.
+	const auto  pids        = ghit->getPids();
+	const auto  trackEs     = ghit->getTrackEs();
+	const auto& stepLengths = ghit->getStepLengths();
+	const auto  nsteps      = std::min(pids.size(), trackEs.size());
+
+	// Track-length fluence estimator: each step adds its length over the cell volume.
+	const double volume         = ghit->getVolume();
+	const bool   hasDoseEq      = volume > 0 && stepLengths.size() >= nsteps;
+	double       nielWeight     = 0;
+	double       doseEquivalent = 0;
+
+	for (size_t stepIndex = 0; stepIndex < nsteps; stepIndex++) {
+		const int    pid         = pids[stepIndex];
+		const double totalEnergy = trackEs[stepIndex] / CLHEP::MeV;
+
+		// NIEL-weight: sum of the NIEL factor at the step kinetic energy.
+		// Use absolute PID so antiparticles (e.g. -11) share the particle table.
+		const int gridIndex = nielGridIndex(std::abs(pid));
+		if (gridIndex >= 0 && !nielGrids[gridIndex].values.empty()) {
+			const auto& grid = nielGrids[gridIndex];
+			nielWeight += valueAtEnergy(grid, totalEnergy - grid.massMeV);
+		}
+
+		// Dose equivalent: fluence coefficient (pSv cm2) times the step fluence (1/cm2).
+		if (hasDoseEq) {
+			const auto doseEqGrid = doseEqGrids.find(pid);
+			if (doseEqGrid != doseEqGrids.end()) {
+				const double fluence = (stepLengths[stepIndex] / CLHEP::cm) / (volume / CLHEP::cm3);
+				doseEquivalent += valueAtEnergy(doseEqGrid->second, totalEnergy - doseEqGrid->second.massMeV) * fluence;
+			}
+		}
+	}
+
+	gdata->includeVariable("nielWeight", nielWeight);
+	gdata->includeVariable("doseEquivalent", doseEquivalent);
 
 	return gdata;
 }
@@ -68,94 +84,140 @@ std::unique_ptr<GDigitizedData> GDosimeterDigitization::digitizeHitImpl(GHit* gh
 // See header for API docs.
 bool GDosimeterDigitization::loadConstantsImpl([[maybe_unused]] int                runno,
 											   [[maybe_unused]] std::string const& variation) {
-	// Map from particle id to the calibration filename (text, 2 columns).
+	// Particle rest masses used to compute the kinetic energy (MeV).
+	std::map<int, double> pMassMeV;
+	pMassMeV[11]   = 0.510;
+	pMassMeV[13]   = 105.658;
+	pMassMeV[22]   = 0;
+	pMassMeV[211]  = 139.570;
+	pMassMeV[321]  = 493.677;
+	pMassMeV[2112] = 939.565;
+	pMassMeV[2212] = 938.272;
+
+	// NIEL factor tables: the particle table is shared by the antiparticle.
 	std::map<int, std::string> nielDataFiles;
 	nielDataFiles[11]   = "niel_electron.txt";
 	nielDataFiles[211]  = "niel_pion.txt";
 	nielDataFiles[2112] = "niel_neutron.txt";
 	nielDataFiles[2212] = "niel_proton.txt";
 
+	for (const auto& [pid, filename] : nielDataFiles) {
+		nielGrids[nielGridIndex(pid)] = loadEnergyGrid("Niel/" + filename, pMassMeV[pid]);
+	}
+
+	// Fluence to ambient dose equivalent coefficients, keyed by signed PDG code.
+	std::map<int, std::string> doseEqDataFiles;
+	doseEqDataFiles[11]   = "dose_electron.txt";
+	doseEqDataFiles[-11]  = "dose_positron.txt";
+	doseEqDataFiles[13]   = "dose_muminus.txt";
+	doseEqDataFiles[-13]  = "dose_muplus.txt";
+	doseEqDataFiles[22]   = "dose_photon.txt";
+	doseEqDataFiles[211]  = "dose_piplus.txt";
+	doseEqDataFiles[-211] = "dose_piminus.txt";
+	doseEqDataFiles[321]  = "dose_kplus.txt";
+	doseEqDataFiles[-321] = "dose_kminus.txt";
+	doseEqDataFiles[2112] = "dose_neutron.txt";
+	doseEqDataFiles[2212] = "dose_proton.txt";
+
+	doseEqGrids.clear();
+	for (const auto& [pid, filename] : doseEqDataFiles) {
+		doseEqGrids[pid] = loadEnergyGrid("DoseEq/Data/" + filename, pMassMeV[std::abs(pid)]);
+	}
+
+	return true;
+}
+
+// See header for API docs.
+GDosimeterDigitization::EnergyGrid GDosimeterDigitization::loadEnergyGrid(const std::string& relativePath,
+                                                                          double             massMeV) const {
 	// GEMC installation root used to locate plugin data.
 	std::filesystem::path gemcRoot = gutilities::gemc_root();
 
-	for (const auto& [pid, filename] : nielDataFiles) {
-		std::string dataFileWithPath = gemcRoot.string() + "/dosimeterData" + "/Niel/" + filename;
-
-		std::ifstream inputfile(dataFileWithPath);
+	std::string   dataFileWithPath = gemcRoot.string() + "/dosimeterData/" + relativePath;
+	std::ifstream inputfile(dataFileWithPath);
+	if (!inputfile) {
+		// On Linux, tests may run from the build directory, where plugin data lives under
+		// gdynamicDigitization/...
+		dataFileWithPath = gemcRoot.string() + "/gemc/gdynamicDigitization/dosimeterData/" + relativePath;
+		inputfile.open(dataFileWithPath);
 		if (!inputfile) {
-			// On Linux, tests may run from the build directory, where plugin data lives under
-			// gdynamicDigitization/...
-			dataFileWithPath = gemcRoot.string() + "/gemc/gdynamicDigitization/dosimeterData" + "/Niel/" + filename;
-			inputfile.open(dataFileWithPath);
-			if (!inputfile) {
-				log->error(guts::EC__FILENOTFOUND, "Error loading dosimeter data for pid <", pid, "> from file ",
-						   dataFileWithPath);
-			}
+			log->error(guts::EC__FILENOTFOUND, "Error loading dosimeter data from file ", dataFileWithPath);
 		}
+	}
 
-		log->info(1, " Loading dosimeter data for pid <", pid, "> from file ", dataFileWithPath);
+	log->info(1, " Loading dosimeter data from file ", dataFileWithPath);
 
-		// Expected file format: repeated pairs (factor, energyMeV).
-		double p0, p1;
-		while (inputfile >> p0 >> p1) {
-			nielfactorMap[pid].push_back(p0);
-			E_nielfactorMap[pid].push_back(p1);
-		}
-		inputfile.close();
+	// Expected file format: repeated pairs (energyMeV, value), see dosimeterData/Niel/README.txt.
+	std::vector<double> energies, values;
+	double              energy, value;
+	while (inputfile >> energy >> value) {
+		energies.push_back(energy);
+		values.push_back(value);
 	}
 
-	// Particle rest masses used by the interpolation routine (MeV).
-	pMassMeV[11]   = 0.510;
-	pMassMeV[211]  = 139.570;
-	pMassMeV[2112] = 939.565;
-	pMassMeV[2212] = 938.272;
-
-	return true;
+	return makeEnergyGrid(energies, values, massMeV, dataFileWithPath);
 }
 
 // See header for API docs.
-double GDosimeterDigitization::getNielFactorForParticleAtEnergy(int pid, double energyMeV) {
-	const auto niel_N = nielfactorMap[pid].size();
-
-	// Guard against missing/empty calibration data.
-	// (If this happens, it indicates loadConstantsImpl did not populate the maps as expected.)
-	if (niel_N == 0) {
-		log->error(guts::EC__FILENOTFOUND, "NIEL tables are empty for pid <", pid, ">. Did loadConstantsImpl fail?");
-		return 0.0;
-	}
-
-	// j is the first index for which energyMeV < E_table[j]. Initialize to "past the end".
-	size_t j = niel_N;
-
-	for (size_t i = 0; i < niel_N; i++) {
-		if (energyMeV < E_nielfactorMap[pid][i]) {
-			j = i;
-			break;
+GDosimeterDigitization::EnergyGrid GDosimeterDigitization::makeEnergyGrid(const std::vector<double>& energies,
+                                                                          const std::vector<double>& values,
+                                                                          double                     massMeV,
+                                                                          const std::string&         source) const {
+	// Keep the rows with strictly increasing energy: the interpolation needs a monotonic table.
+	std::vector<double> tableE, tableV;
+	for (size_t i = 0; i < energies.size(); i++) {
+		// Repeated end points are harmless; decreasing energies point to a typo in the table.
+		if (!tableE.empty() && energies[i] == tableE.back()) { continue; }
+		if (energies[i] <= 0 || (!tableE.empty() && energies[i] < tableE.back())) {
+			log->warning("skipping row ", i + 1, " with energy ", energies[i], " MeV in ", source,
+			             ": energies must be positive and increasing");
+			continue;
 		}
+		tableE.push_back(energies[i]);
+		tableV.push_back(values[i]);
+	}
+	if (tableE.size() < 2) {
+		log->error(ERR_LOADCONSTANTFAIL, "dosimeter table ", source, " needs at least two valid rows, found ",
+		           tableE.size());
 	}
 
-	double value = 0.0;
+	EnergyGrid grid;
+	grid.massMeV = massMeV;
+	grid.logEmin = std::log(tableE.front());
 
-	if (j > 0 && j < niel_N) {
-		// Linear interpolation between (j-1) and j.
-		const auto nielfactor_low  = nielfactorMap[pid][j - 1];
-		const auto nielfactor_high = nielfactorMap[pid][j];
-		const auto energy_low      = E_nielfactorMap[pid][j - 1];
-		const auto energy_high     = E_nielfactorMap[pid][j];
+	const double logRange = std::log(tableE.back()) - grid.logEmin;
+	const auto   nodes    = static_cast<size_t>(std::ceil(logRange / std::log(10.0) * GRID_NODES_PER_DECADE)) + 1;
+	grid.invLogStep       = static_cast<double>(nodes - 1) / logRange;
+	grid.values.resize(nodes);
 
-		value = nielfactor_low +
-				( nielfactor_high - nielfactor_low ) / ( energy_high - energy_low ) * ( energyMeV - energy_low );
-	}
-	else if (j == 0) {
-		// energy below the first threshold: clamp to first value.
-		value = nielfactorMap[pid].front();
-	}
-	else {
-		// energy beyond the last threshold: clamp to last value.
-		value = nielfactorMap[pid].back();
+	// Walk the table once while the node energies increase.
+	size_t j = 1;
+	for (size_t i = 0; i < nodes; i++) {
+		const double e = i + 1 == nodes ? tableE.back()
+		                                : std::exp(grid.logEmin + static_cast<double>(i) / grid.invLogStep);
+		while (j + 1 < tableE.size() && tableE[j] < e) { j++; }
+
+		const double t = std::clamp((e - tableE[j - 1]) / (tableE[j] - tableE[j - 1]), 0.0, 1.0);
+		grid.values[i] = tableV[j - 1] + t * (tableV[j] - tableV[j - 1]);
 	}
 
-	log->debug(NORMAL, " pid: ", pid, ", j: ", j, ", value: ", value, ", energy: ", energyMeV);
+	log->info(1, " Resampled ", tableE.size(), " rows from ", source, " onto ", nodes, " log-energy nodes");
 
-	return value;
+	return grid;
+}
+
+// See header for API docs.
+double GDosimeterDigitization::valueAtEnergy(const EnergyGrid& grid, double energyMeV) {
+	// Below the table, including non-positive kinetic energies: clamp to the first value.
+	if (energyMeV <= 0) { return grid.values.front(); }
+
+	const double x    = (std::log(energyMeV) - grid.logEmin) * grid.invLogStep;
+	const auto   last = grid.values.size() - 1;
+	if (x <= 0) { return grid.values.front(); }
+	if (x >= static_cast<double>(last)) { return grid.values.back(); }
+
+	// Linear interpolation between the two enclosing nodes.
+	const auto   i    = static_cast<size_t>(x);
+	const double frac = x - static_cast<double>(i);
+	return grid.values[i] + frac * (grid.values[i + 1] - grid.values[i]);
 }
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <gemc/gdynamicDigitization/gdynamicdigitization.h> // Base class for dynamic digitization.
-#include <map>
-#include <vector>
+#include <array>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 /**
  * \class GDosimeterDigitization
@@ -14,12 +15,16 @@
  * NIEL factor from calibration tables on disk.
  *
  * The calibration tables are loaded by \ref GDynamicDigitization::loadConstants "loadConstants()"
- * and stored in internal maps keyed by particle id.
+ * and resampled once onto dense grids uniform in log-energy, one per supported particle, so the
+ * per-step lookup is a few arithmetic operations and one linear interpolation.
  *
  * Digitized output variables include (at minimum):
  * - detector identity (the name/value of the first GIdentifier)
- * - total deposited energy ("eTot")
+ * - total deposited energy ("etot")
+ * - dose ("dose")
  * - computed NIEL sum ("nielWeight")
+ * - ambient dose equivalent in pSv ("doseEquivalent"), from the track-length fluence of each step
+ *   in the cell and the fluence to dose equivalent coefficients of its particle
  *
  * \warning
  * This routine assumes that the dosimeter data files exist in the expected installation
@@ -48,7 +53,10 @@ public:
 	 * 2. Walks the per-step arrays (pid and energy) stored in the hit.
 	 * 3. For supported particle species, computes an effective energy (MeV) as:
 	 *    effectiveEnergy = stepEnergy - particleRestMass
+	 *    (electrons, charged pions, neutrons, protons, and their antiparticles)
 	 * 4. Sums the interpolated NIEL factor evaluated at that effective energy.
+	 * 5. Sums the dose equivalent of each step: the fluence to dose equivalent coefficient at the
+	 *    effective energy times the step length over the cell volume. Skipped when the volume is unknown.
 	 *
 	 * \param ghit Pointer to the hit to digitize. Ownership stays with the caller.
 	 * \param hitn Sequential hit index within the detector collection (unused).
@@ -60,7 +68,10 @@ public:
 	 * \brief Loads digitization constants for dosimeter digitization.
 	 *
 	 * This routine loads:
-	 * - NIEL factor tables from text files (two columns: factor and energy in MeV).
+	 * - NIEL factor tables from text files (two columns: energy in MeV and factor),
+	 *   resampled onto the log-energy grids used by the per-step lookup.
+	 * - Fluence to ambient dose equivalent tables (two columns: energy in MeV and pSv cm2),
+	 *   resampled the same way and keyed by PDG code.
 	 * - Particle rest masses in MeV used to compute effective energy.
 	 *
 	 * File locations are resolved relative to the GEMC installation root.
@@ -73,39 +84,82 @@ public:
 
 private:
 	/**
-	 * \brief NIEL factor values indexed by particle id.
+	 * \brief Tabulated quantity of one particle species, sampled uniformly in log-energy.
 	 *
-	 * For each particle species, the values in this vector correspond 1-to-1 with the
-	 * energies stored in \c E_nielfactorMap for the same particle id.
+	 * Node \c i holds the value at energy \c exp(logEmin + i / invLogStep) MeV, linearly
+	 * interpolated from the calibration table. Energies outside the table domain are clamped
+	 * to the first or last node.
 	 */
-	std::map<int, std::vector<double>> nielfactorMap;
+	struct EnergyGrid
+	{
+		double              massMeV    = 0; ///< Rest mass subtracted from the step total energy.
+		double              logEmin    = 0; ///< Natural log of the first table energy (MeV).
+		double              invLogStep = 0; ///< Nodes per unit of natural log-energy.
+		std::vector<double> values;         ///< Resampled table values.
+	};
+
+	/// Grid nodes per decade of energy: fine enough to follow the resonance structure of the neutron NIEL table.
+	static constexpr int GRID_NODES_PER_DECADE = 256;
+
+	/// NIEL factor grids for electrons, charged pions, neutrons, and protons, in that order.
+	std::array<EnergyGrid, 4> nielGrids;
 
 	/**
-	 * \brief Energy grid (MeV) for NIEL factor interpolation, indexed by particle id.
+	 * \brief Fluence to ambient dose equivalent coefficients (pSv cm2), keyed by signed PDG code.
 	 *
-	 * These energies are interpreted as the independent variable of the calibration table.
-	 * Interpolation is performed between adjacent grid points.
+	 * Loaded from \c dosimeterData/DoseEq/Data for electrons, positrons, muons, photons, charged pions,
+	 * charged kaons, neutrons, and protons. Other species do not contribute to \c doseEquivalent.
 	 */
-	std::map<int, std::vector<double>> E_nielfactorMap;
+	std::unordered_map<int, EnergyGrid> doseEqGrids;
 
 	/**
-	 * \brief Particle rest masses (MeV) used to compute effective energy for the tables.
+	 * \brief Returns the NIEL grid slot of a particle id, or -1 if no NIEL table covers it.
+	 *
+	 * \param pid Absolute PDG code.
+	 */
+	static int nielGridIndex(int pid) {
+		switch (pid) {
+		case 11: return 0;
+		case 211: return 1;
+		case 2112: return 2;
+		case 2212: return 3;
+		default: return -1;
+		}
+	}
+
+	/**
+	 * \brief Reads a two-column (energy in MeV, value) table from the dosimeter data and resamples it.
+	 *
+	 * \param relativePath Path of the table inside \c dosimeterData.
+	 * \param massMeV Particle rest mass (MeV).
+	 * \return The resampled grid.
+	 */
+	EnergyGrid loadEnergyGrid(const std::string& relativePath, double massMeV) const;
+
+	/**
+	 * \brief Resamples one calibration table onto a log-energy grid.
+	 *
+	 * Table rows whose energy does not increase are skipped with a warning.
 	 *
-	 * Keys are particle ids. Only ids supported by the calibration tables are expected
-	 * to be present.
+	 * \param energies Table energies (MeV), in file order.
+	 * \param values Table values matching \p energies.
+	 * \param massMeV Particle rest mass (MeV).
+	 * \param source Table file name, used in diagnostics.
+	 * \return The resampled grid.
 	 */
-	std::map<int, double> pMassMeV;
+	EnergyGrid makeEnergyGrid(const std::vector<double>& energies, const std::vector<double>& values, double massMeV,
+	                          const std::string& source) const;
 
 	/**
-	 * \brief Interpolates the NIEL factor for a given particle at a specified energy.
+	 * \brief Interpolates a resampled table at a specified kinetic energy.
 	 *
 	 * The routine clamps outside the table domain:
-	 * - for energies below the first grid point, returns the first factor
-	 * - for energies above the last grid point, returns the last factor
+	 * - for energies below the first grid point, returns the first value
+	 * - for energies above the last grid point, returns the last value
 	 *
-	 * \param pid Particle id key into the calibration tables.
-	 * \param energyMeV Effective energy in MeV (typically stepEnergy - restMass).
-	 * \return Interpolated (or clamped) NIEL factor.
+	 * \param grid Resampled grid of the particle.
+	 * \param energyMeV Kinetic energy in MeV (typically stepEnergy - restMass).
+	 * \return Interpolated (or clamped) value.
 	 */
-	double getNielFactorForParticleAtEnergy(int pid, double energyMeV);
+	static double valueAtEnergy(const EnergyGrid& grid, double energyMeV);
 };
@@ -8,6 +8,9 @@ bool GFluxDigitization::defineReadoutSpecsImpl() {
 
 	readoutSpecs = std::make_shared<GReadoutSpecs>(timeWindow, gridStartTime, maxStep, log);
 
+	// Tracks to kill once scored, from the score_and_kill option.
+	scoreAndKill.load(gopts, log, scoreAndKillName());
+
 	return true;
 }
 
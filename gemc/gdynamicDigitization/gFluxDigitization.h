@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gemc/gdynamicDigitization/gdynamicdigitization.h> // Base class for dynamic digitization.
+#include "gscoreAndKill.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -21,6 +22,8 @@
  * - particle id ("pid")
  * - total energy ("totalE")
  *
+ * Tracks can be killed once scored, see GScoreAndKill and the \c score_and_kill option.
+ *
  * \note
  * The exact naming and presence of variables must match what downstream consumers
  * expect (e.g. converters, output writers, or analysis).
@@ -53,4 +56,22 @@ public:
 	 * \return A newly allocated digitized record for this hit.
 	 */
 	std::unique_ptr<GDigitizedData> digitizeHitImpl(GHit* ghit, size_t hitn) override;
+
+	/**
+	 * \brief Kills the scored track when a \c score_and_kill entry matches its volume and particle.
+	 *
+	 * \param thisStep Step just recorded by the sensitive detector.
+	 * \return true when the track must stop.
+	 */
+	[[nodiscard]] bool shouldStopTrackAfterHitImpl(const G4Step* thisStep) const override {
+		return scoreAndKill.kills(thisStep);
+	}
+
+protected:
+	/// Routine name matched by routine-wide \c score_and_kill entries.
+	[[nodiscard]] virtual std::string scoreAndKillName() const { return gtouchable::FLUXNAME; }
+
+private:
+	/// Score-and-kill policy, read in defineReadoutSpecsImpl().
+	GScoreAndKill scoreAndKill;
 };
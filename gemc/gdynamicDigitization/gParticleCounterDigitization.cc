@@ -8,6 +8,9 @@ bool GParticleCounterDigitization::defineReadoutSpecsImpl() {
 
 	readoutSpecs = std::make_shared<GReadoutSpecs>(timeWindow, gridStartTime, maxStep, log);
 
+	// Tracks to kill once scored, from the score_and_kill option.
+	scoreAndKill.load(gopts, log, gtouchable::COUNTERNAME);
+
 	return true;
 }
 
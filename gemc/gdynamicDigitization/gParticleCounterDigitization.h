@@ -1,6 +1,7 @@
 #pragma once
 
 #include <gemc/gdynamicDigitization/gdynamicdigitization.h> // Base class for dynamic digitization.
+#include "gscoreAndKill.h"
 #include <map>
 #include <vector>
 #include <string>
@@ -12,6 +13,8 @@
  * Similar to GFluxDigitization, but typically used for detectors whose main purpose is
  * to count/flag particle passage rather than model electronics shaping.
  *
+ * Tracks can be killed once counted, see GScoreAndKill and the \c score_and_kill option.
+ *
  * \note
  * This routine uses a different hit bitset compared to flux/dosimeter routines.
  * The bitset controls which true-hit information is computed/available at the hit level.
@@ -39,4 +42,18 @@ public:
 	 * \return A newly allocated digitized record for this hit.
 	 */
 	std::unique_ptr<GDigitizedData> digitizeHitImpl(GHit* ghit, size_t hitn) override;
+
+	/**
+	 * \brief Kills the scored track when a \c score_and_kill entry matches its volume and particle.
+	 *
+	 * \param thisStep Step just recorded by the sensitive detector.
+	 * \return true when the track must stop.
+	 */
+	[[nodiscard]] bool shouldStopTrackAfterHitImpl(const G4Step* thisStep) const override {
+		return scoreAndKill.kills(thisStep);
+	}
+
+private:
+	/// Score-and-kill policy, read in defineReadoutSpecsImpl().
+	GScoreAndKill scoreAndKill;
 };
@@ -4,6 +4,13 @@
 #include "G4OpticalPhoton.hh"
 #include "G4Step.hh"
 
+void GPhotonDetectorDigitization::definePreHitFilterImpl(GPreHitFilter& filter) {
+	// Optical photons rarely deposit energy: zero-energy steps are the signal here.
+	filter.skipZeroEdep = false;
+	filter.allowedPDG   = {G4OpticalPhoton::OpticalPhotonDefinition()->GetPDGEncoding()};
+}
+
+// Kept for sensitive detectors driven without the pre-hit filter.
 bool GPhotonDetectorDigitization::decisionToSkipHit(double energy, const G4Step* thisStep) {
 	if (thisStep == nullptr || thisStep->GetTrack() == nullptr) {
 		return true;
@@ -9,6 +9,10 @@
  * This routine records the same output fields as \c flux, but accepts only Geant4
  * optical-photon steps. Optical photons are recorded even when they deposit zero
  * energy, independent of the global \c recordZeroEdep switch.
+ *
+ * Non-photon steps are rejected by the pre-hit filter before any touchable or hit work, and hits use
+ * \c GHitStorage::photonCounting: each photon keeps its first step plus running sums,
+ * which is all the flux output and the true information read.
  */
 class GPhotonDetectorDigitization : public GFluxDigitization
 {
@@ -28,4 +32,18 @@ public:
 	 * \return true when the step should be skipped.
 	 */
 	bool decisionToSkipHit(double energy, const G4Step* thisStep) override;
+
+	/**
+	 * \brief Accepts only optical photons, including zero-energy steps.
+	 *
+	 * \param filter Filter to fill.
+	 */
+	void definePreHitFilterImpl(GPreHitFilter& filter) override;
+
+	/// Photon hits only need first-step identity and aggregated quantities.
+	[[nodiscard]] GHitStorage hit_storage() const override { return GHitStorage::photonCounting; }
+
+protected:
+	/// Routine-wide \c score_and_kill entries name this routine, not \c flux.
+	[[nodiscard]] std::string scoreAndKillName() const override { return gtouchable::GPHOTON_DETECTORNAME; }
 };
@@ -17,11 +17,11 @@
 #include "gtranslationTableConventions.h"
 #include "gdataConventions.h"
 #include "gtouchableConventions.h"
-#include "gutsConventions.h"
 #include "gutilities.h"
 
 // c++
 #include <algorithm>
+#include <atomic>
 
 namespace {
 
@@ -39,35 +39,124 @@ bool system_in_rejection_list(const std::shared_ptr<GOptions>& gopts, const std:
 	return false;
 }
 
+// Last context returned on this thread: consecutive hooks of the same routine skip the lookup.
+struct ThreadContextCacheEntry {
+	std::uint64_t               instanceId = 0;
+	GDigitizationThreadContext* context    = nullptr;
+};
+thread_local ThreadContextCacheEntry lastThreadContext;
+
+// Context slot of this thread: set by bindThreadContextSlot(), or allocated on first use with the
+// top bit set so it never matches a helper slot. Zero means not assigned yet.
+thread_local std::uint64_t currentContextSlot = 0;
+
+std::uint64_t current_context_slot() {
+	if (currentContextSlot == 0) {
+		static std::atomic<std::uint64_t> counter{0};
+		currentContextSlot = (std::uint64_t{1} << 63) | ++counter;
+	}
+	return currentContextSlot;
+}
+
+// Contexts already resolved on this thread for its current slot, keyed by instance id. Ids are never reused, so entries
+// left behind by a destroyed instance are never matched again.
+thread_local std::unordered_map<std::uint64_t, GDigitizationThreadContext*> threadContextCache;
+
+// Track records built during the collectHitsTrueInformationImpl() call running on this thread,
+// keyed by track id; null outside such a call. Scoped to one batch, so track ids reused by the
+// next event never match.
+using TrackRecordCache = std::unordered_map<int, std::shared_ptr<const GTrueInfoData>>;
+thread_local TrackRecordCache* activeTrackRecords = nullptr;
+
 } // namespace
 
+// See header for API docs.
+std::uint64_t GDynamicDigitization::nextInstanceId() {
+	static std::atomic<std::uint64_t> counter{0};
+	return ++counter;
+}
+
+// See header for API docs.
+void GDynamicDigitization::bindThreadContextSlot(std::uint64_t slot) {
+	currentContextSlot = slot;
+	threadContextCache.clear();
+	lastThreadContext = {};
+}
+
+// See header for API docs.
+std::uint64_t GDynamicDigitization::helperContextSlot(int workerThread, std::size_t helper) {
+	return (static_cast<std::uint64_t>(workerThread + 1) << 32) | static_cast<std::uint64_t>(helper + 1);
+}
+
+// See header for API docs.
+GDigitizationThreadContext& GDynamicDigitization::threadContextBase() {
+	if (lastThreadContext.instanceId == instanceId) { return *lastThreadContext.context; }
+
+	auto cached = threadContextCache.find(instanceId);
+	if (cached == threadContextCache.end()) {
+		const std::uint64_t         slot = current_context_slot();
+		GDigitizationThreadContext* raw  = nullptr;
+		{
+			std::lock_guard<std::mutex> lock(threadContextsMutex);
+			if (auto owned = threadContexts.find(slot); owned != threadContexts.end()) { raw = owned->second.get(); }
+		}
+		if (raw == nullptr) {
+			// First use of the slot: create outside the lock, then hand ownership to the instance so
+			// the context is destroyed with the plugin and never outlives its shared library. Only
+			// this thread uses the slot, so nobody else can have created it meanwhile.
+			auto context = makeThreadContextImpl();
+			raw          = context.get();
+			std::lock_guard<std::mutex> lock(threadContextsMutex);
+			threadContexts[slot] = std::move(context);
+		}
+		cached = threadContextCache.emplace(instanceId, raw).first;
+	}
+
+	lastThreadContext = {instanceId, cached->second};
+	return *cached->second;
+}
+
+
+// See header for API docs.
+void GDynamicDigitization::digitizeHitsImpl(const std::vector<GHit*>& hits, size_t firstHitn,
+                                            std::vector<std::unique_ptr<GDigitizedData>>& digitized) {
+	// Per-hit adapter: plugins without a collection-level implementation keep working unchanged.
+	for (size_t i = 0; i < hits.size(); ++i) {
+		if (hits[i] != nullptr) { digitized[i] = digitizeHitImpl(hits[i], firstHitn + i); }
+	}
+}
+
+// See header for API docs.
+void GDynamicDigitization::collectHitsTrueInformationImpl(const std::vector<GHit*>& hits,
+                                                          const std::vector<size_t>& hitns,
+                                                          std::vector<std::unique_ptr<GTrueInfoData>>& trueInfo) {
+	// Per-hit calls made below reuse the track records built for earlier hits of the batch.
+	TrackRecordCache  batchTrackRecords;
+	TrackRecordCache* outerTrackRecords = activeTrackRecords;
+	activeTrackRecords                  = &batchTrackRecords;
+	for (size_t i = 0; i < hits.size(); ++i) { trueInfo[i] = collectTrueInformationImpl(hits[i], hitns[i]); }
+	activeTrackRecords = outerTrackRecords;
+}
+
+// See header for API docs.
+void GDynamicDigitization::apply_rejection_policies_impl(const std::vector<GHit*>& hits,
+                                                         std::vector<std::unique_ptr<GDigitizedData>>& digitized) {
+	for (size_t i = 0; i < hits.size(); ++i) {
+		if (digitized[i] == nullptr) { continue; }
+		const bool skip_threshold  = apply_thresholds(hits[i], digitized[i].get());
+		const bool skip_efficiency = apply_efficiency(hits[i], digitized[i].get());
+		if (skip_threshold || skip_efficiency) { digitized[i].reset(); }
+	}
+}
 
 // See header for API docs.
 std::unique_ptr<GTrueInfoData> GDynamicDigitization::collectTrueInformationImpl(GHit* ghit, size_t hitn) {
 	auto trueInfoData = std::make_unique<GTrueInfoData>(gopts, ghit);
 
-	std::vector<GIdentifier> identities = ghit->getGID();
-
 	// Average positions are computed at the hit level by GHit and returned here.
 	G4ThreeVector avgGlobalPos = ghit->getAvgGlobalPosition();
 	G4ThreeVector avgLocalPos  = ghit->getAvgLocalPosition();
-	G4ThreeVector trackVertex = ghit->getTrackVertexPosition();
-	const auto&   motherInfo = ghit->getMotherInfo();
-	const auto    missingMotherVertex = G4ThreeVector(
-		MISSING_TRUE_INFORMATION_NUMBER,
-		MISSING_TRUE_INFORMATION_NUMBER,
-		MISSING_TRUE_INFORMATION_NUMBER);
-	const G4ThreeVector motherTrackVertex = motherInfo.vertex.value_or(missingMotherVertex);
 
-	trueInfoData->includeVariable("pid", ghit->getPid());
-	trueInfoData->includeVariable("mpid", motherInfo.pid.value_or(MISSING_TRUE_INFORMATION_NUMBER));
-	trueInfoData->includeVariable("tid", ghit->getTid());
-	trueInfoData->includeVariable("otid", 0);
-	trueInfoData->includeVariable("opid", 0);
-	trueInfoData->includeVariable("opx", 0.0);
-	trueInfoData->includeVariable("opy", 0.0);
-	trueInfoData->includeVariable("opz", 0.0);
-	trueInfoData->includeVariable("mtid", motherInfo.trackId);
 	trueInfoData->includeVariable("totalEDeposited", ghit->getTotalEnergyDeposited());
 	trueInfoData->includeVariable("trackE", ghit->getTrackE());
 	trueInfoData->includeVariable("avgTime", ghit->getAverageTime());
@@ -77,29 +166,64 @@ std::unique_ptr<GTrueInfoData> GDynamicDigitization::collectTrueInformationImpl(
 	trueInfoData->includeVariable("avglx", avgLocalPos.getX());
 	trueInfoData->includeVariable("avgly", avgLocalPos.getY());
 	trueInfoData->includeVariable("avglz", avgLocalPos.getZ());
-	trueInfoData->includeVariable("vx", trackVertex.getX());
-	trueInfoData->includeVariable("vy", trackVertex.getY());
-	trueInfoData->includeVariable("vz", trackVertex.getZ());
-	trueInfoData->includeVariable("mvx", motherTrackVertex.getX());
-	trueInfoData->includeVariable("mvy", motherTrackVertex.getY());
-	trueInfoData->includeVariable("mvz", motherTrackVertex.getZ());
 
 	G4ThreeVector momentum = ghit->getMomentum();
 	trueInfoData->includeVariable("px", momentum.getX());
 	trueInfoData->includeVariable("py", momentum.getY());
 	trueInfoData->includeVariable("pz", momentum.getZ());
 
-	trueInfoData->includeVariable("nsteps", static_cast<int>(ghit->getStepCount()));
+	trueInfoData->includeVariable("nsteps", static_cast<int>(ghit->aggregatedSteps()));
 	trueInfoData->includeVariable("nphotons", static_cast<int>(ghit->getNumberOfOpticalPhotons()));
 	trueInfoData->includeVariable("hitn", static_cast<int>(hitn)); // assume hitn < INT_MAX
 
-	const std::string processName = ghit->getProcessName().value_or(guts::SERIALIZED_NULL_TOKEN);
-	trueInfoData->includeVariable("processName", processName);
-	trueInfoData->includeVariable("procID", processName);
+	// Original-track variables, set by the event action with save_original_track. They belong to
+	// the hit only, so the track record cannot publish a second, conflicting value.
+	trueInfoData->includeVariable("otid", 0);
+	trueInfoData->includeVariable("opid", 0);
+	trueInfoData->includeVariable("opx", 0.0);
+	trueInfoData->includeVariable("opy", 0.0);
+	trueInfoData->includeVariable("opz", 0.0);
+
+	// Track-level quantities are shared by every hit of the track: build them once per batch.
+	if (activeTrackRecords == nullptr) { trueInfoData->setTrackInfo(collectTrackTrueInformationImpl(ghit)); }
+	else {
+		auto& trackRecord = (*activeTrackRecords)[ghit->getTid()];
+		if (!trackRecord) { trackRecord = collectTrackTrueInformationImpl(ghit); }
+		trueInfoData->setTrackInfo(trackRecord);
+	}
 
 	return trueInfoData;
 }
 
+// See header for API docs.
+std::shared_ptr<const GTrueInfoData> GDynamicDigitization::collectTrackTrueInformationImpl(GHit* ghit) {
+	auto trackData = std::make_shared<GTrueInfoData>(gopts, std::vector<GIdentifier>{});
+
+	G4ThreeVector trackVertex         = ghit->getTrackVertexPosition();
+	const auto&   motherInfo          = ghit->getMotherInfo();
+	const auto    missingMotherVertex = G4ThreeVector(
+		MISSING_TRUE_INFORMATION_NUMBER,
+		MISSING_TRUE_INFORMATION_NUMBER,
+		MISSING_TRUE_INFORMATION_NUMBER);
+	const G4ThreeVector motherTrackVertex = motherInfo.vertex.value_or(missingMotherVertex);
+
+	trackData->includeVariable("pid", ghit->getPid());
+	trackData->includeVariable("mpid", motherInfo.pid.value_or(MISSING_TRUE_INFORMATION_NUMBER));
+	trackData->includeVariable("tid", ghit->getTid());
+	trackData->includeVariable("mtid", motherInfo.trackId);
+	trackData->includeVariable("vx", trackVertex.getX());
+	trackData->includeVariable("vy", trackVertex.getY());
+	trackData->includeVariable("vz", trackVertex.getZ());
+	trackData->includeVariable("mvx", motherTrackVertex.getX());
+	trackData->includeVariable("mvy", motherTrackVertex.getY());
+	trackData->includeVariable("mvz", motherTrackVertex.getZ());
+
+	// Process names are written once per output file in the process name table.
+	trackData->includeVariable("procID", ghit->getProcessId());
+
+	return trackData;
+}
+
 // See header for API docs.
 void GDynamicDigitization::chargeAndTimeAtHardware(int time, int q, const GHit* ghit, GDigitizedData& gdata) {
 	check_if_log_defined();
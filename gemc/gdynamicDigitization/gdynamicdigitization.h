@@ -1,6 +1,7 @@
 #pragma once
 
 #include "greadoutSpecs.h"
+#include "gpreHitFilter.h"
 #include <gemc/gfactory/gfactory_options.h>
 
 // gemc
@@ -19,6 +20,11 @@
 #include <map>
 #include <string>
 #include <optional>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <unordered_map>
 
 // geant4
 #include "G4Step.hh"
@@ -154,6 +160,23 @@ inline constexpr const char *to_string(CollectionMode mode) {
     return "unknown";
 }
 
+/**
+ * \class GDigitizationThreadContext
+ * \brief Base class of the per-thread scratch state of a digitization plugin.
+ *
+ * One plugin instance is shared by all worker threads, so members written while digitizing
+ * race between events. Plugins that need mutable state (scratch buffers, random engines,
+ * caches, accumulators) derive from this class, return it from
+ * \ref GDynamicDigitization::makeThreadContextImpl "makeThreadContextImpl()", and reach the
+ * calling thread's instance from any hook through
+ * \ref GDynamicDigitization::threadContext "threadContext<T>()".
+ */
+class GDigitizationThreadContext {
+public:
+    /// Virtual destructor: contexts are owned and destroyed through the base class.
+    virtual ~GDigitizationThreadContext() = default;
+};
+
 /**
  * \class GDynamicDigitization
  * \brief Abstract base class for dynamically loaded digitization plugins.
@@ -169,6 +192,18 @@ inline constexpr const char *to_string(CollectionMode mode) {
  * - \ref GDynamicDigitization::loadConstants "loadConstants()"
  * - \ref GDynamicDigitization::loadTT "loadTT()"
  *
+ * The event action digitizes one detector collection at a time through the collection-level entry
+ * points \ref GDynamicDigitization::digitizeHits "digitizeHits()",
+ * \ref GDynamicDigitization::apply_rejection_policies "apply_rejection_policies()", and
+ * \ref GDynamicDigitization::collectHitsTrueInformation "collectHitsTrueInformation()". Their default
+ * implementations loop over the per-hit hooks, so existing plugins work unchanged; plugins that
+ * override the collection-level hooks can amortize translation-table lookups, constant fetches,
+ * and random-number setup over all the hits of a collection.
+ *
+ * The same instance serves every worker thread. Mutable per-thread state belongs in a
+ * \ref GDigitizationThreadContext created lazily for each thread, see
+ * \ref GDynamicDigitization::threadContext "threadContext<T>()".
+ *
  */
 class GDynamicDigitization : public GBase<GDynamicDigitization> {
 public:
@@ -177,7 +212,8 @@ public:
      *
      * \param g Options used by this plugin instance.
      */
-    explicit GDynamicDigitization(const std::shared_ptr<GOptions> &g) : GBase(g, GDIGITIZATION_LOGGER) {
+    explicit GDynamicDigitization(const std::shared_ptr<GOptions> &g) : GBase(g, GDIGITIZATION_LOGGER),
+                                                                       instanceId(nextInstanceId()) {
         recordZeroEdep = g->getSwitch("recordZeroEdep");
     }
 
@@ -186,6 +222,14 @@ public:
 
     [[nodiscard]] virtual CollectionMode collection_mode() const { return CollectionMode::event; }
 
+    /**
+     * \brief Per-step storage policy of the hits created for this routine.
+     *
+     * Routines that only read first-step identity and the aggregated quantities can return
+     * \c GHitStorage::photonCounting so hits do not grow with the number of steps.
+     */
+    [[nodiscard]] virtual GHitStorage hit_storage() const { return GHitStorage::full; }
+
     /**
      * \brief Computes the time associated with a simulation step for electronics binning.
      *
@@ -307,12 +351,27 @@ public:
     /**
      * \brief Implementation hook for true-information collection.
      *
+     * The default stores the hit-level quantities (energy, averages, momentum, step counts) in the
+     * record and attaches the shared track record from collectTrackTrueInformationImpl(). Within
+     * one collectHitsTrueInformation() call the track record is built once per track.
+     *
      * \param ghit Input hit.
      * \param hitn Sequential hit index.
      * \return Newly created true-information record.
      */
     [[nodiscard]] virtual std::unique_ptr<GTrueInfoData> collectTrueInformationImpl(GHit *ghit, size_t hitn);
 
+    /**
+     * \brief Implementation hook building the track-level true information of a hit.
+     *
+     * The default stores the quantities shared by all the hits of the hit's first track: pid,
+     * track and mother ids, vertices, and creator process.
+     *
+     * \param ghit Input hit; its first step identifies the track.
+     * \return Newly created track record.
+     */
+    [[nodiscard]] virtual std::shared_ptr<const GTrueInfoData> collectTrackTrueInformationImpl(GHit *ghit);
+
     /**
      * \brief Digitizes a hit into a GDigitizedData record.
      *
@@ -340,6 +399,66 @@ public:
     [[nodiscard]] virtual std::unique_ptr<GDigitizedData> digitizeHitImpl(
         [[maybe_unused]] GHit *ghit, [[maybe_unused]] size_t hitn) { return nullptr; }
 
+    /**
+     * \brief Digitizes consecutive hits of one collection into preallocated output.
+     *
+     * Wrapper that checks the configuration once for the whole batch and delegates to
+     * digitizeHitsImpl(). Entry \c i of \p digitized receives the record of \p hits[i], whose
+     * sequential hit index is \p firstHitn + \c i; null hits and rejected hits leave it empty.
+     *
+     * \param hits Hits to digitize, in collection order.
+     * \param firstHitn Sequential hit index of the first hit.
+     * \param digitized Output records, one per hit, sized by the caller.
+     */
+    void digitizeHits(const std::vector<GHit *> &hits, size_t firstHitn,
+                      std::vector<std::unique_ptr<GDigitizedData> > &digitized) {
+        check_if_log_defined();
+        log->info(2, "GDynamicDigitization::digitize ", hits.size(), " hits starting at hit number ", firstHitn);
+        digitizeHitsImpl(hits, firstHitn, digitized);
+    }
+
+    /**
+     * \brief Implementation hook for collection-level digitization.
+     *
+     * Default implementation calls digitizeHitImpl() for every non-null hit.
+     *
+     * \param hits Hits to digitize, in collection order.
+     * \param firstHitn Sequential hit index of the first hit.
+     * \param digitized Output records, one per hit, sized by the caller.
+     */
+    virtual void digitizeHitsImpl(const std::vector<GHit *> &hits, size_t firstHitn,
+                                  std::vector<std::unique_ptr<GDigitizedData> > &digitized);
+
+    /**
+     * \brief Collects the true information of a set of hits into preallocated output.
+     *
+     * Wrapper that checks the configuration once for the whole batch and delegates to
+     * collectHitsTrueInformationImpl().
+     *
+     * \param hits Hits whose true information is requested.
+     * \param hitns Output hit index of each hit.
+     * \param trueInfo Output records, one per hit, sized by the caller.
+     */
+    void collectHitsTrueInformation(const std::vector<GHit *> &hits, const std::vector<size_t> &hitns,
+                                    std::vector<std::unique_ptr<GTrueInfoData> > &trueInfo) {
+        check_if_log_defined();
+        log->info(2, "GDynamicDigitization::collect true information for ", hits.size(), " hits");
+        collectHitsTrueInformationImpl(hits, hitns, trueInfo);
+    }
+
+    /**
+     * \brief Implementation hook for collection-level true-information collection.
+     *
+     * Default implementation calls collectTrueInformationImpl() for every hit, sharing one track
+     * record between the hits of the same track.
+     *
+     * \param hits Hits whose true information is requested.
+     * \param hitns Output hit index of each hit.
+     * \param trueInfo Output records, one per hit, sized by the caller.
+     */
+    virtual void collectHitsTrueInformationImpl(const std::vector<GHit *> &hits, const std::vector<size_t> &hitns,
+                                                std::vector<std::unique_ptr<GTrueInfoData> > &trueInfo);
+
     /**
      * \brief Loads digitization constants (calibration/configuration).
      *
@@ -434,6 +553,36 @@ public:
     /// Readout specs are created during initialization and treated as immutable.
     std::shared_ptr<const GReadoutSpecs> readoutSpecs;
 
+    /**
+     * \brief Initializes the pre-hit filter.
+     *
+     * Starts from a filter that skips zero-energy steps unless \c recordZeroEdep is set, lets
+     * definePreHitFilterImpl() add the routine cuts, and stores the compiled result.
+     */
+    void definePreHitFilter() {
+        check_if_log_defined();
+        log->debug(NORMAL, "GDynamicDigitization::define pre-hit filter");
+        GPreHitFilter filter;
+        filter.skipZeroEdep = !recordZeroEdep;
+        definePreHitFilterImpl(filter);
+        filter.compile();
+        preHitFilter = std::make_shared<const GPreHitFilter>(std::move(filter));
+    }
+
+    /**
+     * \brief Implementation hook to declare the per-step cuts of this routine.
+     *
+     * Cuts declared here run in the sensitive detector before touchable resolution and before
+     * decisionToSkipHit(), so routines should prefer them to hand-written checks in the hooks.
+     * Default implementation keeps the filter unchanged.
+     *
+     * \param filter Filter to fill; preset with the zero-energy policy.
+     */
+    virtual void definePreHitFilterImpl([[maybe_unused]] GPreHitFilter &filter) {}
+
+    /// Pre-hit filter created during initialization and treated as immutable.
+    std::shared_ptr<const GPreHitFilter> preHitFilter;
+
     /// Translation table is typically loaded during initialization and treated as immutable.
     std::shared_ptr<const GTranslationTable> translationTable;
 
@@ -506,7 +655,8 @@ public:
      * \brief Plugin hook controlling post-hit track termination.
      *
      * The default keeps the track alive. Detector plugins can override this for terminal sensitive
-     * elements such as optical-photon collectors.
+     * elements such as optical-photon collectors. A stopped track loses the secondaries of the
+     * step that stopped it as well: they are dropped by the stepping action before being stacked.
      */
     [[nodiscard]] virtual bool shouldStopTrackAfterHitImpl(
         [[maybe_unused]] const G4Step* thisStep) const {
@@ -625,7 +775,98 @@ public:
      */
     [[nodiscard]] virtual bool efficiencies_are_intrinsic_impl() const { return false; }
 
+    /**
+     * \brief Applies the threshold and efficiency policies to the digitized records of a batch.
+     *
+     * Called by the event action after digitizeHits(). Rejected records are reset, so their hits
+     * count as not digitized. When neither policy is active for this system the call returns
+     * without visiting the hits.
+     *
+     * \param hits Hits of the batch, in collection order.
+     * \param digitized Records produced by digitizeHits() for \p hits.
+     */
+    void apply_rejection_policies(const std::vector<GHit *> &hits,
+                                  std::vector<std::unique_ptr<GDigitizedData> > &digitized) {
+        const bool thresholds   = applyThresholds_ || thresholds_are_intrinsic_impl();
+        const bool efficiencies = applyInefficiencies_ || efficiencies_are_intrinsic_impl();
+        if (!thresholds && !efficiencies) { return; }
+        apply_rejection_policies_impl(hits, digitized);
+    }
+
+    /**
+     * \brief Plugin hook for collection-level rejection.
+     *
+     * Default implementation evaluates apply_thresholds() and apply_efficiency() on every record,
+     * both of them even when the first rejects, so the random-number sequence does not depend on
+     * the threshold outcome.
+     *
+     * \param hits Hits of the batch, in collection order.
+     * \param digitized Records produced by digitizeHits() for \p hits; rejected ones are reset.
+     */
+    virtual void apply_rejection_policies_impl(const std::vector<GHit *> &hits,
+                                               std::vector<std::unique_ptr<GDigitizedData> > &digitized);
+
+    /**
+     * \brief Returns the calling thread's context of this plugin instance.
+     *
+     * Contexts are stored per context slot rather than per thread id. A thread uses the slot it
+     * bound with bindThreadContextSlot(), or a private slot allocated on its first call. The
+     * context of a slot is created by makeThreadContextImpl() on first use and lives as long as
+     * the plugin instance. A slot is used by one thread at a time, so hooks can modify the context
+     * without locking. \p T must be the type returned by makeThreadContextImpl().
+     *
+     * \tparam T Concrete context type of this plugin.
+     * \return The calling thread's context.
+     */
+    template <typename T>
+    [[nodiscard]] T &threadContext() { return static_cast<T &>(threadContextBase()); }
+
+    /**
+     * \brief Plugin hook creating the per-thread context.
+     *
+     * Called at most once per thread, from the thread that will use the context. The default
+     * returns an empty context for plugins with no mutable state.
+     *
+     * \return A new context for the calling thread.
+     */
+    [[nodiscard]] virtual std::unique_ptr<GDigitizationThreadContext> makeThreadContextImpl() const {
+        return std::make_unique<GDigitizationThreadContext>();
+    }
+
+    /**
+     * \brief Binds the calling thread to a context slot.
+     *
+     * Pooled helper threads bind a stable slot when they start, so the contexts they create are
+     * found again by the helper that replaces them and never collide with a reused thread id.
+     * Must not be called while the thread is inside a digitization hook.
+     *
+     * \param slot Slot identifier, typically from helperContextSlot(); must not be zero.
+     */
+    static void bindThreadContextSlot(std::uint64_t slot);
+
+    /**
+     * \brief Returns the context slot of a digitization helper thread.
+     *
+     * \param workerThread Geant4 thread id of the worker owning the helper (-1 for the master).
+     * \param helper Index of the helper within the worker's pool.
+     * \return A slot unique to the (worker, helper) pair, disjoint from automatically allocated ones.
+     */
+    [[nodiscard]] static std::uint64_t helperContextSlot(int workerThread, std::size_t helper);
+
 private:
+    /// Returns (creating it when needed) the calling thread's context.
+    GDigitizationThreadContext &threadContextBase();
+
+    /// Returns a process-unique instance identifier, never reused after an instance is destroyed.
+    static std::uint64_t nextInstanceId();
+
+    /// Key of this instance in the per-thread context caches.
+    const std::uint64_t instanceId;
+
+    /// Per-slot contexts owned by this instance; the mutex guards lookup and creation only.
+    std::mutex threadContextsMutex;
+    std::unordered_map<std::uint64_t, std::unique_ptr<GDigitizationThreadContext> > threadContexts;
+
     /// When false, hits with exactly zero deposited energy may be skipped.
     bool recordZeroEdep = false;
 
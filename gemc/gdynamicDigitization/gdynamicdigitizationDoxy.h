@@ -19,12 +19,28 @@
  * - optionally collecting a standardized “true information” payload via
  *   \ref GDynamicDigitization::collectTrueInformation "collectTrueInformation()"
  *
+ * The event action calls the collection-level entry points
+ * \ref GDynamicDigitization::digitizeHits "digitizeHits()" and
+ * \ref GDynamicDigitization::collectHitsTrueInformation "collectHitsTrueInformation()" once per
+ * detector collection. Their default implementations adapt to the per-hit hooks above; a plugin
+ * overrides \c digitizeHitsImpl() to share per-collection setup across all its hits.
+ *
+ * One plugin instance serves every worker thread, so hooks must not write plugin members.
+ * Mutable state (scratch buffers, random engines, caches, accumulators) goes in a
+ * GDigitizationThreadContext subclass returned by \c makeThreadContextImpl(); any hook reaches
+ * the calling thread's instance with \c threadContext<T>(), created on first use per thread.
+ *
  * \image html digitization-workflow.svg "Sensitive-detector and digitization data flow" width=900px
  *
  * \section gdynamicdigitization_components Key components
  * - GDynamicDigitization : Abstract base class defining the plugin surface.
+ * - GDigitizationThreadContext : Base class of the per-thread mutable state of a plugin.
  * - GTouchableModifiers : Helper container used when a digitizer needs to compute
  *   weighted/weighted-time modifiers for touchables.
+ * - GPreHitFilter : Declarative per-step cuts (PDG lists, energy, time, charge) evaluated by the
+ *   sensitive detector before any touchable or hit work.
+ * - GScoreAndKill : Score-and-kill policy of the flux and particle counter routines, read from the
+ *   \c score_and_kill option.
  * - GReadoutSpecs : Small immutable specification used to compute electronics time bin indices.
  *
  * \section gdynamicdigitization_options Configuration
@@ -45,6 +45,19 @@ GOptions defineOptions() {
 	    "per-channel efficiency. Use \"all\" for every system. Default: not set.\n \n"
 	    "Example: -applyInefficiencies=\"ftof\"");
 
+	// Score-and-kill: tracks scored by the listed flux / particle counter detectors are killed,
+	// with the secondaries of the scoring step. Default: not set (every track continues).
+	std::vector<GVariable> score_and_kill = {
+		{"detector", goptions::REQUIRED,
+		 "routine name (flux, particle_counter, gPhotonDetector) for all its volumes, or a volume name"},
+		{"pids", "all", "PDG codes killed after scoring, comma-separated, or \"all\""}
+	};
+	std::string help = "Kills the tracks recorded by flux and particle counter detectors, so particles crossing\n";
+	help += "a scoring surface are not tracked through the rest of the world. A detector equal to the\n";
+	help += "routine name applies to all its volumes; any other name selects a single volume.\n \n";
+	help += R"RAWS(Example: -score_and_kill="[{detector: flux}, {detector: beamdump_plane, pids: '2112, 22'}]")RAWS";
+	goptions.defineOption("score_and_kill", "kill tracks after they are scored", score_and_kill, help);
+
 	// Aggregate options required by downstream types used in the digitization workflow.
 	goptions += gevent_data::defineOptions();
 	goptions += grun_data::defineOptions();
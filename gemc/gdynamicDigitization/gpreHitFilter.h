@@ -0,0 +1,108 @@
+#pragma once
+
+/**
+ * \file gpreHitFilter.h
+ * \brief Declarative step filter evaluated before touchable resolution and hit creation.
+ *
+ * GPreHitFilter collects the cuts most digitization routines apply to every step (particle
+ * type, deposited energy, time window, charge) as plain fields. Routines declare them once in
+ * \ref GDynamicDigitization::definePreHitFilterImpl "definePreHitFilterImpl()"; the sensitive
+ * detector keeps its own copy and evaluates it first thing in \c ProcessHits(), so a rejected
+ * step costs a few comparisons and never reaches the plugin hooks.
+ *
+ * \note
+ * This header intentionally does not declare a \c \\mainpage. Module-level documentation
+ * for gdynamic digitization lives in gdynamicdigitizationDoxy.h.
+ */
+
+// c++
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+// geant4
+#include "G4Step.hh"
+#include "G4Track.hh"
+#include "G4ParticleDefinition.hh"
+
+/**
+ * \class GPreHitFilter
+ * \brief Per-step rejection cuts declared by a digitization routine.
+ *
+ * The default-constructed filter accepts every step. Cuts are evaluated cheapest first:
+ * deposited energy, then particle type and charge, then time.
+ */
+class GPreHitFilter
+{
+public:
+	/// Rejects steps that deposit exactly zero energy.
+	bool skipZeroEdep = false;
+
+	/// Rejects steps depositing less than this energy (Geant4 internal units).
+	double minEdep = 0;
+
+	/// Rejects steps whose post-step global time is before this value.
+	double minTime = -std::numeric_limits<double>::infinity();
+
+	/// Rejects steps whose post-step global time is after this value.
+	double maxTime = std::numeric_limits<double>::infinity();
+
+	/// Rejects steps of particles with zero charge.
+	bool rejectNeutral = false;
+
+	/// When not empty, only these PDG codes are accepted.
+	std::vector<int> allowedPDG;
+
+	/// PDG codes always rejected.
+	std::vector<int> deniedPDG;
+
+	/**
+	 * \brief Sorts and deduplicates the PDG lists and caches which cuts are active.
+	 *
+	 * Called once when the filter is stored; fields modified afterwards require another call.
+	 */
+	void compile() {
+		for (auto* list : {&allowedPDG, &deniedPDG}) {
+			std::sort(list->begin(), list->end());
+			list->erase(std::unique(list->begin(), list->end()), list->end());
+		}
+		checksParticle = rejectNeutral || !allowedPDG.empty() || !deniedPDG.empty();
+		checksTime     = minTime > -std::numeric_limits<double>::infinity() ||
+		                 maxTime < std::numeric_limits<double>::infinity();
+	}
+
+	/**
+	 * \brief Returns true if the step must be discarded before any hit processing.
+	 *
+	 * \param edep Total energy deposited by the step.
+	 * \param thisStep Geant4 step being processed.
+	 * \return true if one of the cuts rejects the step.
+	 */
+	[[nodiscard]] bool rejects(double edep, const G4Step* thisStep) const {
+		if (skipZeroEdep && edep == 0) { return true; }
+		if (edep < minEdep) { return true; }
+
+		if (checksParticle) {
+			const auto* particle = thisStep->GetTrack()->GetDefinition();
+			if (rejectNeutral && particle->GetPDGCharge() == 0) { return true; }
+
+			const int pdg = particle->GetPDGEncoding();
+			if (!allowedPDG.empty() && !std::binary_search(allowedPDG.begin(), allowedPDG.end(), pdg)) { return true; }
+			if (std::binary_search(deniedPDG.begin(), deniedPDG.end(), pdg)) { return true; }
+		}
+
+		if (checksTime) {
+			const double time = thisStep->GetPostStepPoint()->GetGlobalTime();
+			if (time < minTime || time > maxTime) { return true; }
+		}
+
+		return false;
+	}
+
+private:
+	/// Set by compile(): at least one particle cut is active.
+	bool checksParticle = false;
+
+	/// Set by compile(): the time window is bounded.
+	bool checksTime = false;
+};
@@ -15,7 +15,9 @@
 
 #include <gemc/glogging/glogger.h>
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <type_traits>
 
 /**
@@ -41,6 +43,13 @@ private:
 	/// Maximum step length for the associated logical volume.
 	double maxStep;
 
+	/// Reciprocal of timeWindow, precomputed so per-step binning multiplies instead of dividing.
+	double invTimeWindow;
+
+	/// Relative width of the band around a cell boundary where the product may round differently
+	/// from the quotient: a few ulps cover the rounding of both the reciprocal and the product.
+	static constexpr double BOUNDARY_TOLERANCE = 8 * std::numeric_limits<double>::epsilon();
+
 public:
 	/**
 	 * \brief Constructs a GReadoutSpecs object.
@@ -58,12 +67,19 @@ public:
 				  const std::shared_ptr<GLogger>& log) :
 		timeWindow(tw),
 		gridStartTime(gst),
-		maxStep(ms) {
+		maxStep(ms),
+		invTimeWindow(1.0 / tw) {
 		log->info(1, "GReadoutSpecs: timeWindow=", timeWindow, ", gridStartTime=", gridStartTime);
 	}
 
 	[[nodiscard]] inline double getMaxStep() const { return maxStep; }
 
+	/// \brief Width of one electronics time cell, also the length of a streaming-readout frame.
+	[[nodiscard]] inline double getTimeWindow() const { return timeWindow; }
+
+	/// \brief Origin of the electronics time grid.
+	[[nodiscard]] inline double getGridStartTime() const { return gridStartTime; }
+
 	/**
 	 * \brief Computes the 1-based electronics time-cell index for a given time.
 	 *
@@ -76,11 +92,24 @@ public:
 	 * - split GTouchables when a hit spans multiple electronics time bins
 	 * - label digitized hits by an electronics "frame" index
 	 *
+	 * The quotient is evaluated as a product with the precomputed reciprocal. The division is
+	 * evaluated only when the product falls within a few ulps of a cell boundary, where it could
+	 * round to the other side, so the index is identical to the one of the formula above.
+	 *
 	 * \param time Time value to bin (time unit follows project conventions; commonly ns).
 	 * \return 1-based time-cell index as an integer.
 	 */
 	[[nodiscard]] inline int timeCellIndex(double time) const {
-		return static_cast<int>(std::floor(( time - gridStartTime ) / timeWindow) + 1);
+		const double delta = time - gridStartTime;
+		const double cells = delta * invTimeWindow;
+		const double cell  = std::floor(cells);
+
+		// Near a boundary the product may round to the other cell: fall back to the quotient.
+		const double toBoundary = std::min(cells - cell, cell + 1 - cells);
+		if (toBoundary <= BOUNDARY_TOLERANCE * std::abs(cells)) {
+			return static_cast<int>(std::floor(delta / timeWindow) + 1);
+		}
+		return static_cast<int>(cell + 1);
 	}
 };
 
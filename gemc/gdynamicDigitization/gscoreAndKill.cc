@@ -0,0 +1,99 @@
+// See header for API docs.
+
+#include "gscoreAndKill.h"
+#include "gdynamicdigitizationConventions.h"
+
+// gemc
+#include "gutilities.h"
+#include "gtouchableConventions.h"
+
+// c++
+#include <algorithm>
+
+// geant4
+#include "G4VPhysicalVolume.hh"
+
+thread_local const G4Track* GScoreAndKill::stopped_track = nullptr;
+thread_local int            GScoreAndKill::stopped_step  = 0;
+
+namespace {
+
+// Routine names accepted by routine-wide entries.
+const std::string BUILTIN_ROUTINES[] = {gtouchable::FLUXNAME, gtouchable::GPHOTON_DETECTORNAME,
+                                        gtouchable::COUNTERNAME};
+
+} // namespace
+
+bool GScoreAndKill::Target::matches(int pid) const {
+	if (!active) { return false; }
+	return allPids || std::binary_search(pids.begin(), pids.end(), pid);
+}
+
+void GScoreAndKill::load(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log,
+                         const std::string& digitizationName) {
+	routineTarget = Target();
+	volumeTargets.clear();
+
+	for (const auto& entry : gopts->getOptionNode("score_and_kill")) {
+		const auto detector = gopts->get_required_variable_in_option<std::string>(entry, "detector");
+		auto       pidList  = gopts->get_variable_in_option<std::string>(entry, "pids", "all");
+
+		// Entries naming another built-in routine belong to that routine.
+		if (detector != digitizationName && std::find(std::begin(BUILTIN_ROUTINES), std::end(BUILTIN_ROUTINES),
+		                                              detector) != std::end(BUILTIN_ROUTINES)) {
+			continue;
+		}
+
+		// Several entries may name the same detector: their particle lists add up.
+		auto& target  = detector == digitizationName ? routineTarget : volumeTargets[detector];
+		target.active = true;
+
+		std::replace(pidList.begin(), pidList.end(), ',', ' ');
+		for (const auto& pid : gutilities::getStringVectorFromString(pidList)) {
+			if (pid == "all") {
+				target.allPids = true;
+				continue;
+			}
+			try { target.pids.push_back(std::stoi(pid)); }
+			catch (const std::exception&) {
+				log->error(ERR_SCOREANDKILLFAIL, "score_and_kill: invalid PDG code <", pid, "> for detector <",
+				           detector, ">");
+			}
+		}
+		std::sort(target.pids.begin(), target.pids.end());
+		target.pids.erase(std::unique(target.pids.begin(), target.pids.end()), target.pids.end());
+
+		log->info(1, "score_and_kill for <", digitizationName, ">: detector <", detector, ">, pids <",
+		          target.allPids ? std::string("all") : pidList, ">");
+	}
+}
+
+bool GScoreAndKill::kills(const G4Step* thisStep) const {
+	if (!isActive()) { return false; }
+
+	const int pid = thisStep->GetTrack()->GetDefinition()->GetPDGEncoding();
+	if (routineTarget.matches(pid)) { return true; }
+	if (volumeTargets.empty()) { return false; }
+
+	// Geant4 volume names are "<system>/<volume>": accept either form in the option.
+	const std::string& volumeName = thisStep->GetPreStepPoint()->GetPhysicalVolume()->GetName();
+	auto               target     = volumeTargets.find(volumeName);
+	if (target == volumeTargets.end()) {
+		const auto slash = volumeName.rfind('/');
+		if (slash == std::string::npos) { return false; }
+		target = volumeTargets.find(volumeName.substr(slash + 1));
+		if (target == volumeTargets.end()) { return false; }
+	}
+	return target->second.matches(pid);
+}
+
+void GScoreAndKill::markStoppedTrack(const G4Track* track) {
+	stopped_track = track;
+	stopped_step  = track->GetCurrentStepNumber();
+}
+
+bool GScoreAndKill::takeStoppedTrack(const G4Track* track) {
+	const bool stopped = stopped_track == track && stopped_step == track->GetCurrentStepNumber();
+	stopped_track      = nullptr;
+	return stopped;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+/**
+ * \file gscoreAndKill.h
+ * \brief Score-and-kill policy of the built-in flux and particle counter routines.
+ *
+ * \note
+ * This header intentionally does not declare a \c \\mainpage. Module-level documentation
+ * for gdynamic digitization lives in gdynamicdigitizationDoxy.h.
+ */
+
+// gemc
+#include <gemc/goptions/goptions.h>
+#include <gemc/glogging/glogger.h>
+
+// c++
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// geant4
+#include "G4Step.hh"
+#include "G4Track.hh"
+
+/**
+ * \class GScoreAndKill
+ * \brief Decides which tracks are killed once a scoring detector has recorded them.
+ *
+ * Shielding and beamline studies only need the particles crossing a scoring surface: tracking
+ * them through the rest of the world is wasted time. The \c score_and_kill option lists the
+ * detectors whose tracks stop after they are scored, each with an optional PDG list:
+ * - a detector equal to the routine name (e.g. \c flux) applies to all its volumes
+ * - any other detector is a volume name, as \c "<system>/<volume>" or just \c "<volume>"
+ *
+ * The policy is parsed once per routine and read-only afterwards, so it is shared by all threads.
+ *
+ * The sensitive detector stops a killed track with \c fStopAndKill and marks it with
+ * \ref GScoreAndKill::markStoppedTrack "markStoppedTrack()". The stepping action takes the mark and
+ * drops the secondaries of that step. Tracks stopped anywhere else keep the usual Geant4 status semantics.
+ */
+class GScoreAndKill
+{
+public:
+	/**
+	 * \brief Reads the \c score_and_kill entries that apply to a routine.
+	 *
+	 * \param gopts Options holding the \c score_and_kill entries.
+	 * \param log Logger used to report the resolved policy and parsing errors.
+	 * \param digitizationName Routine name matched by routine-wide entries.
+	 */
+	void load(const std::shared_ptr<GOptions>& gopts, const std::shared_ptr<GLogger>& log,
+	          const std::string& digitizationName);
+
+	/// \brief True when at least one entry applies to the routine.
+	[[nodiscard]] bool isActive() const { return routineTarget.active || !volumeTargets.empty(); }
+
+	/**
+	 * \brief Returns true if the track of a scored step must be killed.
+	 *
+	 * \param thisStep Step just recorded by the sensitive detector.
+	 * \return true when the step volume and particle match an entry.
+	 */
+	[[nodiscard]] bool kills(const G4Step* thisStep) const;
+
+	/**
+	 * \brief Marks the track of the current step as stopped after a hit, on this thread.
+	 *
+	 * \param track Track stopped by the sensitive detector.
+	 */
+	static void markStoppedTrack(const G4Track* track);
+
+	/**
+	 * \brief Takes the mark left by \ref markStoppedTrack "markStoppedTrack()" for this step.
+	 *
+	 * The mark is cleared in any case, so it never outlives the step that set it.
+	 *
+	 * \param track Track of the step just completed.
+	 * \return true when the sensitive detector stopped \p track in its current step.
+	 */
+	[[nodiscard]] static bool takeStoppedTrack(const G4Track* track);
+
+private:
+	/// Particles killed in one detector: all of them, or a sorted PDG list.
+	struct Target
+	{
+		bool             active  = false;
+		bool             allPids = false;
+		std::vector<int> pids;
+
+		[[nodiscard]] bool matches(int pid) const;
+	};
+
+	/// Entry naming the routine itself: applies to every volume.
+	Target routineTarget;
+
+	/// Entries naming single volumes, keyed by the name given in the option.
+	std::unordered_map<std::string, Target> volumeTargets;
+
+	/// Track stopped by the sensitive detector, and the step number it was stopped at.
+	static thread_local const G4Track* stopped_track;
+	static thread_local int            stopped_step;
+};
@@ -4,6 +4,10 @@
 // geant4
 #include "G4VProcess.hh"
 
+// c++
+#include <unordered_map>
+#include <unordered_set>
+
 // See header for API docs.
 
 void GHit::addHitInfos(const G4Step* step) {
@@ -17,13 +21,17 @@ void GHit::addHitInfos(const G4Step* step) {
 	G4ThreeVector xyz  = preStepPoint->GetPosition();
 	G4ThreeVector xyzL = touchable->GetHistory()->GetTopTransform().TransformPoint(xyz);
 
-	globalPositions.push_back(xyz);
-	localPositions.push_back(xyzL);
-
 	// Energy deposition (scaled by detector multiplier) and global time.
 	double edep = (step->GetTotalEnergyDeposit()) * (gtouchable->getEnergyMultiplier());
 	double time = preStepPoint->GetGlobalTime();
 
+	// The running sums make the derived quantities O(1) to finalize. Photon-counting hits only
+	// need the sums after the first step: skip the per-step records.
+	accumulateStepSums(edep, time, xyz, xyzL);
+	if (storage == GHitStorage::photonCounting && stepSums.steps > 1) { return; }
+
+	globalPositions.push_back(xyz);
+	localPositions.push_back(xyzL);
 	edeps.push_back(edep);
 	times.push_back(time);
 
@@ -54,8 +62,37 @@ void GHit::addHitInfos(const G4Step* step) {
 	tids.push_back(trackId);
 	momenta.push_back(preStepPoint->GetMomentum());
 	trackEs.push_back(preStepPoint->GetTotalEnergy());
+	stepLengths.push_back(step->GetStepLength());
 
-	if (track->GetCreatorProcess()) {
-		processNames.push_back(track->GetCreatorProcess()->GetProcessName());
+	if (const auto* process = track->GetCreatorProcess()) { processIds.push_back(processId(process)); }
+	recordParticleName(track->GetDefinition());
+}
+
+// Process and particle objects live for the whole application, so their addresses are stable keys
+// for per-thread caches that spare the shared tables a lock on every step.
+int GHit::processId(const G4VProcess* process) {
+	thread_local std::unordered_map<const G4VProcess*, int> idByProcess;
+
+	auto [it, inserted] = idByProcess.try_emplace(process, GHIT_UNKNOWN_NAME_ID);
+	if (inserted) { it->second = GNameTable::processes().intern(process->GetProcessName()); }
+	return it->second;
+}
+
+void GHit::recordParticleName(const G4ParticleDefinition* particle) {
+	thread_local std::unordered_set<const G4ParticleDefinition*> recorded;
+
+	if (recorded.insert(particle).second) {
+		GNameTable::particles().assign(particle->GetPDGEncoding(), particle->GetParticleName());
 	}
 }
+
+void GHit::accumulateStepSums(double edep, double time, const G4ThreeVector& xyz, const G4ThreeVector& xyzL) {
+	++stepSums.steps;
+	stepSums.edep += edep;
+	stepSums.time += time;
+	stepSums.edepTime += edep * time;
+	stepSums.globalPosition += xyz;
+	stepSums.edepGlobalPosition += edep * xyz;
+	stepSums.localPosition += xyzL;
+	stepSums.edepLocalPosition += edep * xyzL;
+}
@@ -1,31 +1,28 @@
 // ghit
 #include "ghit.h"
 
-// c++
-#include <utility>
-
 // See header for API docs.
 
 const GHit::CalculatedState& GHit::getCalculatedState() const {
 	if (calculatedState) return *calculatedState;
 
+	// Every derived value comes from the running sums kept by addHitInfos(), so finalizing a hit
+	// does not walk its steps. Averages are energy weighted, or arithmetic when no energy was deposited.
 	CalculatedState state;
-	for (const double edep : edeps) { state.totalEnergyDeposited += edep; }
-	if (!processNames.empty()) { state.processName = processNames.front(); }
-
-	const size_t step_count = edeps.size();
-	if (step_count > 0) {
-		const bool energy_weighted = state.totalEnergyDeposited > 0;
-		for (size_t step = 0; step < step_count; ++step) {
-			double weight = 1.0 / static_cast<double>(step_count);
-			if (energy_weighted) { weight = edeps[step] / state.totalEnergyDeposited; }
-			state.averageTime += times[step] * weight;
-			state.averageGlobalPosition += globalPositions[step] * weight;
-			state.averageLocalPosition += localPositions[step] * weight;
-		}
+	state.totalEnergyDeposited = stepSums.edep;
+	if (stepSums.edep > 0) {
+		state.averageTime           = stepSums.edepTime / stepSums.edep;
+		state.averageGlobalPosition = stepSums.edepGlobalPosition / stepSums.edep;
+		state.averageLocalPosition  = stepSums.edepLocalPosition / stepSums.edep;
+	}
+	else if (stepSums.steps > 0) {
+		const auto step_count       = static_cast<double>(stepSums.steps);
+		state.averageTime           = stepSums.time / step_count;
+		state.averageGlobalPosition = stepSums.globalPosition / step_count;
+		state.averageLocalPosition  = stepSums.localPosition / step_count;
 	}
 
-	calculatedState = std::move(state);
+	calculatedState = state;
 	return *calculatedState;
 }
 
@@ -49,6 +46,7 @@ G4ThreeVector GHit::getAvgLocalPosition() const {
 	return getCalculatedState().averageLocalPosition;
 }
 
-const std::optional<std::string>& GHit::getProcessName() const {
-	return getCalculatedState().processName;
+std::optional<std::string> GHit::getProcessName() const {
+	if (processIds.empty()) { return std::nullopt; }
+	return GNameTable::processes().name(processIds.front());
 }
@@ -7,6 +7,8 @@
 #include "gtouchable.h"
 #include "gtouchable_options.h"
 
+#include "Randomize.hh"
+
 #include <algorithm>
 #include <cmath>
 #include <cstdlib>
@@ -38,7 +40,7 @@ int main(int argc, char* argv[]) {
 	if (hit.getTotalEnergyDeposited() != 0 || hit.getAverageTime() != 0 ||
 	    !nearly_equal(hit.getAvgGlobalPosition(), G4ThreeVector{}) ||
 	    !nearly_equal(hit.getAvgLocalPosition(), G4ThreeVector{}) ||
-	    hit.getProcessName()) {
+	    hit.getProcessName() || hit.getProcessId() != GHIT_UNKNOWN_NAME_ID) {
 		return EXIT_FAILURE;
 	}
 
@@ -71,9 +73,34 @@ int main(int argc, char* argv[]) {
 		return EXIT_FAILURE;
 	}
 
+	// Process names are interned once: every hit refers to the same table entry.
+	GHit other_hit(touchable);
+	other_hit.randomizeHitForTesting(0);
+	if (other_hit.getProcessId() != hit.getProcessId() ||
+	    GNameTable::processes().intern("placeholder") != hit.getProcessId() ||
+	    GNameTable::processes().name(hit.getProcessId()) != "placeholder") {
+		return EXIT_FAILURE;
+	}
+
 	// Appending more step data must invalidate and rebuild the complete cache.
 	hit.randomizeHitForTesting(1);
 	const auto updated_energies = hit.getEdeps();
 	const double updated_total = std::accumulate(updated_energies.begin(), updated_energies.end(), 0.0);
-	return nearly_equal(hit.getTotalEnergyDeposited(), updated_total) ? EXIT_SUCCESS : EXIT_FAILURE;
+	if (!nearly_equal(hit.getTotalEnergyDeposited(), updated_total)) { return EXIT_FAILURE; }
+
+	// Photon-counting storage must report the same derived state and step count from its running sums.
+	GHit full_hit(touchable);
+	GHit counting_hit(touchable, nullptr, "default", GHitStorage::photonCounting);
+	G4Random::setTheSeed(12345);
+	full_hit.randomizeHitForTesting(4);
+	G4Random::setTheSeed(12345);
+	counting_hit.randomizeHitForTesting(4);
+
+	return full_hit.aggregatedSteps() == counting_hit.aggregatedSteps() &&
+	       nearly_equal(full_hit.getTotalEnergyDeposited(), counting_hit.getTotalEnergyDeposited()) &&
+	       nearly_equal(full_hit.getAverageTime(), counting_hit.getAverageTime()) &&
+	       nearly_equal(full_hit.getAvgGlobalPosition(), counting_hit.getAvgGlobalPosition()) &&
+	       nearly_equal(full_hit.getAvgLocalPosition(), counting_hit.getAvgLocalPosition())
+		       ? EXIT_SUCCESS
+		       : EXIT_FAILURE;
 }
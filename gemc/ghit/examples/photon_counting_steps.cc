@@ -0,0 +1,122 @@
+/**
+ * \file photon_counting_steps.cc
+ * \brief Verifies the step bookkeeping of photon-counting hits filled from real \c G4Step objects.
+ *
+ * The same steps are added to a full and to a photon-counting hit through \c GHit::addHitInfos().
+ * The photon-counting hit must record only the first step in its per-step vectors, report that size
+ * from \c nsteps(), and still sum every step into its derived quantities.
+ */
+
+#include "ghit.h"
+#include "gtouchable.h"
+#include "gtouchable_options.h"
+
+// geant4
+#include "G4DynamicParticle.hh"
+#include "G4Electron.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4TouchableHistory.hh"
+#include "G4Track.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <memory>
+#include <vector>
+
+namespace {
+
+bool nearly_equal(double left, double right) {
+	const double scale = std::max({1.0, std::abs(left), std::abs(right)});
+	return std::abs(left - right) <= 1.0e-12 * scale;
+}
+
+struct StepValues
+{
+	G4ThreeVector position;
+	double        time;
+	double        edep;
+};
+
+// Fill the pre-step point of step with one electron step at the given position and time.
+void set_step(G4Step& step, const G4TouchableHandle& touchable, const StepValues& values) {
+	auto* pre = step.GetPreStepPoint();
+	pre->SetTouchableHandle(touchable);
+	pre->SetPosition(values.position);
+	pre->SetGlobalTime(values.time);
+	pre->SetMass(G4Electron::Definition()->GetPDGMass());
+	pre->SetKineticEnergy(10 * MeV);
+	pre->SetMomentumDirection(G4ThreeVector(0, 0, 1));
+	step.SetTotalEnergyDeposit(values.edep);
+	step.SetStepLength(1 * mm);
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	auto options   = std::make_shared<GOptions>(argc, argv, gtouchable::defineOptions());
+	auto touchable = std::make_shared<GTouchable>(options, "readout", "sector: 1", std::vector<double>{}, 1.0);
+
+	// Identity navigation history: local and global positions coincide.
+	G4TouchableHandle g4touchable = new G4TouchableHistory();
+	G4Track track(new G4DynamicParticle(G4Electron::Definition(), G4ThreeVector(0, 0, 1), 10 * MeV), 0,
+	              G4ThreeVector());
+	track.SetTrackID(1);
+	track.SetParentID(0);
+
+	G4Step step;
+	step.SetTrack(&track);
+
+	const std::vector<StepValues> steps = {
+		{{1 * cm, 2 * cm, 3 * cm}, 1 * ns, 0.5 * MeV},
+		{{2 * cm, 4 * cm, 6 * cm}, 2 * ns, 1.5 * MeV},
+		{{4 * cm, 8 * cm, 12 * cm}, 4 * ns, 2.0 * MeV},
+	};
+
+	GHit full_hit(touchable);
+	GHit counting_hit(touchable, nullptr, "default", GHitStorage::photonCounting);
+	for (const auto& values : steps) {
+		set_step(step, g4touchable, values);
+		full_hit.addHitInfos(&step);
+		counting_hit.addHitInfos(&step);
+	}
+
+	// Per-step vectors: every step for the full hit, the first one only for the counting hit.
+	if (full_hit.nsteps() != steps.size() || full_hit.aggregatedSteps() != steps.size()) { return EXIT_FAILURE; }
+	if (counting_hit.nsteps() != 1 || counting_hit.aggregatedSteps() != steps.size()) { return EXIT_FAILURE; }
+
+	// nsteps() bounds every per-step accessor, so loops indexed by it stay inside the vectors.
+	for (const GHit* hit : {&full_hit, &counting_hit}) {
+		const size_t n = hit->nsteps();
+		if (hit->getEdeps().size() != n || hit->getTimes().size() != n || hit->getGlobalPositions().size() != n ||
+		    hit->getLocalPositions().size() != n || hit->getMomenta().size() != n || hit->getMotherInfos().size() != n) {
+			return EXIT_FAILURE;
+		}
+	}
+	if (!nearly_equal(counting_hit.getEdeps().front(), steps.front().edep) ||
+	    !nearly_equal(counting_hit.getTimes().front(), steps.front().time)) {
+		return EXIT_FAILURE;
+	}
+
+	// Derived quantities sum all steps, whatever the storage.
+	double        total_edep = 0;
+	double        edep_time  = 0;
+	G4ThreeVector edep_position;
+	for (const auto& values : steps) {
+		total_edep += values.edep;
+		edep_time += values.edep * values.time;
+		edep_position += values.edep * values.position;
+	}
+
+	for (const GHit* hit : {&full_hit, &counting_hit}) {
+		if (!nearly_equal(hit->getTotalEnergyDeposited(), total_edep) ||
+		    !nearly_equal(hit->getAverageTime(), edep_time / total_edep) ||
+		    !nearly_equal(hit->getAvgGlobalPosition().x(), edep_position.x() / total_edep) ||
+		    !nearly_equal(hit->getAvgGlobalPosition().z(), edep_position.z() / total_edep)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
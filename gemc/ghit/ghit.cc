@@ -35,10 +35,12 @@ G4ThreadLocal G4Allocator<GHit>* GHitAllocator = nullptr;
 
 GHit::GHit(std::shared_ptr<GTouchable> gt,
            const G4Step*               thisStep,
-           const string&               cScheme) :
+           const string&               cScheme,
+           GHitStorage                 hitStorage) :
 	G4VHit(),
 	colorSchema(cScheme),
-	gtouchable(gt) {
+	gtouchable(gt),
+	storage(hitStorage) {
 	// Initialize per-step vectors if a step is provided.
 	if (thisStep) { addHitInfos(thisStep); }
 }
@@ -137,6 +139,8 @@ void GHit::randomizeHitForTesting(int nsteps) {
 		tids.emplace_back(i);
 		momenta.emplace_back(G4UniformRand() * 100, G4UniformRand() * 100, G4UniformRand() * 100);
 		trackEs.emplace_back(G4UniformRand() * 1000);
-		processNames.emplace_back("placeholder");
+		stepLengths.emplace_back(G4UniformRand() * 10);
+		processIds.emplace_back(GNameTable::processes().intern("placeholder"));
+		accumulateStepSums(edeps.back(), times.back(), globalPositions.back(), localPositions.back());
 	}
 }
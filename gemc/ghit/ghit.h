@@ -9,14 +9,33 @@
 #include "G4Step.hh"
 #include "G4Colour.hh"
 
+class G4VProcess;
+class G4ParticleDefinition;
+
 // gemc
 #include <gemc/gtouchable/gtouchable.h>
+#include "ghitConventions.h"
+#include "gnameTable.h"
 
 // c++
 #include <optional>
 #include <atomic>
 #include <map>
 
+/**
+ * \brief Per-step storage policy of a \c GHit, chosen by the digitization routine owning the hit.
+ *
+ * - \c full keeps every per-step vector entry.
+ * - \c photonCounting keeps the first step only, plus running sums for the aggregated quantities.
+ *   Meant for photon-counting detectors where hits are many, each is a single track, and only the
+ *   first-step identity and the averages are ever read.
+ */
+enum class GHitStorage
+{
+	full,
+	photonCounting
+};
+
 /**
  * \class GHit
  * \brief Stores step-by-step and aggregated information for a detector hit.
@@ -28,7 +47,7 @@
  * - **Per-step vectors**: always-collected quantities (energy deposition, time, local/global positions,
  *   track identity, momentum, and creator process).
  * - **Aggregated quantities**: totals/averages (e.g., total energy deposited, average time,
- *   average positions, representative process name) computed lazily from the per-step vectors.
+ *   average positions) finalized lazily, in constant time, from running sums updated with each step.
  *
  * \note This class does not own the sensitive-element description. The associated \c GTouchable
  * is stored as a \c std::shared_ptr so that the hit can be compared against other hits and can
@@ -55,9 +74,11 @@ public:
 	 * \param thisStep Optional \c G4Step used to seed the hit with an initial step record (default: null).
 	 * \param cScheme Visualization color scheme name (default: "default"). The current implementation uses
 	 *                a simple hard-coded scheme but keeps this field for future expansion.
+	 * \param storage Per-step storage policy (default: \c GHitStorage::full).
 	 */
 	GHit(std::shared_ptr<GTouchable> gt, const G4Step* thisStep = nullptr,
-		 const std::string&          cScheme                    = "default");
+		 const std::string&          cScheme                    = "default",
+		 GHitStorage                 storage                    = GHitStorage::full);
 
 	/**
 	 * \brief Destructor.
@@ -133,6 +154,39 @@ private:
 	 */
 	std::shared_ptr<GTouchable> gtouchable;
 
+	/// Per-step storage policy. With \c photonCounting the vectors below hold the first step only.
+	GHitStorage storage;
+
+	/**
+	 * \brief Running sums of the per-step quantities, updated as each step is added.
+	 *
+	 * Both the plain and the energy-weighted sums are kept so the averages can be energy weighted,
+	 * or arithmetic when no energy was deposited. All derived values are finalized from these sums
+	 * in constant time, whatever the storage policy and the number of steps.
+	 */
+	struct StepSums
+	{
+		size_t        steps{};
+		double        edep{};
+		double        time{};
+		double        edepTime{};
+		G4ThreeVector globalPosition;
+		G4ThreeVector edepGlobalPosition;
+		G4ThreeVector localPosition;
+		G4ThreeVector edepLocalPosition;
+	};
+
+	StepSums stepSums;
+
+	/// Add one step to \ref stepSums.
+	void accumulateStepSums(double edep, double time, const G4ThreeVector& xyz, const G4ThreeVector& xyzL);
+
+	/// Id of the process name in \ref GNameTable::processes(), cached per thread.
+	static int processId(const G4VProcess* process);
+
+	/// Adds the particle name to \ref GNameTable::particles() the first time this thread sees it.
+	static void recordParticleName(const G4ParticleDefinition* particle);
+
 	// -------------------------------------------------------------------------
 	// Per-step data (vectors)
 	// -------------------------------------------------------------------------
@@ -187,12 +241,12 @@ private:
 	std::vector<int> tids;
 
 	/**
-	 * \brief Creator process names per step (always present).
+	 * \brief Creator process ids per step, interned in \ref GNameTable::processes().
 	 *
 	 * Populated when a creator process is available for the track at the pre-step point.
-	 * The representative process name for the hit is derived from this vector with the other calculated values.
+	 * The representative process of the hit is the first entry.
 	 */
-	std::vector<std::string> processNames;
+	std::vector<int> processIds;
 
 	/**
 	 * \brief Track 3-momentum per recorded step (unconditional).
@@ -209,6 +263,14 @@ private:
 	 */
 	std::vector<double> trackEs;
 
+	/**
+	 * \brief Step length per recorded step (unconditional).
+	 *
+	 * Values are derived from \c step->GetStepLength(). Summed over a cell and divided by its volume,
+	 * they give the track-length estimate of the fluence.
+	 */
+	std::vector<double> stepLengths;
+
 	/**
 	 * \brief Per-thread cache of track-id to particle PDG encoding.
 	 *
@@ -222,17 +284,15 @@ private:
 	// -------------------------------------------------------------------------
 
 	/**
-	 * \brief Complete derived view calculated from the per-step vectors.
+	 * \brief Complete derived view of the hit, finalized from \ref stepSums on first request.
 	 *
-	 * The state is created in one pass so its values cannot be partially calculated. A missing process name is
-	 * represented independently from whether the numeric state has been calculated.
+	 * All values are set together so they cannot be partially calculated.
 	 */
 	struct CalculatedState {
-		double                     totalEnergyDeposited{};
-		double                     averageTime{};
-		G4ThreeVector              averageGlobalPosition;
-		G4ThreeVector              averageLocalPosition;
-		std::optional<std::string> processName;
+		double        totalEnergyDeposited{};
+		double        averageTime{};
+		G4ThreeVector averageGlobalPosition;
+		G4ThreeVector averageLocalPosition;
 	};
 
 	/// Complete calculated state, absent until a derived value is requested.
@@ -349,16 +409,29 @@ public:
 	[[nodiscard]] inline double getE() const { return trackEs.front(); }
 
 	/**
-	 * \brief Number of recorded steps.
-	 * \return The size of the \c edeps vector, which is always populated.
+	 * \brief Number of recorded steps, i.e. the size of the per-step vectors.
+	 *
+	 * With \c GHitStorage::photonCounting only the first step is recorded; use \ref aggregatedSteps()
+	 * for the number of steps summed into the hit.
+	 *
+	 * \return The size of the \c edeps vector.
 	 */
 	[[nodiscard]] inline size_t nsteps() const { return edeps.size(); }
 
+	/**
+	 * \brief Number of steps summed into the hit, whatever the storage policy.
+	 * \return The number of steps added to the running sums.
+	 */
+	[[nodiscard]] inline size_t aggregatedSteps() const { return stepSums.steps; }
+
 	/**
 	 * \brief Number of recorded steps (same as \ref nsteps()).
-	 * \return The size of the \c edeps vector.
+	 * \return The number of recorded steps.
 	 */
-	[[nodiscard]] inline size_t getStepCount() const { return edeps.size(); }
+	[[nodiscard]] inline size_t getStepCount() const { return nsteps(); }
+
+	/** Return the per-step storage policy of this hit. */
+	[[nodiscard]] inline GHitStorage getStorage() const { return storage; }
 
 	/**
 	 * \brief Count distinct optical-photon tracks recorded in this hit.
@@ -398,11 +471,26 @@ public:
 	 */
 	[[nodiscard]] inline double getTrackE() const { return trackEs.front(); }
 
+	/**
+	 * \brief Get per-step step lengths (always present).
+	 * \return Read-only view of the per-step step lengths.
+	 */
+	[[nodiscard]] inline const std::vector<double>& getStepLengths() const { return stepLengths; }
+
+	/**
+	 * \brief Get the representative creator process id for the hit.
+	 * \return The first recorded process id in \ref GNameTable::processes(), or \c GHIT_UNKNOWN_NAME_ID
+	 * when no creator process was recorded.
+	 */
+	[[nodiscard]] inline int getProcessId() const {
+		return processIds.empty() ? GHIT_UNKNOWN_NAME_ID : processIds.front();
+	}
+
 	/**
 	 * \brief Get the representative creator process name for the hit.
-	 * \return The first recorded process name, or \c std::nullopt when no creator process was recorded.
+	 * \return The name of \ref getProcessId(), or \c std::nullopt when no creator process was recorded.
 	 */
-	[[nodiscard]] const std::optional<std::string>& getProcessName() const;
+	[[nodiscard]] std::optional<std::string> getProcessName() const;
 
 	/**
 	 * \brief Get the associated sensitive-element descriptor.
@@ -434,6 +522,12 @@ public:
 	 */
 	[[nodiscard]] inline double getMass() const { return gtouchable->getMass(); }
 
+	/**
+	 * \brief Get the sensitive element volume
+	 * \return A double with the volume value, 0 when unknown
+	 */
+	[[nodiscard]] inline double getVolume() const { return gtouchable->getVolume(); }
+
 	// -------------------------------------------------------------------------
 	// Aggregation / calculation API
 	// -------------------------------------------------------------------------
@@ -2,5 +2,8 @@
 
 /**
  * \file ghitConventions.h
- * \brief Reserved for future GHit constants and conventions.
+ * \brief Shared GHit constants and conventions.
  */
+
+/// Name-table id recorded when a name is not available, for example the creator process of a primary.
+constexpr int GHIT_UNKNOWN_NAME_ID = -1;
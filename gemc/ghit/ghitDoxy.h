@@ -15,7 +15,7 @@
  * - global time
  * - track identity (PDG, track ID, parent track ID, parent PDG)
  * - track 3-momentum and total energy
- * - creator process name
+ * - creator process, as an id interned in the run-wide process name table
  *
  * \section ghit_visual_model Visual model
  * Steps with the same detector-cell identity and discriminator accumulate into one \c GHit. Step positions,
@@ -24,13 +24,16 @@
  *
  * \image html ghit-detector-steps.svg "Tracks and steps crossing a segmented sensitive detector" width=900px
  *
- * Derived values, such as total deposited energy and time extent, are calculated from the retained step
- * vectors. Digitizers can therefore inspect either the raw step sequence or the summarized hit view.
+ * Derived values, such as total deposited energy and average time and positions, are finalized from running
+ * sums updated as each step is added, so their cost does not grow with the number of steps. Digitizers can
+ * inspect either the raw step sequence or the summarized hit view.
  *
  * \image html ghit-accumulation.svg "Per-step vectors and derived GHit quantities" width=900px
  *
  * \section ghit_components Components
  * - \c GHit : hit container that accumulates per-step vectors and provides lazy derived quantities.
+ * - \c GNameTable : run-wide process and particle name tables. Hits and true information store the
+ *   integer ids, and streamers write the tables once per output file.
  *
  * \section ghit_examples Examples
  * The module ships with an example program:
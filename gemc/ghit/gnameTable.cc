@@ -0,0 +1,52 @@
+// ghit
+#include "gnameTable.h"
+
+// c++
+#include <mutex>
+
+// See header for API docs.
+
+GNameTable& GNameTable::processes() {
+	static GNameTable table;
+	return table;
+}
+
+GNameTable& GNameTable::particles() {
+	static GNameTable table;
+	return table;
+}
+
+int GNameTable::intern(const std::string& name) {
+	{
+		std::shared_lock lock(mutex);
+		if (const auto it = idByName.find(name); it != idByName.end()) { return it->second; }
+	}
+
+	// Another thread may have added the name between the two locks: emplace keeps its id.
+	std::unique_lock lock(mutex);
+	while (nameById.count(nextId) != 0) { ++nextId; }
+	const auto [it, inserted] = idByName.emplace(name, nextId);
+	if (inserted) { nameById.emplace(nextId++, name); }
+	return it->second;
+}
+
+void GNameTable::assign(int id, const std::string& name) {
+	std::unique_lock lock(mutex);
+	if (nameById.emplace(id, name).second) { idByName.emplace(name, id); }
+}
+
+std::string GNameTable::name(int id) const {
+	std::shared_lock lock(mutex);
+	const auto       it = nameById.find(id);
+	return it == nameById.end() ? std::string{} : it->second;
+}
+
+std::vector<std::pair<int, std::string>> GNameTable::entries() const {
+	std::shared_lock lock(mutex);
+	return {nameById.begin(), nameById.end()};
+}
+
+std::size_t GNameTable::size() const {
+	std::shared_lock lock(mutex);
+	return nameById.size();
+}
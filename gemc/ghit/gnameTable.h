@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * \file gnameTable.h
+ * \brief Run-wide tables of interned process and particle names.
+ *
+ * Geant4 process and particle names form a small set fixed for a run. Hits and true information
+ * store the integer id of a name instead of a copy of it, and streamers write each table once per
+ * output file so readers can resolve the ids.
+ */
+
+// gemc
+#include "ghitConventions.h"
+
+// c++
+#include <map>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * \class GNameTable
+ * \brief Thread-safe bidirectional name and id dictionary, shared by all worker threads.
+ *
+ * Ids are either handed out densely from 0 by intern(), or chosen by the caller with assign(), as
+ * for particles whose id is their PDG encoding. Entries are never removed, so an id stays valid for
+ * the whole application.
+ *
+ * Lookups take a shared lock and insertions an exclusive one. Callers on the stepping path keep a
+ * per-thread cache in front of the table so the lock is taken once per name and thread.
+ */
+class GNameTable
+{
+public:
+	/// Table of the creator process names recorded by hits.
+	static GNameTable& processes();
+
+	/// Table of the particle names recorded by hits, keyed by PDG encoding.
+	static GNameTable& particles();
+
+	/**
+	 * \brief Returns the id of \p name, adding it with the next free id if it is new.
+	 *
+	 * \param name Name to intern.
+	 * \return Id of the name.
+	 */
+	int intern(const std::string& name);
+
+	/**
+	 * \brief Records \p name under the caller-chosen \p id, if the id is not taken yet.
+	 *
+	 * \param id Id to record.
+	 * \param name Name associated to the id.
+	 */
+	void assign(int id, const std::string& name);
+
+	/**
+	 * \brief Returns the name stored under \p id.
+	 *
+	 * \param id Id to look up.
+	 * \return The name, or an empty string for unknown ids.
+	 */
+	[[nodiscard]] std::string name(int id) const;
+
+	/// Returns a snapshot of the table as (id, name) pairs ordered by id.
+	[[nodiscard]] std::vector<std::pair<int, std::string>> entries() const;
+
+	/// Number of names in the table.
+	[[nodiscard]] std::size_t size() const;
+
+private:
+	GNameTable() = default;
+
+	mutable std::shared_mutex            mutex;
+	std::unordered_map<std::string, int> idByName;
+	std::map<int, std::string>           nameById;
+	int                                  nextId = 0;
+};
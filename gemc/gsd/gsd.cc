@@ -1,10 +1,14 @@
 // gemc
 #include "gsd.h"
+#include <gemc/gdynamicDigitization/gscoreAndKill.h>
 
 // geant4
 #include "G4SDManager.hh"
 #include "G4Track.hh"
 
+// c++
+#include <algorithm>
+
 // Thread-local sensitive detector instance.
 // Constructor: initializes base logging, Geant4 SD name, and the hits collection name used for this detector.
 GSensitiveDetector::GSensitiveDetector(const std::string&               sdName,
@@ -48,10 +52,12 @@ void GSensitiveDetector::Initialize(G4HCofThisEvent* g4hc) {
 // Thread-local; called for each step in sensitive volumes.
 // Applies plugin filtering and touchable transformation, then creates new hits or updates existing hits.
 G4bool GSensitiveDetector::ProcessHits(G4Step* thisStep, [[maybe_unused]] G4TouchableHistory* g4th) {
-	// If there is a decision to skip this hit based on deposited energy, return immediately.
-
 	double depe = thisStep->GetTotalEnergyDeposit();
 
+	// Declarative cuts first: a rejected step costs a few comparisons and no plugin call.
+	if (preHitFilter.rejects(depe, thisStep)) { return true; }
+
+	// Then the routine's own decision to skip this hit, for cuts the filter cannot express.
 	if (digitization_routine->decisionToSkipHit(depe, thisStep)) { return true; }
 
 	// The hits collection should have been created in Initialize().
@@ -73,13 +79,18 @@ G4bool GSensitiveDetector::ProcessHits(G4Step* thisStep, [[maybe_unused]] G4Touc
 		thisGTouchable->assignTrackId(thisStep->GetTrack()->GetTrackID());
 		thisGTouchable->assignPId(thisStep->GetTrack()->GetDefinition()->GetPDGEncoding());
 
-		// Create-or-update through the per-event hit-cell map: the key has the same
-		// semantics as GTouchable::operator== (identity + type discriminator).
-		auto [it, isNewCell] = hitsByCellKey.try_emplace(thisGTouchable->cellKey(), nullptr);
-		if (isNewCell) {
+		// Create-or-update through the per-event hit-cell map: the integer key hashes the identity
+		// and type discriminator, and sameCell() confirms the match (GTouchable::operator== semantics).
+		const auto cellKey = thisGTouchable->cellKey();
+		auto [first, last] = hitsByCellKey.equal_range(cellKey);
+		auto it            = std::find_if(first, last, [&](const auto& entry) {
+			return entry.second->getGTouchable()->sameCell(*thisGTouchable);
+		});
+		if (it == last) {
 			log->info(2, " ✅ new GTouchable for ", GetName(), ": ", thisGTouchable->getIdentityString());
-			it->second = new GHit(thisGTouchable, thisStep);
-			gHitsCollection->insert(it->second);
+			auto* newHit = new GHit(thisGTouchable, thisStep, "default", digitization_routine->hit_storage());
+			gHitsCollection->insert(newHit);
+			hitsByCellKey.emplace(cellKey, newHit);
 		}
 		else {
 			log->info(2, " ❌ existing GTouchable for ", GetName(), ": ", thisGTouchable->getIdentityString());
@@ -89,8 +100,11 @@ G4bool GSensitiveDetector::ProcessHits(G4Step* thisStep, [[maybe_unused]] G4Touc
 
 	// Plugins may mark a sensitive element as terminal. Apply the status only after every
 	// processed touchable has stored this step, so terminating a track never drops its hit.
+	// The mark tells GSteppingAction to drop the secondaries of this step; those of earlier
+	// steps are kept.
 	if (digitization_routine->shouldStopTrackAfterHit(thisStep)) {
 		thisStep->GetTrack()->SetTrackStatus(fStopAndKill);
+		GScoreAndKill::markStoppedTrack(thisStep->GetTrack());
 	}
 
 	return true;
@@ -9,6 +9,7 @@
 #include <gemc/gbase/gbase.h>
 
 // c++
+#include <cstdint>
 #include <unordered_map>
 
 /**
@@ -132,7 +133,8 @@ public:
 	 * - creates a new GHit and inserts it in the hits collection, or
 	 * - locates an existing GHit and appends step information.
 	 * After all touchables are stored, the digitization routine may request that the track be
-	 * terminated with \c fStopAndKill.
+	 * terminated: it is marked \c fKillTrackAndSecondaries, which GSteppingAction resolves by
+	 * dropping the secondaries of this step only.
 	 *
 	 * \param thisStep Geant4 step being processed.
 	 * \param g4th     Geant4 touchable history (not used by this implementation).
@@ -154,10 +156,14 @@ public:
 	 * \brief Assigns the digitization routine used to interpret steps and define hit content.
 	 *
 	 * The assigned routine is expected to remain valid for the lifetime of this sensitive detector instance.
+	 * Its pre-hit filter, when defined, is copied into this detector.
 	 *
 	 * \param digi_routine Digitization routine responsible for readout specs and step processing.
 	 */
-	void assign_digi_routine(std::shared_ptr<GDynamicDigitization> digi_routine) { digitization_routine = digi_routine; }
+	void assign_digi_routine(std::shared_ptr<GDynamicDigitization> digi_routine) {
+		preHitFilter         = digi_routine->preHitFilter ? *digi_routine->preHitFilter : GPreHitFilter();
+		digitization_routine = std::move(digi_routine);
+	}
 
 	/**
 	 * \brief Clears the volume-to-touchable map so a reused SD reflects the current geometry.
@@ -179,6 +185,14 @@ private:
 	 */
 	std::shared_ptr<GDynamicDigitization> digitization_routine;
 
+	/**
+	 * \brief Copy of the routine's pre-hit filter, evaluated first in ProcessHits().
+	 *
+	 * Held by value so the per-step check reads plain fields of this detector. Accepts every step
+	 * until a routine with a defined filter is assigned.
+	 */
+	GPreHitFilter preHitFilter;
+
 	/**
 	 * \brief Map of volume name to registered GTouchable.
 	 *
@@ -208,13 +222,15 @@ private:
 	}
 
 	/**
-	 * \brief Per-event map from hit-cell key (GTouchable::cellKey()) to the hit for that cell.
+	 * \brief Per-event map from hit-cell key (GTouchable::cellKey()) to the hits for that key.
 	 *
 	 * Cleared at the start of each event. Gives O(1) create-or-update hit lookups in ProcessHits();
 	 * with many hits per event (e.g. optical detectors) a linear scan of the hit collection would be
-	 * quadratic. The GHit pointers are non-owning: the hits collection owns the hits.
+	 * quadratic. Keys are integers so a step builds no strings; a multimap keeps the rare key
+	 * collisions apart, resolved with GTouchable::sameCell(). The GHit pointers are non-owning:
+	 * the hits collection owns the hits.
 	 */
-	std::unordered_map<std::string, GHit*> hitsByCellKey;
+	std::unordered_multimap<std::uint64_t, GHit*> hitsByCellKey;
 
 	/**
 	 * \brief Pointer to the current event hits collection.
@@ -60,6 +60,8 @@
  * \subsection gsd_design Architecture and design notes
  *
  * **Key responsibilities**
+ * - Reject steps with the routine's declarative pre-hit filter (GPreHitFilter) before any touchable
+ *   or hit work.
  * - Maintain a per-event map of hit-cell keys (hitsByCellKey) to decide whether a step creates a new hit
  *   or updates an existing one.
  * - Store hits in a \c G4THitsCollection<GHit> (typedef GHitsCollection).
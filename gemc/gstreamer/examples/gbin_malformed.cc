@@ -0,0 +1,126 @@
+// gstreamer
+#include "gstreamerGbinReader.h"
+
+// c++
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <string>
+
+/**
+ * \file gbin_malformed.cc
+ * \ingroup gstreamer_examples_api
+ * \anchor gbin_malformed
+ * \brief Checks that the gbin reader rejects corrupt files with GBinError instead of reading out of bounds.
+ *
+ * Summary:
+ * The example writes small gbin files by hand: one valid file with a two-row string column, and
+ * variants whose row count, string offsets or character-block size are corrupt. The valid file must
+ * read back, and every corrupt one must raise gstreamer::gbin::GBinError.
+ */
+
+using namespace gstreamer::gbin;
+
+namespace {
+
+template <typename T>
+void put(std::string& bytes, const T& value) { bytes.append(reinterpret_cast<const char*>(&value), sizeof(value)); }
+
+void pad(std::string& bytes) { bytes.resize(padded(bytes.size()), '\0'); }
+
+void putRecord(std::string& file, RecordKind kind, const std::string& payload) {
+	put(file, RecordHeader{static_cast<std::uint32_t>(kind), 0, payload.size()});
+	file += payload;
+}
+
+/**
+ * \brief Builds a file with one header table holding one string column "name".
+ *
+ * \param nrows Row count written in the chunk.
+ * \param middle Offset separating the two strings.
+ * \param chars Size of the character block, stored as the last offset.
+ */
+std::string stringTableFile(std::uint64_t nrows, std::uint64_t middle, std::uint64_t chars) {
+	std::string file;
+	FileHeader  header{};
+	std::memcpy(header.magic, MAGIC, sizeof(header.magic));
+	header.version   = FORMAT_VERSION;
+	header.byteOrder = BYTE_ORDER_MARK;
+	put(file, header);
+
+	std::string schema;
+	put(schema, static_cast<std::uint32_t>(TableKind::header));
+	put(schema, std::uint32_t{1});
+	put(schema, std::uint32_t{6});
+	schema += "header";
+	put(schema, static_cast<std::uint32_t>(ColumnType::string));
+	put(schema, std::uint32_t{4});
+	schema += "name";
+	pad(schema);
+	putRecord(file, RecordKind::schema, schema);
+
+	std::string chunk;
+	put(chunk, nrows);
+	put(chunk, std::uint64_t{0});
+	put(chunk, middle);
+	put(chunk, chars);
+	chunk += "abcde";
+	pad(chunk);
+	putRecord(file, RecordKind::chunk, chunk);
+	return file;
+}
+
+std::string writeFile(const std::string& name, const std::string& bytes) {
+	std::ofstream out(name, std::ios::binary | std::ios::trunc);
+	out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+	return name;
+}
+
+/// Returns true when opening \p name, then reading every string of its first chunk, throws GBinError.
+bool rejected(const std::string& name) {
+	try {
+		const GBinFile file(name);
+		const auto&    chunk = file.tables().at(0).chunks().at(0);
+		for (std::uint64_t row = 0; row < chunk.rows(); row++) { (void)chunk.string(0, row); }
+	}
+	catch (const GBinError& error) {
+		std::cout << name << ": " << error.what() << "\n";
+		return true;
+	}
+	return false;
+}
+
+} // namespace
+
+/**
+ * \brief Entry point of the malformed gbin example.
+ *
+ * \return \c EXIT_SUCCESS when the valid file reads back and every corrupt file is rejected.
+ */
+int main() {
+	constexpr auto max = std::numeric_limits<std::uint64_t>::max();
+
+	const GBinFile valid(writeFile("gbin_valid.gbin", stringTableFile(2, 2, 5)));
+	const auto&    chunk = valid.tables().at(0).chunks().at(0);
+	if (chunk.string(0, 0) != "ab" || chunk.string(0, 1) != "cde") { return EXIT_FAILURE; }
+
+	// Accessing a string column as numbers is a column-access error, not a crash.
+	try {
+		(void)chunk.ints(0);
+		return EXIT_FAILURE;
+	}
+	catch (const GBinError& error) {
+		if (error.code() != ERR_GBINCOLUMNACCESS) { return EXIT_FAILURE; }
+	}
+
+	const bool all_rejected =
+		rejected(writeFile("gbin_offset_past_chars.gbin", stringTableFile(2, 9, 5))) &&
+		rejected(writeFile("gbin_decreasing_offsets.gbin", stringTableFile(2, 6, 5))) &&
+		rejected(writeFile("gbin_overflowing_rows.gbin", stringTableFile(max / 4, 2, 5))) &&
+		rejected(writeFile("gbin_max_rows.gbin", stringTableFile(max, 2, 5))) &&
+		rejected(writeFile("gbin_overflowing_chars.gbin", stringTableFile(2, 2, max - 3)));
+
+	return all_rejected ? EXIT_SUCCESS : EXIT_FAILURE;
+}
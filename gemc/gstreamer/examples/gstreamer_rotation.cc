@@ -0,0 +1,103 @@
+// gstreamer
+#include "gstreamer.h"
+
+// gemc
+#include "glogger.h"
+
+// c++
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \file gstreamer_rotation.cc
+ * \ingroup gstreamer_examples_api
+ * \anchor gstreamer_rotation
+ * \brief Checks the numbered files written by an output rotating every two events.
+ *
+ * Summary:
+ * Five events, numbered 1 to 5, are published through an ASCII output with \c rotate_events set
+ * to 2. The output must be split in \c rotation_0001.txt with events 1 and 2,
+ * \c rotation_0002.txt with events 3 and 4, and \c rotation_0003.txt with event 5, with no
+ * unnumbered file and no empty fourth file. Every file must end with exactly one copy of the
+ * process and particle name tables, so each file can be read on its own.
+ *
+ * \code
+ * ./gstreamer_rotation -gstreamer="[{format: ascii, filename: rotation, rotate_events: 2}]"
+ * \endcode
+ */
+
+namespace {
+
+std::string read_file(const std::string& path) {
+	std::ifstream in(path);
+	return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+std::size_t occurrences(const std::string& text, const std::string& token) {
+	std::size_t count = 0;
+	for (auto pos = text.find(token); pos != std::string::npos; pos = text.find(token, pos + token.size())) { count++; }
+	return count;
+}
+
+} // namespace
+
+/**
+ * \brief Entry point of the output rotation check.
+ *
+ * \param argc Number of command-line arguments.
+ * \param argv Command-line argument vector.
+ * \return \c EXIT_SUCCESS when the files hold the expected events and name tables.
+ */
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gstreamer::defineOptions());
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, GSTREAMER_LOGGER);
+
+	// Expected events of each numbered file.
+	const std::vector<std::vector<int>> split = {{1, 2}, {3, 4}, {5}};
+
+	// Map keys are <plugin>:<rootname>; single-threaded outputs keep the rootname unchanged.
+	auto gstreamer_map = gstreamer::gstreamersMapPtr(gopts);
+	for (const auto& [name, gstreamer] : *gstreamer_map) {
+		const std::string rootname = name.substr(name.find(':') + 1);
+		for (const auto& suffix : {"", "_0001", "_0002", "_0003", "_0004"}) {
+			std::filesystem::remove(rootname + suffix + ".txt");
+		}
+
+		if (!gstreamer->openConnection()) { log->error(1, "Failed to open connection for GStreamer ", name); }
+		for (int evn = 1; evn <= 5; evn++) {
+			auto eventData = std::make_shared<GEventDataCollection>(gopts, std::make_unique<GEventHeader>(gopts, evn, -1));
+			eventData->addDetectorDigitizedData("ctof", GDigitizedData::create(gopts));
+			eventData->addDetectorTrueInfoData("ctof", GTrueInfoData::create(gopts));
+			gstreamer->publishEventData(eventData);
+		}
+		if (!gstreamer->closeConnection()) { log->error(1, "Failed to close connection for GStreamer ", name); }
+
+		if (std::filesystem::exists(rootname + ".txt") || std::filesystem::exists(rootname + "_0004.txt")) {
+			log->error(1, name, ": only the three numbered files should be written");
+		}
+
+		for (std::size_t file = 0; file < split.size(); file++) {
+			const std::string path = rootname + "_000" + std::to_string(file + 1) + ".txt";
+			const auto        text = read_file(path);
+
+			if (occurrences(text, "Event n. ") != split[file].size()) {
+				log->error(1, path, ": ", occurrences(text, "Event n. "), " events, expected ", split[file].size());
+			}
+			for (const int evn : split[file]) {
+				if (occurrences(text, "Event n. " + std::to_string(evn) + " {") != 1) {
+					log->error(1, path, ": event ", evn, " is missing");
+				}
+			}
+			if (occurrences(text, "Process names {") != 1 || occurrences(text, "Particle names {") != 1) {
+				log->error(1, path, ": the name tables must be written once per file");
+			}
+		}
+		log->info(0, name, ": ", split.size(), " files with the expected events and name tables");
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+// gstreamer
+#include "gstreamer.h"
+
+// gemc
+#include "glogger.h"
+
+// c++
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+/**
+ * \file gstreamer_selection.cc
+ * \ingroup gstreamer_examples_api
+ * \anchor gstreamer_selection
+ * \brief Checks that outputs hold only the detectors and products their selection names.
+ *
+ * Summary:
+ * Events with true information and digitized hits in two detectors, \c ctof and \c ecal, are
+ * published through a CSV output selecting the digitized hits of \c ctof and a JSON output selecting
+ * the true information of every detector. The files are read back: the CSV digitized file must have
+ * \c ctof rows and no \c ecal row, its true-information file must stay empty, and the JSON file
+ * must hold the true information of both detectors and no digitized bank.
+ *
+ * \code
+ * ./gstreamer_selection -gstreamer="[{format: csv, filename: selection_digi, detectors: ctof, products: digitized},
+ *                                    {format: json, filename: selection_true, products: true_info}]"
+ * \endcode
+ */
+
+namespace {
+
+std::string read_file(const std::string& path) {
+	std::ifstream in(path);
+	return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+void check(const std::shared_ptr<GLogger>& log, bool condition, const std::string& what) {
+	if (!condition) { log->error(1, what); }
+}
+
+} // namespace
+
+/**
+ * \brief Entry point of the output selection check.
+ *
+ * \param argc Number of command-line arguments.
+ * \param argv Command-line argument vector.
+ * \return \c EXIT_SUCCESS when every output holds exactly its selection.
+ */
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gstreamer::defineOptions());
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, GSTREAMER_LOGGER);
+
+	auto gstreamer_map = gstreamer::gstreamersMapPtr(gopts);
+	for (const auto& [name, gstreamer] : *gstreamer_map) {
+		if (!gstreamer->openConnection()) { log->error(1, "Failed to open connection for GStreamer ", name); }
+	}
+
+	for (int evn = 0; evn < 3; evn++) {
+		auto eventData = std::make_shared<GEventDataCollection>(gopts, GEventHeader::create(gopts));
+		for (const std::string detector : {"ctof", "ecal"}) {
+			for (int hit = 0; hit < 2; hit++) {
+				eventData->addDetectorDigitizedData(detector, GDigitizedData::create(gopts));
+				eventData->addDetectorTrueInfoData(detector, GTrueInfoData::create(gopts));
+			}
+		}
+		for (const auto& [name, gstreamer] : *gstreamer_map) { gstreamer->publishEventData(eventData); }
+	}
+
+	for (const auto& [name, gstreamer] : *gstreamer_map) {
+		if (!gstreamer->closeConnection()) { log->error(1, "Failed to close connection for GStreamer ", name); }
+	}
+
+	// Map keys are <plugin>:<rootname>; single-threaded outputs keep the rootname unchanged.
+	for (const auto& [name, gstreamer] : *gstreamer_map) {
+		const std::string rootname = name.substr(name.find(':') + 1);
+
+		if (name.find("csv") != std::string::npos) {
+			const auto digitized = read_file(rootname + "_digitized.csv");
+			check(log, digitized.find(", ctof, ") != std::string::npos, name + ": the selected ctof hits are missing");
+			check(log, digitized.find(", ecal, ") == std::string::npos, name + ": the unselected ecal hits are written");
+			check(log, read_file(rootname + "_true_info.csv").empty(), name + ": unselected true information is written");
+		}
+		else if (name.find("json") != std::string::npos) {
+			const auto json = read_file(rootname + ".json");
+			check(log, json.find("\"ctof\": {\"true_info\"") != std::string::npos, name + ": ctof true information is missing");
+			check(log, json.find("\"ecal\": {\"true_info\"") != std::string::npos, name + ": ecal true information is missing");
+			check(log, json.find("digitized_by_detector") == std::string::npos, name + ": unselected digitized hits are written");
+		}
+		log->info(0, name, ": the output holds its selection only");
+	}
+
+	return EXIT_SUCCESS;
+}
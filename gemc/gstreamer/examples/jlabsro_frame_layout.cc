@@ -0,0 +1,152 @@
+// gstreamer
+#include "gstreamer.h"
+
+// gemc
+#include "glogger.h"
+
+// c++
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * \file jlabsro_frame_layout.cc
+ * \ingroup gstreamer_examples_api
+ * \anchor jlabsro_frame_layout
+ * \brief Compares the JLAB SRO output of two small frames with their expected words.
+ *
+ * Summary:
+ * Two frames with a handful of hits are published through the jlabsro streamer and the \c ".ev"
+ * file is read back word by word. The expected words are written out by hand from the format:
+ * super magic words before the first frame, the packed DataFrameHeader, then the payload with its
+ * slot index, one marker word per non-empty slot carrying that slot's crate, and the hit words in
+ * input order. Hits outside the 16 slots are dropped.
+ *
+ * The connection is then opened again, as at the start of a second run, and a third frame is
+ * published: frame IDs continue across runs, and the new file must start with the super magic
+ * words although its first frame is not frame 1.
+ *
+ * \code
+ * ./jlabsro_frame_layout -gstreamer="[{format: jlabsro, filename: frames_layout, type: stream}]"
+ * \endcode
+ */
+
+namespace {
+
+/// Hit word: charge in bits 0-12, channel from bit 13, time / 4 from bit 17.
+constexpr std::uint32_t hitWord(std::uint32_t channel, std::uint32_t charge, std::uint32_t time) {
+	return charge | (channel << 13) | ((time / 4) << 17);
+}
+
+/// Marker word opening the block of one slot.
+constexpr std::uint32_t slotMarker(std::uint32_t crate, std::uint32_t slot) { return 0x80008000 | (crate << 8) | slot; }
+
+/// Packed header words: lengths, magic, version, flags, then the three 64-bit fields with swapped halves.
+void appendHeader(std::vector<std::uint32_t>& words, std::uint32_t frameID, std::uint32_t payloadWords) {
+	const std::uint32_t payloadBytes = 4 * payloadWords;
+	const std::uint32_t ts_nsec      = frameID * 65536;
+	words.insert(words.end(), {0, payloadBytes + 52 - 4, payloadBytes, payloadBytes, 0xC0DA2019, 257, 0,
+	                           0, frameID, 0, 0, 0, ts_nsec});
+}
+
+/// Compare the little-endian words of a file with the expected ones.
+void checkWords(const std::shared_ptr<GLogger>& log, const std::string& name, const std::string& path,
+                const std::vector<std::uint32_t>& expected) {
+	std::ifstream                    in(path, std::ios::binary);
+	const std::vector<unsigned char> bytes{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+	if (bytes.size() != 4 * expected.size()) {
+		log->error(1, name, ": ", bytes.size(), " bytes written, expected ", 4 * expected.size());
+	}
+
+	for (std::size_t w = 0; w < expected.size(); w++) {
+		const std::uint32_t word = bytes[4 * w] | (bytes[4 * w + 1] << 8) | (bytes[4 * w + 2] << 16) |
+			(static_cast<std::uint32_t>(bytes[4 * w + 3]) << 24);
+		if (word != expected[w]) {
+			log->error(1, name, ": word ", w, " is ", word, ", expected ", expected[w]);
+		}
+	}
+	log->info(0, name, ": ", expected.size(), " words match the expected frame layout");
+}
+
+} // namespace
+
+/**
+ * \brief Entry point of the JLAB SRO frame layout check.
+ *
+ * \param argc Number of command-line arguments.
+ * \param argv Command-line argument vector.
+ * \return \c EXIT_SUCCESS when the file matches the expected words.
+ */
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gstreamer::defineOptions());
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, GSTREAMER_LOGGER);
+
+	// Frame 1: slot 2 hits around a slot 0 hit, and one hit outside the slot range.
+	auto first = std::make_unique<GFrameDataCollection>(std::make_unique<GFrameHeader>(1, 65536, log), log);
+	first->addIntegralPayload({3, 2, 5, 100, 40});
+	first->addIntegralPayload({3, 0, 1, 7, 8});
+	first->addIntegralPayload({3, 20, 9, 50, 12});
+	first->addIntegralPayload({3, 2, 6, 200, 4});
+
+	// Frame 2: one hit in the last slot, from another crate.
+	auto second = std::make_unique<GFrameDataCollection>(std::make_unique<GFrameHeader>(2, 65536, log), log);
+	second->addIntegralPayload({1, 15, 2, 30, 16});
+
+	std::vector<std::uint32_t> expected = {0xC0DA2019, 0xC0DA0001};
+
+	// Payload of frame 1: 1 + 16 index words, then slot 0 (marker + 1 hit) at word 17 and
+	// slot 2 (marker + 2 hits) at word 19. Empty slots point at the next free word.
+	appendHeader(expected, 1, 22);
+	expected.push_back(0x80000000);
+	expected.push_back((2u << 16) | 17);
+	expected.push_back(19);
+	expected.push_back((3u << 16) | 19);
+	for (int slot = 3; slot < 16; slot++) { expected.push_back(22); }
+	expected.push_back(slotMarker(3, 0));
+	expected.push_back(hitWord(1, 7, 8));
+	expected.push_back(slotMarker(3, 2));
+	expected.push_back(hitWord(5, 100, 40));
+	expected.push_back(hitWord(6, 200, 4));
+
+	// Payload of frame 2: slots 0-14 empty at word 17, slot 15 with one hit.
+	appendHeader(expected, 2, 19);
+	expected.push_back(0x80000000);
+	for (int slot = 0; slot < 15; slot++) { expected.push_back(17); }
+	expected.push_back((2u << 16) | 17);
+	expected.push_back(slotMarker(1, 15));
+	expected.push_back(hitWord(2, 30, 16));
+
+	// Frame 3, first frame of the next run: one hit in slot 0.
+	auto third = std::make_unique<GFrameDataCollection>(std::make_unique<GFrameHeader>(3, 65536, log), log);
+	third->addIntegralPayload({4, 0, 3, 60, 20});
+
+	std::vector<std::uint32_t> expectedNextRun = {0xC0DA2019, 0xC0DA0001};
+	appendHeader(expectedNextRun, 3, 19);
+	expectedNextRun.push_back(0x80000000);
+	expectedNextRun.push_back((2u << 16) | 17);
+	for (int slot = 1; slot < 16; slot++) { expectedNextRun.push_back(19); }
+	expectedNextRun.push_back(slotMarker(4, 0));
+	expectedNextRun.push_back(hitWord(3, 60, 20));
+
+	// Map keys are <plugin>:<rootname>; single-threaded outputs keep the rootname unchanged.
+	for (const auto& [name, gstreamer] : *gstreamer::gstreamersMapPtr(gopts)) {
+		if (!gstreamer->openConnection()) { log->error(1, "Failed to open connection for GStreamer ", name); }
+		gstreamer->publishFrameRunData(first.get());
+		gstreamer->publishFrameRunData(second.get());
+		if (!gstreamer->closeConnection()) { log->error(1, "Failed to close connection for GStreamer ", name); }
+
+		const std::string path = name.substr(name.find(':') + 1) + ".ev";
+		checkWords(log, name, path, expected);
+
+		// Next run: the connection is opened again and the frame numbering goes on.
+		if (!gstreamer->openConnection()) { log->error(1, "Failed to open connection for GStreamer ", name); }
+		gstreamer->publishFrameRunData(third.get());
+		if (!gstreamer->closeConnection()) { log->error(1, "Failed to close connection for GStreamer ", name); }
+		checkWords(log, name, path, expectedNextRun);
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+// gstreamer
+#include "gstreamer.h"
+
+// gemc
+#include "glogger.h"
+#include "gdynamicdigitization.h"
+#include "gutilities.h"
+
+// c++
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+/**
+ * \file root_storage_benchmark.cc
+ * \ingroup gstreamer_examples_api
+ * \anchor root_storage_benchmark
+ * \brief Compares write throughput and file size of ROOT outputs with different storage settings.
+ *
+ * Summary:
+ * This example builds one reference event sample in memory, then writes the same sample through
+ * every configured streamer in turn. For each output it reports the wall time spent between opening
+ * and closing the file, the event rate, the resulting file size, and the write throughput.
+ * Configure one output per setting to compare, for example:
+ *
+ * \code
+ * ./root_storage_benchmark \
+ *   -gstreamer="[{format: root, filename: bench_lz4, compression: 'lz4:1'},
+ *                {format: root, filename: bench_zstd, compression: 'zstd:5', basket_size: '32000, true_info=256000'}]"
+ * \endcode
+ */
+
+const std::string plugin_name = "test_gdynamic_plugin";
+
+/**
+ * \brief Build the reference event sample shared by every benchmarked output.
+ *
+ * \param nevents Number of events in the sample.
+ * \param nhits Number of hits per event in the reference detector.
+ * \param dynamicRoutinesMap Dynamic digitization routines keyed by plugin name.
+ * \param gopts Parsed options container.
+ * \return The events, ready to be published.
+ */
+std::vector<std::shared_ptr<GEventDataCollection>> reference_sample(
+	int nevents, unsigned nhits, const std::shared_ptr<const gdynamicdigitization::dRoutinesMap>& dynamicRoutinesMap,
+	const std::shared_ptr<GOptions>& gopts) {
+	std::vector<std::shared_ptr<GEventDataCollection>> events;
+	events.reserve(nevents);
+
+	const auto& routine = dynamicRoutinesMap->at(plugin_name);
+	for (int evn = 0; evn < nevents; evn++) {
+		auto eventData = std::make_shared<GEventDataCollection>(gopts, GEventHeader::create(gopts, 0));
+		for (unsigned i = 1; i <= nhits; i++) {
+			auto hit = GHit::create(gopts);
+			eventData->addDetectorTrueInfoData("ctof", routine->collectTrueInformation(hit, i));
+			eventData->addDetectorDigitizedData("ctof", routine->digitizeHit(hit, i));
+		}
+		events.push_back(std::move(eventData));
+	}
+	return events;
+}
+
+/**
+ * \brief Entry point of the ROOT storage benchmark.
+ *
+ * \param argc Number of command-line arguments.
+ * \param argv Command-line argument vector.
+ * \return \c EXIT_SUCCESS on normal completion.
+ */
+int main(int argc, char* argv[]) {
+	auto gopts = std::make_shared<GOptions>(argc, argv, gstreamer::defineOptions());
+	auto log   = std::make_shared<GLogger>(gopts, SFUNCTION_NAME, GSTREAMER_LOGGER);
+
+	constexpr int      nevents = 2000;
+	constexpr unsigned nhits   = 50;
+
+	auto dynamicRoutinesMap = gdynamicdigitization::dynamicRoutinesMap({plugin_name}, gopts);
+	if (dynamicRoutinesMap->at(plugin_name)->loadConstants(1, "default") == false) {
+		log->error(1, "Failed to load constants for dynamic routine", plugin_name,
+		           "for run number 1 with variation 'default'.");
+	}
+
+	const auto events = reference_sample(nevents, nhits, dynamicRoutinesMap, gopts);
+
+	// Map keys are <plugin>:<rootname>; single-threaded outputs keep the rootname unchanged.
+	for (const auto& [name, gstreamer] : *gstreamer::gstreamersMapPtr(gopts)) {
+		const auto start = std::chrono::steady_clock::now();
+
+		if (!gstreamer->openConnection()) { log->error(1, "Failed to open connection for GStreamer ", name); }
+		for (const auto& eventData : events) { gstreamer->publishEventData(eventData); }
+		if (!gstreamer->closeConnection()) { log->error(1, "Failed to close connection for GStreamer ", name); }
+
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+		const auto file = std::filesystem::path(name.substr(name.find(':') + 1) + ".root");
+		const auto size = std::filesystem::exists(file) ? std::filesystem::file_size(file) : 0;
+		const auto mb   = static_cast<double>(size) / (1024.0 * 1024.0);
+
+		log->info(0, name, ": ", nevents, " events in ", elapsed.count(), " s (", nevents / elapsed.count(),
+		          " events/s), ", mb, " MB written (", mb / elapsed.count(), " MB/s)");
+	}
+
+	return EXIT_SUCCESS;
+}
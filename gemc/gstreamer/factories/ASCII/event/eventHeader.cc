@@ -14,6 +14,13 @@ bool GstreamerTextFactory::publishEventHeaderImpl([[maybe_unused]] const std::un
 	ofile << guts::GTAB << "Header Bank {\n";
 	ofile << guts::GTABTAB << " time: " << gevent_header->getTimeStamp() << "\n";
 	ofile << guts::GTABTAB << " thread id: " << gevent_header->getThreadID() << "\n";
+	if (gevent_header->hasRandomSeeds()) {
+		ofile << guts::GTABTAB << " random seeds: " << gevent_header->getRandomSeeds()[0] << " "
+			<< gevent_header->getRandomSeeds()[1] << "\n";
+	}
+	if (gevent_header->hasReplayedEvent()) {
+		ofile << guts::GTABTAB << " replayed event: " << gevent_header->getReplayedEvent() << "\n";
+	}
 	ofile << guts::GTAB << "}\n";
 
 	return true;
@@ -19,10 +19,12 @@ bool GstreamerTextFactory::publishEventTrueInfoDataImpl(const std::string&
 
 		ofile << guts::GTABTAB << "Hit address: " << identifierString << " {\n";
 
-		for (const auto& [variableName, value] : trueInfoHit->getDoubleVariablesMap()) {
+		for (const auto& [variableName, value] : trueInfoHit->getDoubleVariablesView()) {
+			if (!output_selection.selectsVariable(variableName)) { continue; }
 			ofile << guts::GTABTABTAB << variableName << ": " << value << "\n";
 		}
-		for (const auto& [variableName, value] : trueInfoHit->getStringVariablesMap()) {
+		for (const auto& [variableName, value] : trueInfoHit->getStringVariablesView()) {
+			if (!output_selection.selectsVariable(variableName)) { continue; }
 			ofile << guts::GTABTABTAB << variableName << ": " << value << "\n";
 		}
 
@@ -83,3 +85,17 @@ bool GstreamerTextFactory::publishEventAncestorsImpl(const GAncestorBank& ancest
 	ofile << guts::GTAB << "}\n";
 	return true;
 }
+
+bool GstreamerTextFactory::publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) {
+	if (!ofile.is_open()) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, "Error: can't access ", filename());
+	}
+
+	for (const auto& [tableName, table] : {std::pair{"Process", &processes}, std::pair{"Particle", &particles}}) {
+		ofile << tableName << " names {\n";
+		for (const auto& [id, name] : table->entries()) { ofile << guts::GTAB << id << ": " << name << "\n"; }
+		ofile << "}\n";
+	}
+
+	return true;
+}
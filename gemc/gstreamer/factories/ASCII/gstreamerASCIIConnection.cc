@@ -36,4 +36,8 @@ bool GstreamerTextFactory::closeConnectionImpl() {
 	log->info(1, SFUNCTION_NAME, "GstreamerTextFactory: closed file " + filename());
 
 	return true;
-}
\ No newline at end of file
+}
+
+std::uint64_t GstreamerTextFactory::outputBytes() {
+	return ofile.is_open() ? static_cast<std::uint64_t>(ofile.tellp()) : 0;
+}
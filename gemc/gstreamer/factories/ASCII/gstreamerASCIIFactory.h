@@ -63,6 +63,9 @@ private:
 	 */
 	bool closeConnectionImpl() override;
 
+	/// \brief Position of the output stream, which counts the text still in its buffer.
+	std::uint64_t outputBytes() override;
+
 	/**
 	 * \brief Begin one event block in the text output.
 	 *
@@ -123,6 +126,15 @@ private:
 	/** \brief Write the event ancestor bank in text form. */
 	bool publishEventAncestorsImpl(const GAncestorBank& ancestors) override;
 
+	/**
+	 * \brief Write the process and particle name tables in text form, once at the end of the file.
+	 *
+	 * \param processes Process name table.
+	 * \param particles Particle name table.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) override;
+
 	/**
 	 * \brief Begin one run block in the text output.
 	 *
@@ -23,9 +23,11 @@ bool GstreamerTextFactory::publishRunDigitizedDataImpl(const std::string&
 		// Argument passed to getter:
 		// 0 means "do not include SRO variables".
 		for (const auto& [variableName, value] : dgtzHit->getIntObservablesMap(0)) {
+			if (!output_selection.selectsVariable(variableName)) { continue; }
 			ofile << guts::GTABTABTAB << variableName << ": " << value << "\n";
 		}
 		for (const auto& [variableName, value] : dgtzHit->getDblObservablesMap(0)) {
+			if (!output_selection.selectsVariable(variableName)) { continue; }
 			ofile << guts::GTABTABTAB << variableName << ": " << value << "\n";
 		}
 
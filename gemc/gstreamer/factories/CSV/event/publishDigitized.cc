@@ -11,27 +11,35 @@ bool GstreamerCsvFactory::publishEventDigitizedDataImpl(const std::string&
 		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, "Error: can't access ", filename_digitized());
 	}
 
-	// Emit the header row from the first non-empty detector collection so column names
-	// reflect the actual observable schema.
+	write_digitized_rows(detectorName, digitizedData);
+
+	return true;
+}
+
+// Emit the header row from the first non-empty detector collection so column names
+// reflect the actual observable schema, then write one row per digitized hit.
+// SRO variables are skipped in both, as in getIntObservablesMap(0) and getDblObservablesMap(0),
+// and so are the observables outside the output selection.
+void GstreamerCsvFactory::write_digitized_rows(const std::string&                        detectorName,
+                                               const std::vector<const GDigitizedData*>& digitizedData) {
 	if (!is_first_event_with_digidata) {
 		if (digitizedData.size() > 0) {
 			ofile_digitized << "evn, timestamp, thread_id, detector, ";
 			auto first_hit = digitizedData[0];
 
-			const auto& imap = first_hit->getIntObservablesMap(0);
-			const auto& dmap = first_hit->getDblObservablesMap(0);
+			log->debug(NORMAL, SFUNCTION_NAME, "Writing header for event ", event_number, " run ", runId);
 
-			size_t total = dmap.size();
-			size_t i     = 0;
-
-			log->debug(NORMAL, SFUNCTION_NAME, "Writing header for run ", runId, " with ", total,
-			           " variables");
+			for (const auto& id : first_hit->getIdentity()) { ofile_digitized << id.getName() << ", "; }
+			for (const auto& [name, value] : first_hit->getIntObservablesView()) {
+				if (publishes_observable(name)) { ofile_digitized << name << ", "; }
+			}
 
-			for (const auto& [name, value] : getIdentityMap(first_hit->getIdentity())) { ofile_digitized << name << ", "; }
-			for (const auto& [name, value] : imap) { ofile_digitized << name << ", "; }
-			for (const auto& [name, value] : dmap) {
+			bool first = true;
+			for (const auto& [name, value] : first_hit->getDblObservablesView()) {
+				if (!publishes_observable(name)) { continue; }
+				if (!first) { ofile_digitized << ", "; }
+				first = false;
 				ofile_digitized << name;
-				if (++i < total) ofile_digitized << ", ";
 			}
 
 			ofile_digitized << "\n";
@@ -40,26 +48,26 @@ bool GstreamerCsvFactory::publishEventDigitizedDataImpl(const std::string&
 		}
 	}
 
-	// Write one row per digitized hit.
-	if (is_first_event_with_digidata) {
-		for (auto digi_hit : digitizedData) {
-			const auto& imap = digi_hit->getIntObservablesMap(0);
-			const auto& dmap = digi_hit->getDblObservablesMap(0);
+	if (!is_first_event_with_digidata) { return; }
 
-			size_t total = dmap.size();
-			size_t i     = 0;
+	for (auto digi_hit : digitizedData) {
+		ofile_digitized << event_number << ", " << timestamp << ", " << thread_id << ", " << detectorName << ", ";
 
-			ofile_digitized << event_number << ", " << timestamp << ", " << thread_id << ", " << detectorName << ", ";
+		for (const auto& id : digi_hit->getIdentity()) { ofile_digitized << id.getValue() << ", "; }
+		for (const auto& [variableName, value] : digi_hit->getIntObservablesView()) {
+			if (publishes_observable(variableName)) { ofile_digitized << value << ", "; }
+		}
 
-			for (const auto& [name, value] : getIdentityMap(digi_hit->getIdentity())) { ofile_digitized << value << ", "; }
-			for (const auto& [variableName, value] : imap) { ofile_digitized << value << ", "; }
-			for (const auto& [variableName, value] : dmap) {
-				ofile_digitized << value;
-				if (++i < total) ofile_digitized << ", ";
-			}
-			ofile_digitized << "\n";
+		bool first = true;
+		for (const auto& [variableName, value] : digi_hit->getDblObservablesView()) {
+			if (!publishes_observable(variableName)) { continue; }
+			if (!first) { ofile_digitized << ", "; }
+			first = false;
+			ofile_digitized << value;
 		}
+		ofile_digitized << "\n";
 	}
-
-	return true;
-}
\ No newline at end of file
+	if (!ofile_digitized.flush_if_full()) {
+		log->error(gstreamer::ERR_CANTWRITEOUTPUT, SFUNCTION_NAME, " could not write to file ", filename_digitized());
+	}
+}
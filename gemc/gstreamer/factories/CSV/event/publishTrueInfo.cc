@@ -12,27 +12,29 @@ bool GstreamerCsvFactory::publishEventTrueInfoDataImpl(const std::string&
 	}
 
 	// Emit the header row from the first non-empty detector collection so column names
-	// reflect the actual variable schema.
+	// reflect the actual variable schema, restricted to the selected variables.
 	if (!is_first_event_with_truedata) {
 		if (trueInfoData.size() > 0) {
 			ofile_true_info << "evn, timestamp, thread_id, detector, ";
 			auto first_hit = trueInfoData[0];
 
-			const auto& smap = first_hit->getStringVariablesMap();
-			const auto& dmap = first_hit->getDoubleVariablesMap();
+			const auto& smap = first_hit->getStringVariablesView();
+			const auto& dmap = first_hit->getDoubleVariablesView();
 
-			size_t total = dmap.size();
-			size_t i     = 0;
-
-			log->debug(NORMAL, SFUNCTION_NAME, "Writing header for event ", event_number, " with ", total,
+			log->debug(NORMAL, SFUNCTION_NAME, "Writing header for event ", event_number, " with ", dmap.size(),
 			           " variables");
 
-			for (const auto& [name, value] : getIdentityMap(first_hit->getIdentity())) { ofile_true_info << name << ", "; }
-			for (const auto& [name, value] : smap) { ofile_true_info << name << ", "; }
+			for (const auto& id : first_hit->getIdentity()) { ofile_true_info << id.getName() << ", "; }
+			for (const auto& [name, value] : smap) {
+				if (output_selection.selectsVariable(name)) { ofile_true_info << name << ", "; }
+			}
 
+			bool first = true;
 			for (const auto& [name, value] : dmap) {
+				if (!output_selection.selectsVariable(name)) { continue; }
+				if (!first) { ofile_true_info << ", "; }
+				first = false;
 				ofile_true_info << name;
-				if (++i < total) ofile_true_info << ", ";
 			}
 
 			ofile_true_info << "\n";
@@ -44,23 +46,29 @@ bool GstreamerCsvFactory::publishEventTrueInfoDataImpl(const std::string&
 	// Write one row per true-information hit.
 	if (is_first_event_with_truedata) {
 		for (auto trueInfoHit : trueInfoData) {
-			const auto& smap = trueInfoHit->getStringVariablesMap();
-			const auto& dmap = trueInfoHit->getDoubleVariablesMap();
-
-			size_t total = dmap.size();
-			size_t i     = 0;
+			const auto& smap = trueInfoHit->getStringVariablesView();
+			const auto& dmap = trueInfoHit->getDoubleVariablesView();
 
 			ofile_true_info << event_number << ", " << timestamp << ", " << thread_id << ", " << detectorName << ", ";
 
-			for (const auto& [name, value] : getIdentityMap(trueInfoHit->getIdentity())) { ofile_true_info << value << ", "; }
-			for (const auto& [variableName, value] : smap) { ofile_true_info << value << ", "; }
+			for (const auto& id : trueInfoHit->getIdentity()) { ofile_true_info << id.getValue() << ", "; }
+			for (const auto& [variableName, value] : smap) {
+				if (output_selection.selectsVariable(variableName)) { ofile_true_info << value << ", "; }
+			}
+
+			bool first = true;
 			for (const auto& [variableName, value] : dmap) {
+				if (!output_selection.selectsVariable(variableName)) { continue; }
+				if (!first) { ofile_true_info << ", "; }
+				first = false;
 				ofile_true_info << value;
-				if (++i < total) ofile_true_info << ", ";
 			}
 			ofile_true_info << "\n";
 		}
+		if (!ofile_true_info.flush_if_full()) {
+			log->error(gstreamer::ERR_CANTWRITEOUTPUT, SFUNCTION_NAME, " could not write to file ", filename_true_info());
+		}
 	}
 
 	return true;
-}
\ No newline at end of file
+}
@@ -3,7 +3,7 @@
 #include "gstreamerConventions.h"
 
 // Implementation summary:
-// Manage the lifetime of the two CSV streams used by the plugin.
+// Manage the lifetime of the buffered CSV outputs used by the plugin.
 
 bool GstreamerCsvFactory::openConnection() {
 	// Both streams must be open for the CSV backend to operate correctly.
@@ -13,10 +13,7 @@ bool GstreamerCsvFactory::openConnection() {
 	}
 
 	if (!ofile_true_info.is_open()) {
-		ofile_true_info.clear();
-		ofile_true_info.open(filename_true_info(), std::ios::out | std::ios::trunc);
-
-		if (!ofile_true_info.is_open() || !ofile_true_info) {
+		if (!ofile_true_info.open(filename_true_info())) {
 			log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename_true_info());
 		}
 
@@ -24,10 +21,7 @@ bool GstreamerCsvFactory::openConnection() {
 	}
 
 	if (!ofile_digitized.is_open()) {
-		ofile_digitized.clear();
-		ofile_digitized.open(filename_digitized(), std::ios::out | std::ios::trunc);
-
-		if (!ofile_digitized.is_open() || !ofile_digitized) {
+		if (!ofile_digitized.open(filename_digitized())) {
 			log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename_digitized());
 		}
 
@@ -35,9 +29,7 @@ bool GstreamerCsvFactory::openConnection() {
 	}
 
 	if (!ofile_generated.is_open()) {
-		ofile_generated.clear();
-		ofile_generated.open(filename_generated(), std::ios::out | std::ios::trunc);
-		if (!ofile_generated.is_open() || !ofile_generated) {
+		if (!ofile_generated.open(filename_generated())) {
 			log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename_generated());
 		}
 		ofile_generated << "evn, timestamp, thread_id, bank, name, pid, type, multiplicity, p, theta, phi, vx, vy, vz\n";
@@ -45,9 +37,7 @@ bool GstreamerCsvFactory::openConnection() {
 	}
 
 	if (!ofile_generated_tracked.is_open()) {
-		ofile_generated_tracked.clear();
-		ofile_generated_tracked.open(filename_generated_tracked(), std::ios::out | std::ios::trunc);
-		if (!ofile_generated_tracked.is_open() || !ofile_generated_tracked) {
+		if (!ofile_generated_tracked.open(filename_generated_tracked())) {
 			log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ",
 			           filename_generated_tracked());
 		}
@@ -62,28 +52,20 @@ bool GstreamerCsvFactory::closeConnectionImpl() {
 	// The public closeConnection() wrapper already flushes buffered events before this method runs.
 	const bool had_ancestor_stream = ofile_ancestors.is_open();
 
-	if (ofile_true_info.is_open()) ofile_true_info.close();
-	if (ofile_digitized.is_open()) ofile_digitized.close();
-	if (ofile_generated.is_open()) ofile_generated.close();
-	if (ofile_generated_tracked.is_open()) ofile_generated_tracked.close();
-	if (ofile_ancestors.is_open()) ofile_ancestors.close();
+	// A reopened output, for example the next rotated file, starts with its own header rows.
+	is_first_event_with_truedata = false;
+	is_first_event_with_digidata = false;
 
-	if (ofile_true_info.is_open()) {
-		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not close file " + filename_true_info());
-	}
-	if (ofile_digitized.is_open()) {
-		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not close file " + filename_digitized());
-	}
-	if (ofile_generated.is_open()) {
-		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not close file " + filename_generated());
-	}
-	if (ofile_generated_tracked.is_open()) {
-		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME,
-		           " could not close file " + filename_generated_tracked());
-	}
-	if (ofile_ancestors.is_open()) {
-		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not close file " + filename_ancestors());
-	}
+	auto close_file = [this](gstreamer::GTextFile& file, const std::string& name) {
+		if (!file.close()) {
+			log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not write or close file " + name);
+		}
+	};
+	close_file(ofile_true_info, filename_true_info());
+	close_file(ofile_digitized, filename_digitized());
+	close_file(ofile_generated, filename_generated());
+	close_file(ofile_generated_tracked, filename_generated_tracked());
+	close_file(ofile_ancestors, filename_ancestors());
 
 	log->info(1, SFUNCTION_NAME, "GstreamerCsvFactory: closed file " + filename_true_info());
 	log->info(1, SFUNCTION_NAME, "GstreamerCsvFactory: closed file " + filename_digitized());
@@ -96,7 +78,12 @@ bool GstreamerCsvFactory::closeConnectionImpl() {
 	return true;
 }
 
-std::ofstream& GstreamerCsvFactory::generated_stream_for_bank(const std::string& bankName) {
+std::uint64_t GstreamerCsvFactory::outputBytes() {
+	return ofile_true_info.bytes() + ofile_digitized.bytes() + ofile_generated.bytes() +
+		ofile_generated_tracked.bytes() + ofile_ancestors.bytes();
+}
+
+gstreamer::GTextFile& GstreamerCsvFactory::generated_stream_for_bank(const std::string& bankName) {
 	return bankName == "generated_tracked" ? ofile_generated_tracked : ofile_generated;
 }
 
@@ -120,14 +107,17 @@ bool GstreamerCsvFactory::publishEventGeneratedParticlesImpl(const std::string&
 		       << particle.vy << ", "
 		       << particle.vz << "\n";
 	}
+	if (!stream.flush_if_full()) {
+		log->error(gstreamer::ERR_CANTWRITEOUTPUT, SFUNCTION_NAME, " could not write to file ",
+		           bankName == "generated_tracked" ? filename_generated_tracked() : filename_generated());
+	}
 
 	return true;
 }
 
 bool GstreamerCsvFactory::publishEventAncestorsImpl(const GAncestorBank& ancestors) {
 	if (!ofile_ancestors.is_open()) {
-		ofile_ancestors.open(filename_ancestors(), std::ios::out | std::ios::trunc);
-		if (!ofile_ancestors.is_open() || !ofile_ancestors) {
+		if (!ofile_ancestors.open(filename_ancestors())) {
 			log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename_ancestors());
 		}
 		ofile_ancestors << "evn, timestamp, thread_id, pid, tid, mtid, trackE, px, py, pz, vx, vy, vz\n";
@@ -140,5 +130,26 @@ bool GstreamerCsvFactory::publishEventAncestorsImpl(const GAncestorBank& ancesto
 		                << ancestor.pz << ", " << ancestor.vx << ", " << ancestor.vy << ", "
 		                << ancestor.vz << "\n";
 	}
+	if (!ofile_ancestors.flush_if_full()) {
+		log->error(gstreamer::ERR_CANTWRITEOUTPUT, SFUNCTION_NAME, " could not write to file ", filename_ancestors());
+	}
+	return true;
+}
+
+bool GstreamerCsvFactory::publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) {
+	gstreamer::GTextFile ofile_names;
+	if (!ofile_names.open(filename_names())) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename_names());
+	}
+
+	ofile_names << "table, id, name\n";
+	for (const auto& [tableName, table] : {std::pair{"process", &processes}, std::pair{"particle", &particles}}) {
+		for (const auto& [id, name] : table->entries()) { ofile_names << tableName << ", " << id << ", " << name << "\n"; }
+	}
+	if (!ofile_names.close()) {
+		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not write or close file ", filename_names());
+	}
+
+	log->info(1, SFUNCTION_NAME, "GstreamerCsvFactory: wrote file " + filename_names());
 	return true;
 }
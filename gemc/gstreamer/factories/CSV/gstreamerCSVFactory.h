@@ -2,9 +2,7 @@
 
 // gstreamer
 #include "gstreamer.h"
-
-// c++
-#include <fstream>
+#include "gstreamerTextOutput.h"
 
 /**
  * \file gstreamerCSVFactory.h
@@ -36,6 +34,9 @@
  *
  * Run-mode digitized rows reuse the same flattened output strategy for run collections.
  *
+ * Rows are formatted into gstreamer::GTextFile buffers: numbers are locale independent, doubles are
+ * written in their shortest round-trip form, and each file receives its data in large chunks.
+ *
  * Threading model:
  * - one instance per worker thread is the intended usage
  * - copy and move are disabled to avoid accidental sharing of streams and cached state
@@ -66,6 +67,9 @@ private:
 	 */
 	bool closeConnectionImpl() override;
 
+	/// \brief Bytes written to all the CSV files of the current output, including buffered rows.
+	std::uint64_t outputBytes() override;
+
 	/**
 	 * \brief Begin one event publication cycle.
 	 *
@@ -130,6 +134,15 @@ private:
 	/** \brief Write the event ancestor bank into its CSV file. */
 	bool publishEventAncestorsImpl(const GAncestorBank& ancestors) override;
 
+	/**
+	 * \brief Write the process and particle name tables into their own CSV file.
+	 *
+	 * \param processes Process name table.
+	 * \param particles Particle name table.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) override;
+
 	/**
 	 * \brief Begin one run publication cycle.
 	 *
@@ -196,20 +209,20 @@ private:
 	 */
 	bool publishPayloadImpl(const std::vector<GIntegralPayload*>* payload) override;
 
-	/// \brief Output stream for the true-information CSV file.
-	std::ofstream ofile_true_info;
+	/// \brief Buffered output for the true-information CSV file.
+	gstreamer::GTextFile ofile_true_info;
 
-	/// \brief Output stream for the digitized CSV file.
-	std::ofstream ofile_digitized;
+	/// \brief Buffered output for the digitized CSV file.
+	gstreamer::GTextFile ofile_digitized;
 
-	/// \brief Output stream for the full generated-particle CSV file.
-	std::ofstream ofile_generated;
+	/// \brief Buffered output for the full generated-particle CSV file.
+	gstreamer::GTextFile ofile_generated;
 
-	/// \brief Output stream for the Geant4-tracked generated-particle CSV file.
-	std::ofstream ofile_generated_tracked;
+	/// \brief Buffered output for the Geant4-tracked generated-particle CSV file.
+	gstreamer::GTextFile ofile_generated_tracked;
 
-	/// \brief Lazily opened output stream for the ancestor CSV file.
-	std::ofstream ofile_ancestors;
+	/// \brief Lazily opened buffered output for the ancestor CSV file.
+	gstreamer::GTextFile ofile_ancestors;
 
 	/**
 	 * \brief Return the generic filename base for this plugin.
@@ -256,13 +269,31 @@ private:
 		return gstreamer_definitions.rootname + "_ancestors.csv";
 	}
 
+	/** \brief Return the name-table CSV filename. */
+	[[nodiscard]] std::string filename_names() const { return gstreamer_definitions.rootname + "_names.csv"; }
+
 	/**
 	 * \brief Selects the generated-particle CSV stream for a bank name.
 	 *
 	 * \param bankName Generated-particle bank name.
 	 * \return Output stream associated with the bank.
 	 */
-	std::ofstream& generated_stream_for_bank(const std::string& bankName);
+	gstreamer::GTextFile& generated_stream_for_bank(const std::string& bankName);
+
+	/**
+	 * \brief Writes the digitized header row, once, and one row per hit.
+	 *
+	 * Shared by the event and run publish paths.
+	 *
+	 * \param detectorName Detector the hits belong to.
+	 * \param digitizedData Hits to write.
+	 */
+	void write_digitized_rows(const std::string& detectorName, const std::vector<const GDigitizedData*>& digitizedData);
+
+	/// \brief Whether a digitized observable gets a column: SRO variables and unselected observables do not.
+	[[nodiscard]] bool publishes_observable(const std::string& name) const {
+		return GDigitizedData::validVarName(name, 0) && output_selection.selectsVariable(name);
+	}
 
 	/// \brief Tracks whether the true-information CSV header row has already been emitted.
 	bool is_first_event_with_truedata = false;
@@ -0,0 +1,22 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+#include "gstreamerConventions.h"
+
+// Implementation summary:
+// Cache the event number for the event tables and write the tables that filled a chunk.
+
+bool GstreamerGbinFactory::startEventImpl(const std::shared_ptr<GEventDataCollection>& event_data) {
+	if (!ofile.is_open()) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, "Error: can't access ", filename());
+	}
+
+	event_number = event_data->getHeader()->getG4LocalEvn();
+
+	return true;
+}
+
+
+bool GstreamerGbinFactory::endEventImpl([[maybe_unused]] const std::shared_ptr<GEventDataCollection>& event_data) {
+	writeChunks(GBIN_CHUNK_BYTES);
+	return true;
+}
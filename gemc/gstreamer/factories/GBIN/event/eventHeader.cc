@@ -0,0 +1,20 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+
+// Implementation summary:
+// Append one row per event to the header table.
+
+bool GstreamerGbinFactory::publishEventHeaderImpl(const std::unique_ptr<GEventHeader>& gevent_header) {
+	auto& table = getOrInstantiateBankTable(gstreamer::gbin::TableKind::header, "header");
+
+	// Columns: evn, thread_id, seed1, seed2, replayed_evn, timestamp.
+	table.newRow();
+	table.set(0, event_number);
+	table.set(1, static_cast<std::int64_t>(gevent_header->getThreadID()));
+	table.set(2, static_cast<std::int64_t>(gevent_header->getRandomSeeds()[0]));
+	table.set(3, static_cast<std::int64_t>(gevent_header->getRandomSeeds()[1]));
+	table.set(4, static_cast<std::int64_t>(gevent_header->getReplayedEvent()));
+	table.set(5, std::string_view(gevent_header->getTimeStamp()));
+
+	return true;
+}
@@ -0,0 +1,34 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+#include "gstreamerConventions.h"
+
+// Implementation summary:
+// Append detector digitized hits to their gbin table, for event and run publication alike.
+
+bool GstreamerGbinFactory::publishEventDigitizedDataImpl(const std::string&                        detectorName,
+                                                         const std::vector<const GDigitizedData*>& digitizedData) {
+	fillDigitizedTable(gstreamer::gbin::TableKind::digitized, detectorName, event_number, digitizedData);
+	return true;
+}
+
+// All observables are written, SRO variables included, as in the ROOT backend.
+void GstreamerGbinFactory::fillDigitizedTable(gstreamer::gbin::TableKind kind, const std::string& detectorName,
+                                              std::int64_t key,
+                                              const std::vector<const GDigitizedData*>& digitizedData) {
+	if (digitizedData.empty()) { return; }
+
+	const auto& detector = getOrInstantiateDigitizedTable(kind, detectorName, digitizedData.front());
+	auto&       table    = *detector.table;
+
+	for (const auto* hit : digitizedData) {
+		table.newRow();
+		table.set(0, key);
+
+		const auto& identity = hit->getIdentity();
+		for (std::size_t i = 0; i < detector.nIdentity && i < identity.size(); i++) {
+			table.set(1 + i, static_cast<std::int64_t>(identity[i].getValue()));
+		}
+		table.fillSorted(detector.first, detector.nFirst, hit->getIntObservablesView());
+		table.fillSorted(detector.second, detector.nSecond, hit->getDblObservablesView());
+	}
+}
@@ -0,0 +1,95 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+#include "gstreamerConventions.h"
+
+// Implementation summary:
+// Append detector true-information hits, generated particles, and ancestors to their gbin tables.
+
+bool GstreamerGbinFactory::publishEventTrueInfoDataImpl(const std::string&                       detectorName,
+                                                        const std::vector<const GTrueInfoData*>& trueInfoData) {
+	if (trueInfoData.empty()) { return true; }
+
+	const auto& detector = getOrInstantiateTrueInfoTable(detectorName, trueInfoData.front());
+	auto&       table    = *detector.table;
+
+	for (const auto* hit : trueInfoData) {
+		table.newRow();
+		table.set(0, event_number);
+
+		const auto& identity = hit->getIdentity();
+		for (std::size_t i = 0; i < detector.nIdentity && i < identity.size(); i++) {
+			table.set(1 + i, static_cast<std::int64_t>(identity[i].getValue()));
+		}
+		table.fillSorted(detector.first, detector.nFirst, hit->getDoubleVariablesView());
+		table.fillSorted(detector.second, detector.nSecond, hit->getStringVariablesView());
+	}
+
+	return true;
+}
+
+bool GstreamerGbinFactory::publishEventGeneratedParticlesImpl(const std::string&            bankName,
+                                                              const GGeneratedParticleBank& particles) {
+	const auto kind = bankName == "generated_tracked" ? gstreamer::gbin::TableKind::generated_tracked
+	                                                  : gstreamer::gbin::TableKind::generated;
+	auto& table = getOrInstantiateBankTable(kind, bankName);
+
+	// Columns: evn, name, pid, type, multiplicity, p, theta, phi, vx, vy, vz.
+	for (const auto& particle : particles) {
+		table.newRow();
+		table.set(0, event_number);
+		table.set(1, std::string_view(particle.name));
+		table.set(2, static_cast<std::int64_t>(particle.pid));
+		table.set(3, static_cast<std::int64_t>(particle.type));
+		table.set(4, static_cast<std::int64_t>(particle.multiplicity));
+		table.set(5, particle.p);
+		table.set(6, particle.theta);
+		table.set(7, particle.phi);
+		table.set(8, particle.vx);
+		table.set(9, particle.vy);
+		table.set(10, particle.vz);
+	}
+
+	return true;
+}
+
+bool GstreamerGbinFactory::publishEventAncestorsImpl(const GAncestorBank& ancestors) {
+	auto& table = getOrInstantiateBankTable(gstreamer::gbin::TableKind::ancestors, "ancestors");
+
+	// Columns: evn, pid, tid, mtid, trackE, px, py, pz, vx, vy, vz.
+	for (const auto& ancestor : ancestors) {
+		table.newRow();
+		table.set(0, event_number);
+		table.set(1, static_cast<std::int64_t>(ancestor.pid));
+		table.set(2, static_cast<std::int64_t>(ancestor.tid));
+		table.set(3, static_cast<std::int64_t>(ancestor.mtid));
+		table.set(4, ancestor.trackE);
+		table.set(5, ancestor.px);
+		table.set(6, ancestor.py);
+		table.set(7, ancestor.pz);
+		table.set(8, ancestor.vx);
+		table.set(9, ancestor.vy);
+		table.set(10, ancestor.vz);
+	}
+
+	return true;
+}
+
+bool GstreamerGbinFactory::publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) {
+	auto& table = newTable(gstreamer::gbin::TableKind::names, "names", [](GBinTable& t) {
+		t.addColumn("table", gstreamer::gbin::ColumnType::string);
+		t.addColumn("id", gstreamer::gbin::ColumnType::int64);
+		t.addColumn("name", gstreamer::gbin::ColumnType::string);
+	});
+
+	// The rows are written with the remaining chunks when the file is closed.
+	for (const auto& [tableName, nameTable] : {std::pair{"process", &processes}, std::pair{"particle", &particles}}) {
+		for (const auto& [id, name] : nameTable->entries()) {
+			table.newRow();
+			table.set(0, std::string_view(tableName));
+			table.set(1, static_cast<std::int64_t>(id));
+			table.set(2, std::string_view(name));
+		}
+	}
+
+	return true;
+}
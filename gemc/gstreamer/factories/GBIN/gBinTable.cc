@@ -0,0 +1,117 @@
+// gstreamer
+#include "gBinTable.h"
+
+// Implementation summary:
+// Column buffers of one gbin table and their serialization as schema and chunk records.
+
+using gstreamer::gbin::ColumnType;
+
+namespace {
+
+constexpr char zeros[gstreamer::gbin::ALIGNMENT] = {};
+
+void writeBytes(std::ofstream& out, const void* data, std::uint64_t bytes) {
+	out.write(static_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+}
+
+template <typename T>
+void writeValue(std::ofstream& out, T value) { writeBytes(out, &value, sizeof(T)); }
+
+void writePadding(std::ofstream& out, std::uint64_t bytes) {
+	writeBytes(out, zeros, gstreamer::gbin::padded(bytes) - bytes);
+}
+
+void writeName(std::ofstream& out, const std::string& name) {
+	writeValue(out, static_cast<std::uint32_t>(name.size()));
+	writeBytes(out, name.data(), name.size());
+}
+
+void writeRecordHeader(std::ofstream& out, gstreamer::gbin::RecordKind kind, std::uint32_t table,
+                       std::uint64_t payload) {
+	const gstreamer::gbin::RecordHeader header{static_cast<std::uint32_t>(kind), table,
+	                                           gstreamer::gbin::padded(payload)};
+	writeValue(out, header);
+}
+
+} // namespace
+
+std::size_t GBinTable::addColumn(const std::string& columnName, ColumnType type) {
+	auto& column = columns.emplace_back();
+	column.name  = columnName;
+	column.type  = type;
+	return columns.size() - 1;
+}
+
+void GBinTable::newRow() {
+	for (auto& column : columns) {
+		switch (column.type) {
+		case ColumnType::int64: column.ints.push_back(0);
+			break;
+		case ColumnType::float64: column.doubles.push_back(0);
+			break;
+		case ColumnType::string: column.offsets.push_back(column.chars.size());
+			break;
+		}
+	}
+	rows++;
+}
+
+void GBinTable::set(std::size_t column, std::string_view value) {
+	auto& target = columns[column];
+	target.chars.append(value);
+	target.offsets.back() = target.chars.size();
+}
+
+std::uint64_t GBinTable::bufferedBytes() const {
+	std::uint64_t bytes = 0;
+	for (const auto& column : columns) {
+		bytes += column.type == ColumnType::string ? column.offsets.size() * 8 + column.chars.size() : rows * 8;
+	}
+	return bytes;
+}
+
+void GBinTable::writeSchema(std::ofstream& out) const {
+	std::uint64_t payload = 4 + 4 + 4 + name.size();
+	for (const auto& column : columns) { payload += 4 + 4 + column.name.size(); }
+
+	writeRecordHeader(out, gstreamer::gbin::RecordKind::schema, id, payload);
+	writeValue(out, static_cast<std::uint32_t>(kind));
+	writeValue(out, static_cast<std::uint32_t>(columns.size()));
+	writeName(out, name);
+	for (const auto& column : columns) {
+		writeValue(out, static_cast<std::uint32_t>(column.type));
+		writeName(out, column.name);
+	}
+	writePadding(out, payload);
+}
+
+void GBinTable::writeChunk(std::ofstream& out) {
+	if (rows == 0) { return; }
+
+	std::uint64_t payload = 8;
+	for (const auto& column : columns) {
+		payload += column.type == ColumnType::string ? column.offsets.size() * 8 + gstreamer::gbin::padded(column.chars.size())
+		                                             : rows * 8;
+	}
+
+	// Every column is a multiple of 8 bytes, so no padding is needed beyond the string blocks.
+	writeRecordHeader(out, gstreamer::gbin::RecordKind::chunk, id, payload);
+	writeValue(out, static_cast<std::uint64_t>(rows));
+	for (auto& column : columns) {
+		switch (column.type) {
+		case ColumnType::int64: writeBytes(out, column.ints.data(), rows * 8);
+			column.ints.clear();
+			break;
+		case ColumnType::float64: writeBytes(out, column.doubles.data(), rows * 8);
+			column.doubles.clear();
+			break;
+		case ColumnType::string: writeBytes(out, column.offsets.data(), column.offsets.size() * 8);
+			writeBytes(out, column.chars.data(), column.chars.size());
+			writePadding(out, column.chars.size());
+			column.offsets.assign(1, 0);
+			column.chars.clear();
+			break;
+		}
+	}
+	rows = 0;
+}
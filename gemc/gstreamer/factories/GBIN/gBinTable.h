@@ -0,0 +1,129 @@
+#pragma once
+
+// gstreamer
+#include "gstreamerGbinFormat.h"
+
+// c++
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * \file gBinTable.h
+ * \brief Column buffers of one table written by the gbin streamer plugin.
+ * \ingroup gstreamer_plugin_gbin_api
+ */
+
+/**
+ * \class GBinTable
+ * \ingroup gstreamer_plugin_gbin_api
+ * \brief Accumulates rows of one gbin table column by column and writes them as chunk records.
+ *
+ * Columns are declared before the first row and do not change afterwards. Each newRow() appends a
+ * default value (0, 0.0, or an empty string) to every column; the set() and fill helpers then
+ * overwrite the values of the new row, so variables missing from a hit stay at their default.
+ *
+ * Rows stay in memory until writeChunk() hands every column to the file in a single unformatted
+ * write, after which the buffers are cleared but keep their capacity.
+ */
+class GBinTable
+{
+public:
+	/**
+	 * \param tableId Table id referenced by the records of this table.
+	 * \param tableKind Origin of the rows.
+	 * \param tableName Detector or bank name.
+	 */
+	GBinTable(std::uint32_t tableId, gstreamer::gbin::TableKind tableKind, std::string tableName) :
+		id(tableId), kind(tableKind), name(std::move(tableName)) {
+	}
+
+	/**
+	 * \brief Declares a column. Only allowed before the first row.
+	 *
+	 * \return Index of the column.
+	 */
+	std::size_t addColumn(const std::string& columnName, gstreamer::gbin::ColumnType type);
+
+	/**
+	 * \brief Declares one column per key of \p values accepted by \p keep, in key order.
+	 *
+	 * \return Index of the first column of the block; the block ends at columnCount().
+	 */
+	template <typename T, typename Keep>
+	std::size_t addColumns(const std::map<std::string, T>& values, gstreamer::gbin::ColumnType type, Keep keep) {
+		const auto first = columns.size();
+		for (const auto& [key, value] : values) {
+			if (keep(key)) { addColumn(key, type); }
+		}
+		return first;
+	}
+
+	/// \brief Appends a row holding default values in every column.
+	void newRow();
+
+	void set(std::size_t column, std::int64_t value) { columns[column].ints.back() = value; }
+
+	void set(std::size_t column, double value) { columns[column].doubles.back() = value; }
+
+	/// \brief Sets a string value of the current row. Each string column accepts one set() per row.
+	void set(std::size_t column, std::string_view value);
+
+	/**
+	 * \brief Sets the current row from a name-sorted map, for a block of columns declared with addColumns().
+	 *
+	 * Columns and map keys are both sorted by name, so they are matched in one lockstep pass. Keys
+	 * absent from the schema are ignored.
+	 *
+	 * \param first Index of the first column of the block.
+	 * \param count Number of columns in the block.
+	 * \param values Values of the current hit.
+	 */
+	template <typename T>
+	void fillSorted(std::size_t first, std::size_t count, const std::map<std::string, T>& values) {
+		auto value = values.begin();
+		for (std::size_t c = first; c < first + count && value != values.end(); c++) {
+			while (value != values.end() && value->first < columns[c].name) { ++value; }
+			if (value != values.end() && value->first == columns[c].name) {
+				if constexpr (std::is_same_v<T, std::string>) { set(c, std::string_view(value->second)); }
+				else if constexpr (std::is_floating_point_v<T>) { set(c, static_cast<double>(value->second)); }
+				else { set(c, static_cast<std::int64_t>(value->second)); }
+				++value;
+			}
+		}
+	}
+
+	/// \brief Writes the schema record declaring this table.
+	void writeSchema(std::ofstream& out) const;
+
+	/// \brief Writes the buffered rows as one chunk record, if any, and clears the buffers.
+	void writeChunk(std::ofstream& out);
+
+	/// \brief Bytes of column data currently buffered.
+	[[nodiscard]] std::uint64_t bufferedBytes() const;
+
+	[[nodiscard]] std::size_t columnCount() const { return columns.size(); }
+
+	[[nodiscard]] std::size_t bufferedRows() const { return rows; }
+
+private:
+	struct Column
+	{
+		std::string                 name;
+		gstreamer::gbin::ColumnType type;
+		std::vector<std::int64_t>   ints;
+		std::vector<double>         doubles;
+		std::vector<std::uint64_t>  offsets{0}; ///< string columns: rows + 1 offsets into chars
+		std::string                 chars;
+	};
+
+	std::uint32_t              id;
+	gstreamer::gbin::TableKind kind;
+	std::string                name;
+	std::vector<Column>        columns;
+	std::size_t                rows = 0;
+};
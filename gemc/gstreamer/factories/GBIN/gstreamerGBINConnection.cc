@@ -0,0 +1,58 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+#include "gstreamerConventions.h"
+
+// c++
+#include <cstring>
+
+// Implementation summary:
+// Manage the lifetime of the gbin output file: file header on open, remaining chunks on close.
+
+bool GstreamerGbinFactory::openConnection() {
+	if (ofile.is_open()) { return true; }
+
+	ofile.clear();
+	ofile.open(filename(), std::ios::out | std::ios::trunc | std::ios::binary);
+	if (!ofile.is_open() || !ofile) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename());
+	}
+
+	gstreamer::gbin::FileHeader header{};
+	std::memcpy(header.magic, gstreamer::gbin::MAGIC, sizeof(header.magic));
+	header.version   = gstreamer::gbin::FORMAT_VERSION;
+	header.byteOrder = gstreamer::gbin::BYTE_ORDER_MARK;
+	ofile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	if (!ofile) {
+		log->error(gstreamer::ERR_CANTWRITEOUTPUT, SFUNCTION_NAME, " could not write the gbin header to ", filename());
+	}
+
+	log->info(1, SFUNCTION_NAME, "GstreamerGbinFactory: opened file " + filename());
+
+	return true;
+}
+
+bool GstreamerGbinFactory::closeConnectionImpl() {
+	// The public closeConnection() wrapper already flushes buffered events before this method runs.
+	if (!ofile.is_open()) { return true; }
+
+	writeChunks(0);
+	ofile.close();
+
+	if (ofile.fail()) {
+		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not close file ", filename());
+	}
+
+	tables.clear();
+	bankTables.clear();
+	detectorTables.clear();
+
+	log->info(1, SFUNCTION_NAME, "GstreamerGbinFactory: closed file " + filename());
+
+	return true;
+}
+
+std::uint64_t GstreamerGbinFactory::outputBytes() {
+	std::uint64_t bytes = ofile.is_open() ? static_cast<std::uint64_t>(ofile.tellp()) : 0;
+	for (const auto& table : tables) { bytes += table->bufferedBytes(); }
+	return bytes;
+}
@@ -0,0 +1,106 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+#include "gstreamerConventions.h"
+
+// Implementation summary:
+// Create gbin tables on first use and export the factory symbol required by the plugin loader.
+
+using gstreamer::gbin::ColumnType;
+using gstreamer::gbin::TableKind;
+
+namespace {
+
+std::string detectorTableKey(TableKind kind, const std::string& detectorName) {
+	return std::to_string(static_cast<std::uint32_t>(kind)) + ":" + detectorName;
+}
+
+} // namespace
+
+extern "C" GStreamer* GStreamerFactory(const std::shared_ptr<GOptions>& g) {
+	return static_cast<GStreamer*>(new GstreamerGbinFactory(g));
+}
+
+GBinTable& GstreamerGbinFactory::newTable(TableKind kind, const std::string& name,
+                                          const std::function<void(GBinTable&)>& declareColumns) {
+	auto& table = tables.emplace_back(std::make_unique<GBinTable>(static_cast<std::uint32_t>(tables.size()), kind, name));
+	declareColumns(*table);
+	table->writeSchema(ofile);
+
+	log->info(2, SFUNCTION_NAME, "GstreamerGbinFactory: created table ", name, " with ", table->columnCount(),
+	          " columns in ", filename());
+	return *table;
+}
+
+GBinTable& GstreamerGbinFactory::getOrInstantiateBankTable(TableKind kind, const std::string& name) {
+	if (const auto existing = bankTables.find(kind); existing != bankTables.end()) { return *existing->second; }
+
+	auto& table = newTable(kind, name, [kind](GBinTable& t) {
+		t.addColumn("evn", ColumnType::int64);
+		switch (kind) {
+		case TableKind::header:
+			for (const auto* column : {"thread_id", "seed1", "seed2", "replayed_evn"}) { t.addColumn(column, ColumnType::int64); }
+			t.addColumn("timestamp", ColumnType::string);
+			break;
+		case TableKind::ancestors:
+			for (const auto* column : {"pid", "tid", "mtid"}) { t.addColumn(column, ColumnType::int64); }
+			for (const auto* column : {"trackE", "px", "py", "pz", "vx", "vy", "vz"}) {
+				t.addColumn(column, ColumnType::float64);
+			}
+			break;
+		default:
+			t.addColumn("name", ColumnType::string);
+			for (const auto* column : {"pid", "type", "multiplicity"}) { t.addColumn(column, ColumnType::int64); }
+			for (const auto* column : {"p", "theta", "phi", "vx", "vy", "vz"}) {
+				t.addColumn(column, ColumnType::float64);
+			}
+		}
+	});
+	bankTables[kind] = &table;
+	return table;
+}
+
+const GstreamerGbinFactory::DetectorTable& GstreamerGbinFactory::getOrInstantiateTrueInfoTable(
+	const std::string& detectorName, const GTrueInfoData* firstHit) {
+	const auto key = detectorTableKey(TableKind::trueInfo, detectorName);
+	if (const auto existing = detectorTables.find(key); existing != detectorTables.end()) { return existing->second; }
+
+	const auto selected = [this](const std::string& name) { return output_selection.selectsVariable(name); };
+
+	DetectorTable entry;
+	entry.table = &newTable(TableKind::trueInfo, detectorName, [&](GBinTable& t) {
+		t.addColumn("evn", ColumnType::int64);
+		for (const auto& id : firstHit->getIdentity()) { t.addColumn(id.getName(), ColumnType::int64); }
+		entry.nIdentity = firstHit->getIdentity().size();
+		entry.first     = t.addColumns(firstHit->getDoubleVariablesView(), ColumnType::float64, selected);
+		entry.nFirst    = t.columnCount() - entry.first;
+		entry.second    = t.addColumns(firstHit->getStringVariablesView(), ColumnType::string, selected);
+		entry.nSecond   = t.columnCount() - entry.second;
+	});
+	return detectorTables[key] = entry;
+}
+
+const GstreamerGbinFactory::DetectorTable& GstreamerGbinFactory::getOrInstantiateDigitizedTable(
+	TableKind kind, const std::string& detectorName, const GDigitizedData* firstHit) {
+	const auto key = detectorTableKey(kind, detectorName);
+	if (const auto existing = detectorTables.find(key); existing != detectorTables.end()) { return existing->second; }
+
+	const auto selected = [this](const std::string& name) { return output_selection.selectsVariable(name); };
+
+	DetectorTable entry;
+	entry.table = &newTable(kind, detectorName, [&](GBinTable& t) {
+		t.addColumn(kind == TableKind::runDigitized ? "run" : "evn", ColumnType::int64);
+		for (const auto& id : firstHit->getIdentity()) { t.addColumn(id.getName(), ColumnType::int64); }
+		entry.nIdentity = firstHit->getIdentity().size();
+		entry.first     = t.addColumns(firstHit->getIntObservablesView(), ColumnType::int64, selected);
+		entry.nFirst    = t.columnCount() - entry.first;
+		entry.second    = t.addColumns(firstHit->getDblObservablesView(), ColumnType::float64, selected);
+		entry.nSecond   = t.columnCount() - entry.second;
+	});
+	return detectorTables[key] = entry;
+}
+
+void GstreamerGbinFactory::writeChunks(std::uint64_t minBytes) {
+	for (const auto& table : tables) {
+		if (table->bufferedRows() > 0 && table->bufferedBytes() >= minBytes) { table->writeChunk(ofile); }
+	}
+}
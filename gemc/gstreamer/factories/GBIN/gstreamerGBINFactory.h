@@ -0,0 +1,224 @@
+#pragma once
+
+// gstreamer
+#include "gstreamer.h"
+#include "gBinTable.h"
+
+// c++
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+
+/**
+ * \file gstreamerGBINFactory.h
+ * \brief Native binary columnar (gbin) streamer plugin declarations.
+ * \ingroup gstreamer_plugin_gbin_api
+ */
+
+/// \brief Buffered column bytes of one table after which it is written as a chunk record.
+inline constexpr std::uint64_t GBIN_CHUNK_BYTES = 4 * 1024 * 1024;
+
+/**
+ * \class GstreamerGbinFactory
+ * \ingroup gstreamer_plugin_gbin_api
+ * \brief Plugin writing event and run data into one self-describing \c .gbin columnar file.
+ *
+ * Every output bank becomes a table (see gstreamerGbinFormat.h):
+ * - \c header, one row per event
+ * - \c generated, \c generated_tracked, and \c ancestors banks
+ * - one true-information and one digitized table per detector
+ * - one run-digitized table per detector in run mode
+ *
+ * Event-level tables start with an \c evn column, run-level tables with a \c run column. Detector
+ * tables then hold the identity columns, followed by the variables of the first hit, in name order.
+ * The schema is fixed by that first hit: variables a later hit does not carry are written as zero
+ * or as an empty string, variables absent from the first hit are not written.
+ *
+ * Values are copied into per-column buffers and each table reaches the file as a chunk record once
+ * it holds \ref GBIN_CHUNK_BYTES, or when the connection closes. Writing therefore costs one copy
+ * per value and one unformatted write per column and chunk. The files are read back with
+ * gstreamer::gbin::GBinFile, which memory-maps them and exposes the columns in place.
+ *
+ * Frame streams are not supported by this backend.
+ *
+ * Threading model:
+ * - one instance per worker thread is the intended usage
+ * - copy and move are disabled to avoid accidental sharing of the file and its tables
+ */
+class GstreamerGbinFactory : public GStreamer
+{
+public:
+	/// \brief Inherit the constructor taking the parsed options container.
+	using GStreamer::GStreamer;
+
+	GstreamerGbinFactory(const GstreamerGbinFactory&)            = delete;
+	GstreamerGbinFactory& operator=(const GstreamerGbinFactory&) = delete;
+	GstreamerGbinFactory(GstreamerGbinFactory&&)                 = delete;
+	GstreamerGbinFactory& operator=(GstreamerGbinFactory&&)      = delete;
+
+private:
+	/**
+	 * \brief Open the output file and write the file header.
+	 *
+	 * \return \c true when the file is available for writing, \c false otherwise.
+	 */
+	bool openConnection() override;
+
+	/**
+	 * \brief Write the remaining rows of every table and close the file.
+	 *
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool closeConnectionImpl() override;
+
+	/// \brief Bytes written to the file plus the rows still buffered in the tables.
+	std::uint64_t outputBytes() override;
+
+	/**
+	 * \brief Cache the event number written in the \c evn column of every event table.
+	 *
+	 * \param event_data Event collection being published.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool startEventImpl(const std::shared_ptr<GEventDataCollection>& event_data) override;
+
+	/**
+	 * \brief Write the chunks of the tables that reached the chunk size during the event.
+	 *
+	 * \param event_data Event collection being published.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool endEventImpl([[maybe_unused]] const std::shared_ptr<GEventDataCollection>& event_data) override;
+
+	/**
+	 * \brief Append one row to the \c header table.
+	 *
+	 * \param gevent_header Event header of the current event.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishEventHeaderImpl(const std::unique_ptr<GEventHeader>& gevent_header) override;
+
+	/**
+	 * \brief Append one row per hit to the detector true-information table.
+	 *
+	 * \param detectorName Detector name, also the table name.
+	 * \param trueInfoData True-information hits of the detector.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishEventTrueInfoDataImpl(const std::string& detectorName,
+	                                  const std::vector<const GTrueInfoData*>& trueInfoData) override;
+
+	/**
+	 * \brief Append one row per hit to the detector digitized table.
+	 *
+	 * \param detectorName Detector name, also the table name.
+	 * \param digitizedData Digitized hits of the detector.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishEventDigitizedDataImpl(const std::string& detectorName,
+	                                   const std::vector<const GDigitizedData*>& digitizedData) override;
+
+	/**
+	 * \brief Append one row per particle to the \c generated or \c generated_tracked table.
+	 *
+	 * \param bankName Generated-particle bank name.
+	 * \param particles Generated-particle rows belonging to this event.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishEventGeneratedParticlesImpl(const std::string& bankName,
+	                                        const GGeneratedParticleBank& particles) override;
+
+	/** \brief Append one row per track to the \c ancestors table. */
+	bool publishEventAncestorsImpl(const GAncestorBank& ancestors) override;
+
+	/** \brief Write one row per name to the \c names table: table, id, name. */
+	bool publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) override;
+
+	/**
+	 * \brief Cache the run number written in the \c run column of run tables.
+	 *
+	 * \param run_data Run collection being published.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool startRunImpl(const std::shared_ptr<GRunDataCollection>& run_data) override;
+
+	/**
+	 * \brief End one run publication cycle.
+	 *
+	 * \param run_data Run collection being published.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool endRunImpl([[maybe_unused]] const std::shared_ptr<GRunDataCollection>& run_data) override;
+
+	/**
+	 * \brief Append one row per hit to the detector run-digitized table.
+	 *
+	 * \param detectorName Detector name, also the table name.
+	 * \param digitizedData Run-integrated digitized hits of the detector.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishRunDigitizedDataImpl(const std::string& detectorName,
+	                                 const std::vector<const GDigitizedData*>& digitizedData) override;
+
+	/// \brief Frame streams are not supported: no-op.
+	bool startStreamImpl(const GFrameDataCollection* frameRunData) override;
+
+	/// \brief Frame streams are not supported: no-op.
+	bool endStreamImpl(const GFrameDataCollection* frameRunData) override;
+
+	/// \brief Frame streams are not supported: no-op.
+	bool publishFrameHeaderImpl(const GFrameHeader* gframeHeader) override;
+
+	/// \brief Frame streams are not supported: no-op.
+	bool publishPayloadImpl(const std::vector<GIntegralPayload*>* payload) override;
+
+	/**
+	 * \brief Return the output filename.
+	 *
+	 * \return Base output name plus \c ".gbin".
+	 */
+	[[nodiscard]] std::string filename() const override { return gstreamer_definitions.rootname + ".gbin"; }
+
+	/// \brief A detector table with the column ranges of its identity and variable blocks.
+	struct DetectorTable
+	{
+		GBinTable*  table     = nullptr;
+		std::size_t nIdentity = 0; ///< identity columns follow the key column
+		std::size_t first     = 0, nFirst  = 0; ///< double (true info) or int (digitized) variables
+		std::size_t second    = 0, nSecond = 0; ///< string (true info) or double (digitized) variables
+	};
+
+	// Private helpers creating tables on first use. A new table writes its schema record immediately.
+	GBinTable& newTable(gstreamer::gbin::TableKind kind, const std::string& name,
+	                    const std::function<void(GBinTable&)>& declareColumns);
+	GBinTable& getOrInstantiateBankTable(gstreamer::gbin::TableKind kind, const std::string& name);
+	const DetectorTable& getOrInstantiateTrueInfoTable(const std::string& detectorName, const GTrueInfoData* firstHit);
+	const DetectorTable& getOrInstantiateDigitizedTable(gstreamer::gbin::TableKind kind, const std::string& detectorName,
+	                                                    const GDigitizedData* firstHit);
+
+	/// \brief Appends the digitized hits of one detector, shared by event and run publication.
+	void fillDigitizedTable(gstreamer::gbin::TableKind kind, const std::string& detectorName, std::int64_t key,
+	                        const std::vector<const GDigitizedData*>& digitizedData);
+
+	/// \brief Writes every table holding at least \p minBytes of buffered columns.
+	void writeChunks(std::uint64_t minBytes);
+
+	/// \brief Output file.
+	std::ofstream ofile;
+
+	/// \brief Tables in declaration order: the position of a table is its id.
+	std::vector<std::unique_ptr<GBinTable>> tables;
+
+	/// \brief Header, generated-particle, and ancestor tables, keyed by kind.
+	std::unordered_map<gstreamer::gbin::TableKind, GBinTable*> bankTables;
+
+	/// \brief Detector tables keyed by "<kind>:<detector>".
+	std::unordered_map<std::string, DetectorTable> detectorTables;
+
+	/// \brief Cached event number of the event being published.
+	std::int64_t event_number = -1;
+
+	/// \brief Cached run number of the run being published.
+	std::int64_t runId = -1;
+};
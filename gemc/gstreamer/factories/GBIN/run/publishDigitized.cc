@@ -0,0 +1,11 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+
+// Implementation summary:
+// Append run-integrated digitized hits to the detector run-digitized table.
+
+bool GstreamerGbinFactory::publishRunDigitizedDataImpl(const std::string&                        detectorName,
+                                                       const std::vector<const GDigitizedData*>& digitizedData) {
+	fillDigitizedTable(gstreamer::gbin::TableKind::runDigitized, detectorName, runId, digitizedData);
+	return true;
+}
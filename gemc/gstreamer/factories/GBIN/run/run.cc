@@ -0,0 +1,22 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+#include "gstreamerConventions.h"
+
+// Implementation summary:
+// Cache the run number written in the run-digitized tables.
+
+bool GstreamerGbinFactory::startRunImpl(const std::shared_ptr<GRunDataCollection>& run_data) {
+	if (!ofile.is_open()) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, "Error: can't access ", filename());
+	}
+
+	runId = run_data->getHeader()->getRunID();
+
+	return true;
+}
+
+
+bool GstreamerGbinFactory::endRunImpl([[maybe_unused]] const std::shared_ptr<GRunDataCollection>& run_data) {
+	writeChunks(GBIN_CHUNK_BYTES);
+	return true;
+}
@@ -0,0 +1,9 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+
+// Implementation summary:
+// Frame-header publication is not supported by the gbin backend.
+
+bool GstreamerGbinFactory::publishFrameHeaderImpl([[maybe_unused]] const GFrameHeader* gframeHeader) {
+	return true;
+}
@@ -0,0 +1,9 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+
+// Implementation summary:
+// Frame-payload publication is not supported by the gbin backend.
+
+bool GstreamerGbinFactory::publishPayloadImpl([[maybe_unused]] const std::vector<GIntegralPayload*>* payload) {
+	return true;
+}
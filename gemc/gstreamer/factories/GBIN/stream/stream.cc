@@ -0,0 +1,14 @@
+// gstreamer
+#include "gstreamerGBINFactory.h"
+
+// Implementation summary:
+// Frame streaming is not supported by the gbin backend.
+
+bool GstreamerGbinFactory::startStreamImpl([[maybe_unused]] const GFrameDataCollection* frameRunData) {
+	return true;
+}
+
+
+bool GstreamerGbinFactory::endStreamImpl([[maybe_unused]] const GFrameDataCollection* frameRunData) {
+	return true;
+}
@@ -6,7 +6,8 @@
 // Manage the lifetime of the binary output stream for the JLAB SRO backend.
 
 bool GstreamerJSROFactory::openConnection() {
-	ofile = new std::ofstream(filename());
+	ofile         = new std::ofstream(filename());
+	written_bytes = 0;
 	if (!ofile->is_open()) {
 		log->error(gstreamer::ERR_CANTOPENOUTPUT, "GstreamerJSROFactory: could not open file " + filename());
 	}
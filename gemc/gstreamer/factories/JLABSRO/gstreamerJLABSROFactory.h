@@ -47,7 +47,9 @@ struct DataFrameHeader
  * - one packed \ref DataFrameHeader
  * - one payload section assembled from the incoming integral payload data
  *
- * The buffer is then written in stages through the frame publish sequence.
+ * The buffer is then written in stages through the frame publish sequence. It is reused from
+ * frame to frame, and hits are grouped by slot with a counting pass, so building a frame takes time
+ * linear in its number of hits.
  *
  * Threading model:
  * - one instance per worker thread is the intended usage
@@ -74,6 +76,9 @@ private:
 	 */
 	bool closeConnectionImpl() override;
 
+	/// \brief Bytes written to the current \c ".ev" file.
+	std::uint64_t outputBytes() override { return written_bytes; }
+
 	/**
 	 * \brief Begin assembly of one binary frame record.
 	 *
@@ -119,6 +124,9 @@ private:
 	 */
 	static inline std::uint64_t llswap(unsigned long long val) { return (val >> 32) | (val << 32); }
 
+	/// \brief Number of slots described by the per-frame slot index.
+	static constexpr unsigned int SLOTS = 16;
+
 private:
 	/// \brief Binary output stream pointer for the current \c ".ev" file.
 	std::ofstream* ofile = nullptr;
@@ -126,6 +134,9 @@ private:
 	/// \brief Word buffer containing the packed header followed by the current frame payload.
 	std::vector<unsigned int> frame_data{};
 
+	/// \brief Bytes handed to \ref ofile since it was opened, counted instead of asking the file system.
+	std::uint64_t written_bytes = 0;
+
 	/**
 	 * \brief Return the final binary output filename for this plugin instance.
 	 *
@@ -12,6 +12,7 @@ bool GstreamerJSROFactory::publishFrameHeaderImpl([[maybe_unused]] const GFrameH
 	if (ofile == nullptr) { log->error(gstreamer::ERR_CANTOPENOUTPUT, "Error: can't open ", ofile); }
 
 	ofile->write(reinterpret_cast<const char*>(frame_data.data()), sizeof(DataFrameHeader));
+	written_bytes += sizeof(DataFrameHeader);
 
 	return true;
 }
\ No newline at end of file
@@ -8,13 +8,13 @@
 bool GstreamerJSROFactory::publishPayloadImpl([[maybe_unused]] const std::vector<GIntegralPayload*>* payload) {
 	if (ofile == nullptr) { log->error(gstreamer::ERR_CANTOPENOUTPUT, "Error: can't open ", ofile); }
 
-	static constexpr int      header_offset = sizeof(DataFrameHeader) / 4;
-	std::vector<unsigned int> payload_data(frame_data.size() - header_offset);
+	static constexpr std::size_t header_offset = sizeof(DataFrameHeader) / 4;
 
-	// Skip the header words and write only the payload section.
-	std::copy(frame_data.cbegin() + header_offset, frame_data.cend(), payload_data.begin());
-	ofile->write(reinterpret_cast<const char*>(payload_data.data()),
-				 sizeof(unsigned int) * payload_data.size());
+	// Write the payload section in place, skipping the header words.
+	const auto payload_bytes = sizeof(unsigned int) * (frame_data.size() - header_offset);
+	ofile->write(reinterpret_cast<const char*>(frame_data.data() + header_offset),
+	             static_cast<std::streamsize>(payload_bytes));
+	written_bytes += payload_bytes;
 
 	return true;
 }
\ No newline at end of file
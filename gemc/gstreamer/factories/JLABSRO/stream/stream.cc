@@ -2,24 +2,29 @@
 #include "gstreamerJLABSROFactory.h"
 #include "gstreamerConventions.h"
 
+// c++
+#include <array>
+
 // Implementation summary:
 // Build the packed frame record in memory before the header and payload are written out.
 
 bool GstreamerJSROFactory::startStreamImpl(const GFrameDataCollection* frameRunData) {
 	if (ofile == nullptr) { log->error(gstreamer::ERR_CANTOPENOUTPUT, "Error: can't open ", ofile); }
 
-	static constexpr int                  header_offset = sizeof(DataFrameHeader) / 4;
-	const GFrameHeader*                   header        = frameRunData->getHeader();
-	long int                              frameID       = header->getFrameID();
-	const std::vector<GIntegralPayload*>* intPayloadvec = frameRunData->getIntegralPayload();
+	static constexpr std::size_t header_offset = sizeof(DataFrameHeader) / 4;
+	const GFrameHeader*          header        = frameRunData->getHeader();
+	long int                     frameID       = header->getFrameID();
+	const auto&                  intPayloadvec = frameRunData->getIntegralPayload();
 
 	// Reserve enough words for the packed binary header.
-	frame_data.resize(header_offset, 0);
+	if (frame_data.size() < header_offset) { frame_data.resize(header_offset, 0); }
 
-	// The first frame emits the SRO "super magic" words ahead of the normal records.
-	if (frameID == 1) {
+	// The first frame of each file emits the SRO "super magic" words ahead of the normal records. Frame
+	// IDs keep counting across runs and rotated files, so the ID cannot tell which frame comes first.
+	if (written_bytes == 0) {
 		std::vector<std::uint32_t> const super_magic = {0xC0DA2019, 0XC0DA0001};
 		ofile->write(reinterpret_cast<const char*>(super_magic.data()), sizeof(std::uint32_t) * 2);
+		written_bytes += sizeof(std::uint32_t) * 2;
 	}
 
 	// Populate the binary record header directly inside the word buffer.
@@ -33,45 +38,51 @@ bool GstreamerJSROFactory::startStreamImpl(const GFrameDataCollection* frameRunD
 	dataFrameHeader.ts_sec         = llswap((frameID * 65536) / static_cast<int>(1e9));
 	dataFrameHeader.ts_nsec        = llswap((frameID * 65536) % static_cast<int>(1e9));
 
-	// Build the payload words grouped by slot.
-	unsigned int crate = 0;
-	unsigned int slot, channel, charge, time;
-	unsigned int slots = 16;
-
-	frame_data.resize(header_offset);
-	frame_data.push_back(0x80000000);
-	frame_data.insert(frame_data.end(), slots, 0);
-
-	for (unsigned int i = 0; i < slots; ++i) {
-		int starting_point = (int)frame_data.size() - header_offset;
-		frame_data.push_back(0x80008000 | (crate << 8) | i);
-		int hit_counter = 0;
-
-		for (unsigned int hit = 0; hit < intPayloadvec->size(); ++hit) {
-			GIntegralPayload* intpayload = intPayloadvec->at(hit);
-			std::vector<int>  payload    = intpayload->getPayload();
-			crate                        = payload[0];
-			slot                         = payload[1];
-			channel                      = payload[2];
-			charge                       = payload[3];
-			time                         = payload[4];
-
-			if (i == slot) {
-				frame_data.push_back(charge | (channel << 13) | ((time / 4) << 17));
-				++hit_counter;
-			}
-		}
+	// Build the payload words grouped by slot. A first pass counts the hits of each slot, which fixes
+	// the position of every slot block; a second pass writes each hit word straight into its block.
+	// Both passes are linear in the number of hits and, once frame_data has grown to the largest
+	// frame, allocation free. Hits keep their input order within a slot.
+	// Payload layout: one 0x80000000 word, one index word per slot, then per non-empty slot a
+	// marker word followed by its hit words. Hits outside the slot range are not written.
+	std::array<unsigned int, SLOTS> slot_hits{};
+	std::array<unsigned int, SLOTS> slot_crate{};
+	for (const auto& intpayload : intPayloadvec) {
+		const auto slot = static_cast<unsigned int>(intpayload->getSlot());
+		if (slot >= SLOTS) { continue; }
+		if (slot_hits[slot]++ == 0) { slot_crate[slot] = static_cast<unsigned int>(intpayload->getCrate()); }
+	}
 
-		// Empty slots remove the marker word entirely.
-		if (hit_counter == 0) {
-			frame_data.pop_back();
-		}
-		else {
-			++hit_counter;
+	std::size_t payload_words = 1 + SLOTS;
+	for (const auto hits : slot_hits) {
+		if (hits > 0) { payload_words += 1 + hits; }
+	}
+	frame_data.resize(header_offset + payload_words);
+	unsigned int* payload_data = frame_data.data() + header_offset;
+
+	payload_data[0] = 0x80000000;
+
+	std::array<unsigned int, SLOTS> next_word{};
+	unsigned int                    position = 1 + SLOTS;
+	for (unsigned int slot = 0; slot < SLOTS; ++slot) {
+		// Empty slots get an index word with a zero count and no marker.
+		if (slot_hits[slot] == 0) {
+			payload_data[1 + slot] = position;
+			continue;
 		}
+		payload_data[1 + slot] = ((slot_hits[slot] + 1) << 16) | position;
+		payload_data[position] = 0x80008000 | (slot_crate[slot] << 8) | slot;
+		next_word[slot]        = position + 1;
+		position               += 1 + slot_hits[slot];
+	}
+
+	for (const auto& intpayload : intPayloadvec) {
+		const auto slot = static_cast<unsigned int>(intpayload->getSlot());
+		if (slot >= SLOTS) { continue; }
+		const auto channel = static_cast<unsigned int>(intpayload->getChannel());
+		const auto charge  = static_cast<unsigned int>(intpayload->getCharge());
+		const auto time    = static_cast<unsigned int>(intpayload->getTime());
 
-		frame_data[header_offset + 1 + i] =
-			((hit_counter) << 16) | starting_point;
+		payload_data[next_word[slot]++] = charge | (channel << 13) | ((time / 4) << 17);
 	}
 
 	// Finalize the size fields after payload assembly is complete.
@@ -2,9 +2,6 @@
 #include "gstreamerJSONFactory.h"
 #include "gstreamerConventions.h"
 
-// c++
-#include <sstream>
-
 // Implementation summary:
 // Start and finalize one JSON event object using the ordered event publish sequence.
 
@@ -26,7 +23,6 @@ bool GstreamerJsonFactory::startEventImpl(const std::shared_ptr<GEventDataCollec
 
 	// Reset all per-event assembly state.
 	is_building_event = true;
-	current_event.str(std::string());
 	current_event.clear();
 	current_event_has_header       = false;
 	current_event_has_any_detector = false;
@@ -70,20 +66,13 @@ bool GstreamerJsonFactory::endEventImpl(const std::shared_ptr<GEventDataCollecti
 	// "digitized_by_detector" object nested inside "detectors".
 	if (!current_event_digitized_entries.empty()) {
 		if (detectors_has_content) { current_event << ", "; }
-		current_event << "\"digitized_by_detector\": {";
-		bool first = true;
-		for (const auto& entry : current_event_digitized_entries) {
-			if (!first) { current_event << ", "; }
-			first = false;
-			current_event << entry;
-		}
-		current_event << "}";
+		current_event << "\"digitized_by_detector\": {" << current_event_digitized_entries.view() << "}";
 	}
 
 	current_event << "}"; // close "detectors"
 	current_event << "}"; // close the event object
 
-	writeTopLevelEntry(current_event.str());
+	writeTopLevelEntry(current_event.view());
 
 	is_building_event = false;
 
@@ -163,3 +152,25 @@ bool GstreamerJsonFactory::publishEventAncestorsImpl(const GAncestorBank& ancest
 	current_event << "]";
 	return true;
 }
+
+bool GstreamerJsonFactory::publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) {
+	name_tables.clear();
+	name_tables << "{";
+	bool first_table = true;
+	for (const auto& [tableName, table] : {std::pair{"processes", &processes}, std::pair{"particles", &particles}}) {
+		if (!first_table) { name_tables << ", "; }
+		first_table = false;
+
+		// Ids are object keys, so they are written as strings.
+		name_tables << "\"" << tableName << "\": {";
+		bool first = true;
+		for (const auto& [id, name] : table->entries()) {
+			if (!first) { name_tables << ", "; }
+			first = false;
+			name_tables << "\"" << id << "\": \"" << jsonEscape(name) << "\"";
+		}
+		name_tables << "}";
+	}
+	name_tables << "}";
+	return true;
+}
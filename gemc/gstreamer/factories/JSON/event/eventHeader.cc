@@ -28,6 +28,13 @@ bool GstreamerJsonFactory::publishEventHeaderImpl(const std::unique_ptr<GEventHe
 	current_event << "\"timestamp\": \"" << jsonEscape(timestamp) << "\""
 				  << ", \"thread_id\": " << thread_id
 				  << ", \"g4local_event\": " << gevent_header->getG4LocalEvn();
+	if (gevent_header->hasRandomSeeds()) {
+		current_event << ", \"random_seeds\": [" << gevent_header->getRandomSeeds()[0] << ", "
+					  << gevent_header->getRandomSeeds()[1] << "]";
+	}
+	if (gevent_header->hasReplayedEvent()) {
+		current_event << ", \"replayed_event\": " << gevent_header->getReplayedEvent();
+	}
 	current_event << "}"; // close the "header" object opened in startEventImpl
 
 	current_event_has_header = true;
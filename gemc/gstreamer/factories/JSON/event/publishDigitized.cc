@@ -2,9 +2,6 @@
 #include "gstreamerJSONFactory.h"
 #include "gstreamerConventions.h"
 
-// c++
-#include <sstream>
-
 // Implementation summary:
 // Append digitized detector content to the current JSON event object.
 // This implementation keeps the JSON valid without performing in-place string editing.
@@ -17,13 +14,14 @@ bool GstreamerJsonFactory::publishEventDigitizedDataImpl(const std::string&
 		return false;
 	}
 
-	// Build this detector's digitized array into a standalone entry and buffer it.
+	// Append this detector's digitized array as a standalone entry to the buffered list.
 	// endEventImpl emits all buffered entries together as the "digitized_by_detector"
 	// object, which keeps the JSON valid regardless of how true-info and digitized
 	// publish calls interleave across detectors.
 	if (digitizedData.empty()) return true;
 
-	std::ostringstream entry;
+	auto& entry = current_event_digitized_entries;
+	if (!entry.empty()) entry << ", ";
 	entry << "\"" << jsonEscape(detectorName) << "\": [";
 
 	bool wrote_first_hit = false;
@@ -43,16 +41,17 @@ bool GstreamerJsonFactory::publishEventDigitizedDataImpl(const std::string&
 
 		bool wrote_first_var = false;
 
-		// Integer observables:
-		// the argument 0 means "do not include SRO variables".
-		for (const auto& [name, value] : hit->getIntObservablesMap(0)) {
+		// Integer observables, skipping SRO variables.
+		for (const auto& [name, value] : hit->getIntObservablesView()) {
+			if (!GDigitizedData::validVarName(name, 0) || !output_selection.selectsVariable(name)) continue;
 			if (wrote_first_var) entry << ", ";
 			wrote_first_var = true;
 			entry << "\"" << jsonEscape(name) << "\": " << value;
 		}
 
 		// Floating-point observables.
-		for (const auto& [name, value] : hit->getDblObservablesMap(0)) {
+		for (const auto& [name, value] : hit->getDblObservablesView()) {
+			if (!GDigitizedData::validVarName(name, 0) || !output_selection.selectsVariable(name)) continue;
 			if (wrote_first_var) entry << ", ";
 			wrote_first_var = true;
 			entry << "\"" << jsonEscape(name) << "\": " << value;
@@ -64,7 +63,5 @@ bool GstreamerJsonFactory::publishEventDigitizedDataImpl(const std::string&
 
 	entry << "]";
 
-	current_event_digitized_entries.push_back(entry.str());
-
 	return true;
 }
\ No newline at end of file
@@ -2,9 +2,6 @@
 #include "gstreamerJSONFactory.h"
 #include "gstreamerConventions.h"
 
-// c++
-#include <sstream>
-
 // Implementation summary:
 // Append one detector true-information block to the current JSON event object.
 
@@ -46,13 +43,15 @@ bool GstreamerJsonFactory::publishEventTrueInfoDataImpl(const std::string& detec
 
 		bool wrote_first_var = false;
 
-		for (const auto& [name, value] : hit->getDoubleVariablesMap()) {
+		for (const auto& [name, value] : hit->getDoubleVariablesView()) {
+			if (!output_selection.selectsVariable(name)) continue;
 			if (wrote_first_var) current_event << ", ";
 			wrote_first_var = true;
 			current_event << "\"" << jsonEscape(name) << "\": " << value;
 		}
 
-		for (const auto& [name, value] : hit->getStringVariablesMap()) {
+		for (const auto& [name, value] : hit->getStringVariablesView()) {
+			if (!output_selection.selectsVariable(name)) continue;
 			if (wrote_first_var) current_event << ", ";
 			wrote_first_var = true;
 			current_event << "\"" << jsonEscape(name) << "\": \"" << jsonEscape(value) << "\"";
@@ -2,9 +2,6 @@
 #include "gstreamerJSONFactory.h"
 #include "gstreamerConventions.h"
 
-// c++
-#include <iomanip>
-
 // Implementation summary:
 // Manage the JSON output stream and the lifetime of the top-level JSON document.
 
@@ -14,10 +11,7 @@ bool GstreamerJsonFactory::openConnection() {
 		return true;
 	}
 
-	ofile.clear();
-	ofile.open(filename(), std::ios::out | std::ios::trunc);
-
-	if (!ofile.is_open() || !ofile) {
+	if (!ofile.open(filename())) {
 		log->error(gstreamer::ERR_CANTOPENOUTPUT, SFUNCTION_NAME, " could not open file ", filename());
 		return false;
 	}
@@ -39,9 +33,8 @@ bool GstreamerJsonFactory::closeConnectionImpl() {
 	// Finalize the top-level JSON structure only if it was ever started.
 	closeTopLevelObjectIfNeeded();
 
-	if (ofile.is_open()) ofile.close();
-	if (ofile.is_open()) {
-		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not close file ", filename());
+	if (!ofile.close()) {
+		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, SFUNCTION_NAME, " could not write or close file ", filename());
 	}
 
 	log->info(1, SFUNCTION_NAME, "GstreamerJsonFactory: closed file " + filename());
@@ -49,6 +42,8 @@ bool GstreamerJsonFactory::closeConnectionImpl() {
 	return true;
 }
 
+std::uint64_t GstreamerJsonFactory::outputBytes() { return ofile.bytes(); }
+
 void GstreamerJsonFactory::ensureFileInitializedForType(const std::string& type) {
 	if (is_file_initialized) return;
 
@@ -72,7 +67,7 @@ void GstreamerJsonFactory::ensureFileInitializedForType(const std::string& type)
 	wrote_first_top_level_entry = false;
 }
 
-void GstreamerJsonFactory::writeTopLevelEntry(const std::string& entry_json) {
+void GstreamerJsonFactory::writeTopLevelEntry(std::string_view entry_json) {
 	// This helper assumes the correct top-level array has already been opened.
 	if (!is_file_initialized) {
 		log->error(gstreamer::ERR_PUBLISH_ERROR,
@@ -88,13 +83,20 @@ void GstreamerJsonFactory::writeTopLevelEntry(const std::string& entry_json) {
 
 	// Keep a stable indentation level for readability.
 	ofile << "    " << entry_json;
+	if (!ofile.flush_if_full()) {
+		log->error(gstreamer::ERR_CANTWRITEOUTPUT, SFUNCTION_NAME, " could not write to file ", filename());
+	}
 }
 
 void GstreamerJsonFactory::closeTopLevelObjectIfNeeded() {
 	if (!is_file_initialized) return;
 
-	// Close the active top-level array and then the containing object.
-	ofile << "\n  ]\n";
-	ofile << "}\n";
+	// Close the active top-level array, add the name tables when published, then close the object.
+	ofile << "\n  ]";
+	if (!name_tables.view().empty()) {
+		ofile << ",\n  \"names\": " << name_tables.view();
+		name_tables.clear();
+	}
+	ofile << "\n}\n";
 	is_file_initialized = false;
 }
\ No newline at end of file
@@ -3,11 +3,11 @@
 // gstreamer
 #include "gstreamer.h"
 #include "gstreamerConventions.h"
+#include "gstreamerTextOutput.h"
 
 // c++
-#include <fstream>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -16,6 +16,19 @@
  * \ingroup gstreamer_plugin_json_api
  */
 
+/**
+ * \brief String tagged for JSON escaping.
+ *
+ * Appending it to a gstreamer::GTextBuffer writes the escaped text directly into the buffer, with
+ * no intermediate string; text that needs no escaping is copied in one append.
+ */
+struct GJsonEscaped
+{
+	std::string_view text;
+};
+
+gstreamer::GTextBuffer& operator<<(gstreamer::GTextBuffer& out, GJsonEscaped escaped);
+
 /**
  * \class GstreamerJsonFactory
  * \ingroup gstreamer_plugin_json_api
@@ -67,6 +80,9 @@ private:
 	 */
 	bool closeConnectionImpl() override;
 
+	/// \brief Bytes written to the JSON file, including buffered entries.
+	std::uint64_t outputBytes() override;
+
 	/**
 	 * \brief Begin assembly of one JSON event object.
 	 *
@@ -129,6 +145,17 @@ private:
 	/** \brief Append the event ancestor bank to the current JSON object. */
 	bool publishEventAncestorsImpl(const GAncestorBank& ancestors) override;
 
+	/**
+	 * \brief Prepare the \c "names" object holding the process and particle name tables.
+	 *
+	 * The object is written after the top-level events array when the file is closed.
+	 *
+	 * \param processes Process name table.
+	 * \param particles Particle name table.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) override;
+
 	/**
 	 * \brief Begin assembly of one JSON frame record.
 	 *
@@ -162,8 +189,8 @@ private:
 	bool publishPayloadImpl(const std::vector<GIntegralPayload*>* payload) override;
 
 private:
-	/// \brief Output stream bound to the JSON file for this plugin instance.
-	std::ofstream ofile;
+	/// \brief Buffered output bound to the JSON file for this plugin instance.
+	gstreamer::GTextFile ofile;
 
 	/// \brief Tracks whether the top-level JSON object has already been started.
 	bool is_file_initialized = false;
@@ -177,8 +204,8 @@ private:
 	/// \brief Tracks whether the plugin is currently assembling an event object.
 	bool is_building_event = false;
 
-	/// \brief String buffer holding the current event JSON object under construction.
-	std::ostringstream current_event;
+	/// \brief Reused buffer holding the current event JSON object under construction.
+	gstreamer::GTextBuffer current_event;
 
 	/// \brief Tracks whether the current event already contains header content.
 	bool current_event_has_header = false;
@@ -189,16 +216,19 @@ private:
 	/// \brief Tracks whether the current event already contains generated-particle banks.
 	bool current_event_has_generated = false;
 
-	/// \brief Buffered digitized detector arrays for the current event. endEventImpl emits
+	/// \brief Comma-separated digitized detector arrays for the current event. endEventImpl emits
 	/// them together as the "digitized_by_detector" object, which keeps the JSON valid
 	/// regardless of how true-info and digitized publish calls interleave across detectors.
-	std::vector<std::string> current_event_digitized_entries;
+	gstreamer::GTextBuffer current_event_digitized_entries;
+
+	/// \brief Serialized \c "names" object, written by closeTopLevelObjectIfNeeded() when not empty.
+	gstreamer::GTextBuffer name_tables;
 
 	/// \brief Tracks whether the plugin is currently assembling a frame object.
 	bool is_building_frame = false;
 
-	/// \brief String buffer holding the current frame JSON object under construction.
-	std::ostringstream current_frame;
+	/// \brief Reused buffer holding the current frame JSON object under construction.
+	gstreamer::GTextBuffer current_frame;
 
 	/// \brief Tracks whether the current frame already contains header content.
 	bool current_frame_has_header = false;
@@ -225,8 +255,8 @@ private:
 
 private:
 	// Private helper utilities. These remain undocumented by cross-reference on purpose.
-	static std::string jsonEscape(const std::string& s);
+	static GJsonEscaped jsonEscape(std::string_view s) { return {s}; }
 	void ensureFileInitializedForType(const std::string& type);
-	void writeTopLevelEntry(const std::string& entry_json);
+	void writeTopLevelEntry(std::string_view entry_json);
 	void closeTopLevelObjectIfNeeded();
 };
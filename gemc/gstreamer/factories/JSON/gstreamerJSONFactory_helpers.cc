@@ -3,40 +3,48 @@
 
 // Implementation summary:
 // Minimal helper used by the JSON plugin to escape keys and string values
-// without relying on an external JSON library.
+// without relying on an external JSON library. Escaped text is appended straight
+// to the output buffer; runs of characters that need no escaping are copied in one go.
 
-std::string GstreamerJsonFactory::jsonEscape(const std::string& s) {
-	std::string out;
-	out.reserve(s.size() + 8);
+gstreamer::GTextBuffer& operator<<(gstreamer::GTextBuffer& out, GJsonEscaped escaped) {
+	const std::string_view s   = escaped.text;
+	std::size_t            run = 0;
 
-	for (unsigned char c : s) {
+	for (std::size_t i = 0; i < s.size(); i++) {
+		const auto  c = static_cast<unsigned char>(s[i]);
+		const char* replacement;
 		switch (c) {
-		case '\\': out += "\\\\";
+		case '\\': replacement = "\\\\";
 			break;
-		case '"': out += "\\\"";
+		case '"': replacement = "\\\"";
 			break;
-		case '\b': out += "\\b";
+		case '\b': replacement = "\\b";
 			break;
-		case '\f': out += "\\f";
+		case '\f': replacement = "\\f";
 			break;
-		case '\n': out += "\\n";
+		case '\n': replacement = "\\n";
 			break;
-		case '\r': out += "\\r";
+		case '\r': replacement = "\\r";
 			break;
-		case '\t': out += "\\t";
+		case '\t': replacement = "\\t";
 			break;
 		default:
 			// JSON requires control characters below 0x20 to be escaped.
-			if (c < 0x20) {
-				static const char* hex = "0123456789abcdef";
-				out                    += "\\u00";
-				out                    += hex[(c >> 4) & 0xF];
-				out                    += hex[c & 0xF];
-			}
-			else {
-				out.push_back(static_cast<char>(c));
-			}
+			if (c >= 0x20) { continue; }
+			replacement = nullptr;
+		}
+
+		out << s.substr(run, i - run);
+		run = i + 1;
+		if (replacement != nullptr) {
+			out << replacement;
+		}
+		else {
+			static const char* hex = "0123456789abcdef";
+			out << "\\u00" << hex[(c >> 4) & 0xF] << hex[c & 0xF];
 		}
 	}
+	out << s.substr(run);
+
 	return out;
-}
\ No newline at end of file
+}
@@ -19,7 +19,6 @@ bool GstreamerJsonFactory::startStreamImpl(const GFrameDataCollection* frameRunD
 
 	// Reset per-frame assembly state.
 	is_building_frame = true;
-	current_frame.str(std::string());
 	current_frame.clear();
 	current_frame_has_header  = false;
 	current_frame_has_payload = false;
@@ -37,17 +36,17 @@ bool GstreamerJsonFactory::endStreamImpl(const GFrameDataCollection* frameRunDat
 
 	// Keep the schema predictable even if the caller omitted header or payload publication.
 	if (!current_frame_has_header) {
-		if (current_frame.str().size() > 1) current_frame << ", ";
+		if (current_frame.size() > 1) current_frame << ", ";
 		current_frame << "\"header\": {}";
 	}
 	if (!current_frame_has_payload) {
-		if (current_frame.str().size() > 1) current_frame << ", ";
+		if (current_frame.size() > 1) current_frame << ", ";
 		current_frame << "\"payload\": []";
 	}
 
 	current_frame << "}";
 
-	writeTopLevelEntry(current_frame.str());
+	writeTopLevelEntry(current_frame.view());
 
 	is_building_frame = false;
 
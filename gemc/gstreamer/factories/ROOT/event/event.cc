@@ -2,7 +2,8 @@
 #include "gstreamerROOTFactory.h"
 
 // Implementation summary:
-// Emit lightweight lifecycle logs around event publication for the ROOT backend.
+// Emit lightweight lifecycle logs around event publication for the ROOT backend, and pad the
+// event-level trees that received no data so that their entries stay aligned with the header tree.
 
 bool GstreamerRootFactory::startEventImpl([[maybe_unused]] const std::shared_ptr<GEventDataCollection>& event_data) {
 	log->info(2, "Start of event ", event_data->getHeader()->getG4LocalEvn(), " in ", filename());
@@ -14,5 +15,14 @@ bool GstreamerRootFactory::startEventImpl([[maybe_unused]] const std::shared_ptr
 bool GstreamerRootFactory::endEventImpl([[maybe_unused]] const std::shared_ptr<GEventDataCollection>& event_data) {
 	log->info(2, "End of event ", event_data->getHeader()->getG4LocalEvn(), " in ", filename());
 
+	// Detectors without hits in this event get an empty entry, keeping every tree aligned with the header tree.
+	const Long64_t nevents = publishedEvents();
+	for (const auto& [treeName, tree] : gRootTrees) {
+		if (treeName == gstreamer::root::EVENTHEADERTREENAME || treeName == gstreamer::root::RUNHEADERTREENAME) {
+			continue;
+		}
+		tree->fillEmptyEntries(nevents);
+	}
+
 	return true;
 }
\ No newline at end of file
@@ -4,25 +4,82 @@
 using std::vector;
 
 // Implementation summary:
-// Build ROOT TTrees lazily from sample headers or hits, then clear and refill
-// vector branches on each fill call.
+// Build ROOT TTrees lazily from sample headers or hits, freeze their branch layout into
+// column buffers bound once to the branches, then clear and refill those buffers on each fill call.
+
+namespace {
+// Column indices of the fixed-schema trees, in registration order.
+enum EventHeaderColumn : std::size_t { EVN, THREADID, SEED1, SEED2, REPLAYED };
+enum EventHeaderStringColumn : std::size_t { TIMESTAMP };
+enum RunHeaderColumn : std::size_t { RUNID };
+enum GeneratedIntColumn : std::size_t { GEN_PID, GEN_TYPE, GEN_MULTIPLICITY };
+enum GeneratedDoubleColumn : std::size_t { GEN_P, GEN_THETA, GEN_PHI, GEN_VX, GEN_VY, GEN_VZ };
+enum GeneratedStringColumn : std::size_t { GEN_NAME };
+enum AncestorIntColumn : std::size_t { ANC_PID, ANC_TID, ANC_MTID };
+enum AncestorDoubleColumn : std::size_t { ANC_TRACKE, ANC_PX, ANC_PY, ANC_PZ, ANC_VX, ANC_VY, ANC_VZ };
+
+// Append one column to the schema. Returns false if the name is already taken.
+template <typename ColumnSet>
+bool addColumn(ColumnSet& columns, const std::string& varname) {
+	if (!columns.index.emplace(varname, columns.names.size()).second) { return false; }
+	columns.names.push_back(varname);
+	return true;
+}
+
+// Branches inherit the file compression unless the tree kind sets its own.
+template <typename ColumnSet>
+void bindColumns(TTree* tree, ColumnSet& columns, const GRootTreeSettings& settings) {
+	columns.buffers.resize(columns.names.size());
+	for (std::size_t i = 0; i < columns.names.size(); i++) {
+		auto branch = tree->Branch(columns.names[i].c_str(), &columns.buffers[i], settings.basketSize);
+		if (settings.compression >= 0) { branch->SetCompressionSettings(settings.compression); }
+	}
+}
+
+// Append the values of hit number row to their columns, starting at column first.
+// Variable maps are sorted by name, like the columns registered from the sample hit, so the next
+// expected column is tried first and the name index is only consulted when a hit deviates from the
+// schema. Unknown names and names owned by columns before first are skipped.
+template <typename ColumnSet, typename Map>
+void fillMatching(ColumnSet& columns, const Map& values, std::size_t first, std::size_t row) {
+	std::size_t next = first;
+	for (const auto& [varname, value] : values) {
+		std::size_t column = next;
+		if (column >= columns.names.size() || columns.names[column] != varname) {
+			const auto it = columns.index.find(varname);
+			if (it == columns.index.end() || it->second < first) { continue; }
+			column = it->second;
+		}
+		auto& buffer = columns.buffers[column];
+		if (buffer.size() == row) { buffer.push_back(value); }
+		next = column + 1;
+	}
+}
+
+template <typename ColumnSet>
+void padColumns(ColumnSet& columns, std::size_t row) {
+	for (auto& buffer : columns.buffers) {
+		if (buffer.size() == row) { buffer.emplace_back(); }
+	}
+}
+} // namespace
 
 GRootTree::GRootTree([[maybe_unused]] const std::unique_ptr<GEventHeader>& gevent_header,
+					 const GRootTreeSettings&                              settings,
 					 std::shared_ptr<GLogger>&                             logger) : log(logger) {
 	log->debug(CONSTRUCTOR, "GRootTree", "ROOT tree header");
 
 	root_tree =
 	    std::make_unique<TTree>(gstreamer::root::EVENTHEADERTREENAME, gstreamer::root::EVENTHEADERTREENAMEDESC);
 
-	// AutoFlush controls when buffered basket data are pushed to disk.
-	root_tree->SetAutoFlush(20 * 1024 * 1024);
-
-	// AutoSave periodically writes tree metadata snapshots for recoverability.
-	root_tree->SetAutoSave(50 * 1024 * 1024);
-
+	// Registration order defines the EventHeaderColumn indices.
 	registerVariable("g4localEventNumber", gevent_header->getG4LocalEvn());
 	registerVariable("threadID", gevent_header->getThreadID());
+	registerVariable("randomSeed1", gevent_header->getRandomSeeds()[0]);
+	registerVariable("randomSeed2", gevent_header->getRandomSeeds()[1]);
+	registerVariable("replayedEvent", gevent_header->getReplayedEvent());
 	registerVariable("timeStamp", gevent_header->getTimeStamp());
+	bindBranches(settings);
 }
 
 // fill the GEventHeader tree
@@ -31,15 +88,16 @@ bool GRootTree::fillTree(const std::unique_ptr<GEventHeader>& gevent_header) {
 			  gevent_header->getThreadID());
 
 	// Clear the vectors backing the branches before writing the next entry.
-	intVarsMap["g4localEventNumber"].clear();
-	intVarsMap["threadID"].clear();
-	stringVarsMap["timeStamp"].clear();
+	clearColumns();
 
-	intVarsMap["g4localEventNumber"].emplace_back(gevent_header->getG4LocalEvn());
-	intVarsMap["threadID"].emplace_back(gevent_header->getThreadID());
-	stringVarsMap["timeStamp"].emplace_back(gevent_header->getTimeStamp());
+	intColumns.buffers[EVN].emplace_back(gevent_header->getG4LocalEvn());
+	intColumns.buffers[THREADID].emplace_back(gevent_header->getThreadID());
+	intColumns.buffers[SEED1].emplace_back(gevent_header->getRandomSeeds()[0]);
+	intColumns.buffers[SEED2].emplace_back(gevent_header->getRandomSeeds()[1]);
+	intColumns.buffers[REPLAYED].emplace_back(gevent_header->getReplayedEvent());
+	stringColumns.buffers[TIMESTAMP].emplace_back(gevent_header->getTimeStamp());
 
-	root_tree->Fill();
+	fill();
 
 	return true;
 }
@@ -49,56 +107,61 @@ bool GRootTree::fillTree(const std::unique_ptr<GRunHeader>& grun_header) {
 	log->info(2, "Filling header tree for run n. ", grun_header->getRunID());
 
 	// Clear and refill the vectors backing the run-header branches.
-	intVarsMap["runID"].clear();
-	intVarsMap["runID"].emplace_back(grun_header->getRunID());
+	clearColumns();
+	intColumns.buffers[RUNID].emplace_back(grun_header->getRunID());
 
-	root_tree->Fill();
+	fill();
 
 	return true;
 }
 
 GRootTree::GRootTree([[maybe_unused]] const std::unique_ptr<GRunHeader>& grun_header,
+					 const GRootTreeSettings&                            settings,
 					 std::shared_ptr<GLogger>&                           logger) : log(logger) {
 	log->debug(CONSTRUCTOR, "GRootTree", "ROOT tree header");
 
 	root_tree =
 	    std::make_unique<TTree>(gstreamer::root::RUNHEADERTREENAME, gstreamer::root::RUNHEADERTREENAMEDESC);
-	root_tree->SetAutoFlush(20 * 1024 * 1024);
-	root_tree->SetAutoSave(50 * 1024 * 1024);
 
 	registerVariable("runID", grun_header->getRunID());
+	bindBranches(settings);
 }
 
 
 // Implementation summary:
 // Create a true-information detector tree whose branch schema is inferred
-// from the first observed hit.
+// from the first observed hit, restricted to the selected variables.
 GRootTree::GRootTree(const std::string&        detectorName,
 					 const GTrueInfoData*      gdata,
+					 const GRootTreeSettings&  settings,
+					 const GStreamerSelection& selection,
 					 std::shared_ptr<GLogger>& logger) : log(logger) {
 	log->debug(CONSTRUCTOR, "GRootTree", "ROOT tree True Info");
 
 	root_tree = std::make_unique<TTree>(detectorName.c_str(), gstreamer::root::TRUEINFOTREENAMEDESC);
-	root_tree->SetAutoFlush(20 * 1024 * 1024);
-	root_tree->SetAutoSave(50 * 1024 * 1024);
 
-	// add identity vars
-	auto identityMap = getIdentityMap(gdata->getIdentity());
-	for (auto& [varname, value] : identityMap) { registerVariable(varname, value); }
+	// add identity vars, in the order the hits carry them
+	for (const auto& id : gdata->getIdentity()) { registerVariable(id.getName(), id.getValue(), true); }
+	nIdentityColumns = intColumns.names.size();
 
-	for (auto& [varname, value] : gdata->getDoubleVariablesMap()) { registerVariable(varname, value); }
-	for (auto& [varname, value] : gdata->getStringVariablesMap()) { registerVariable(varname, value); }
+	for (const auto& [varname, value] : gdata->getDoubleVariablesView()) {
+		if (selection.selectsVariable(varname)) { registerVariable(varname, value); }
+	}
+	for (const auto& [varname, value] : gdata->getStringVariablesView()) {
+		if (selection.selectsVariable(varname)) { registerVariable(varname, value); }
+	}
+	bindBranches(settings);
 }
 
 GRootTree::GRootTree(const std::string& treeName,
 					 [[maybe_unused]] const GGeneratedParticleBank& particles,
+					 const GRootTreeSettings& settings,
 					 std::shared_ptr<GLogger>& logger) : log(logger) {
 	log->debug(CONSTRUCTOR, "GRootTree", "ROOT tree Generated Particles");
 
 	root_tree = std::make_unique<TTree>(treeName.c_str(), gstreamer::root::GENERATEDTREENAMEDESC);
-	root_tree->SetAutoFlush(20 * 1024 * 1024);
-	root_tree->SetAutoSave(50 * 1024 * 1024);
 
+	// Registration order defines the Generated*Column indices.
 	registerVariable("pid", 0);
 	registerVariable("type", 0);
 	registerVariable("multiplicity", 0);
@@ -109,15 +172,16 @@ GRootTree::GRootTree(const std::string& treeName,
 	registerVariable("vy", 0.0);
 	registerVariable("vz", 0.0);
 	registerVariable("name", std::string());
+	bindBranches(settings);
 }
 
 GRootTree::GRootTree([[maybe_unused]] const GAncestorBank& ancestors,
+	                 const GRootTreeSettings& settings,
 	                 std::shared_ptr<GLogger>& logger) : log(logger) {
 	log->debug(CONSTRUCTOR, "GRootTree", "ROOT tree Ancestors");
 	root_tree = std::make_unique<TTree>(gstreamer::root::ANCESTORTREENAME, gstreamer::root::ANCESTORTREENAMEDESC);
-	root_tree->SetAutoFlush(20 * 1024 * 1024);
-	root_tree->SetAutoSave(50 * 1024 * 1024);
 
+	// Registration order defines the Ancestor*Column indices.
 	registerVariable("pid", 0);
 	registerVariable("tid", 0);
 	registerVariable("mtid", 0);
@@ -128,52 +192,51 @@ GRootTree::GRootTree([[maybe_unused]] const GAncestorBank& ancestors,
 	registerVariable("vx", 0.0);
 	registerVariable("vy", 0.0);
 	registerVariable("vz", 0.0);
+	bindBranches(settings);
 }
 
 
 // Implementation summary:
 // Create a digitized detector tree whose branch schema is inferred
-// from the first observed hit.
+// from the first observed hit, restricted to the selected observables.
 GRootTree::GRootTree(const std::string&        detectorName,
 					 const GDigitizedData*     gdata,
+					 const GRootTreeSettings&  settings,
+					 const GStreamerSelection& selection,
 					 std::shared_ptr<GLogger>& logger) : log(logger) {
 	log->debug(CONSTRUCTOR, "GRootTree", "ROOT tree Digitized Data");
 
 	root_tree = std::make_unique<TTree>(detectorName.c_str(), gstreamer::root::DIGITIZEDTREENAMEDESC);
-	root_tree->SetAutoFlush(20 * 1024 * 1024);
-	root_tree->SetAutoSave(50 * 1024 * 1024);
 
-	// add identity vars
-	auto identityMap = getIdentityMap(gdata->getIdentity());
-	for (auto& [varname, value] : identityMap) { registerVariable(varname, value, true); }
+	// add identity vars, in the order the hits carry them
+	for (const auto& id : gdata->getIdentity()) { registerVariable(id.getName(), id.getValue(), true); }
+	nIdentityColumns = intColumns.names.size();
 
+	// Observables that repeat an identity name are already covered by the identity column.
 	for (auto& [varname, value] : gdata->getIntObservablesMap(0)) {
-		registerVariable(varname, value);
+		if (selection.selectsVariable(varname)) { registerVariable(varname, value, true); }
 	}
-	for (auto& [varname, value] : gdata->getDblObservablesMap(0)) { registerVariable(varname, value); }
+	for (auto& [varname, value] : gdata->getDblObservablesMap(0)) {
+		if (selection.selectsVariable(varname)) { registerVariable(varname, value); }
+	}
+	bindBranches(settings);
 }
 
 
 // fill the True Info Tree
 bool GRootTree::fillTree(const std::vector<const GTrueInfoData*>& trueInfoData) {
 	// Reset all branch vectors before repopulating them for this detector collection.
-	for (auto& [varname, values] : intVarsMap) { values.clear(); }
-	for (auto& [varname, values] : doubleVarsMap) { values.clear(); }
-	for (auto& [varname, values] : stringVarsMap) { values.clear(); }
-
-
-	for (auto& dataHits : trueInfoData) {
-		// fill identity vars
-		auto identityMap = getIdentityMap(dataHits->getIdentity());
-		for (auto& [varname, value] : identityMap) {
-			intVarsMap[varname].push_back(value);
-		}
-
-		for (auto& [varname, value] : dataHits->getDoubleVariablesMap()) { doubleVarsMap[varname].push_back(value); }
-		for (auto& [varname, value] : dataHits->getStringVariablesMap()) { stringVarsMap[varname].push_back(value); }
+	clearColumns();
+
+	std::size_t row = 0;
+	for (const auto* dataHits : trueInfoData) {
+		fillIdentity(dataHits->getIdentity(), row);
+		fillMatching(doubleColumns, dataHits->getDoubleVariablesView(), 0, row);
+		fillMatching(stringColumns, dataHits->getStringVariablesView(), 0, row);
+		padRow(row++);
 	}
 
-	root_tree->Fill();
+	fill();
 
 	return true;
 }
@@ -181,106 +244,144 @@ bool GRootTree::fillTree(const std::vector<const GTrueInfoData*>& trueInfoData)
 // fill the Digitized Data Tree
 bool GRootTree::fillTree(const std::vector<const GDigitizedData*>& digitizedData) {
 	// Reset all branch vectors before repopulating them for this detector collection.
-	for (auto& [varname, values] : intVarsMap) { values.clear(); }
-	for (auto& [varname, values] : doubleVarsMap) { values.clear(); }
-	for (auto& [varname, values] : stringVarsMap) { values.clear(); }
-
-
-	for (auto& dataHits : digitizedData) {
-		// fill identity vars
-		auto identityMap = getIdentityMap(dataHits->getIdentity());
-		for (auto& [varname, value] : identityMap) {
-			intVarsMap[varname].push_back(value);
-		}
-
-
-		for (auto& [varname, value] : dataHits->getIntObservablesMap(0)) { intVarsMap[varname].push_back(value); }
-		for (auto& [varname, value] : dataHits->getDblObservablesMap(0)) { doubleVarsMap[varname].push_back(value); }
+	clearColumns();
+
+	// The views include the SRO and unselected variables, which are not part of the schema and are skipped.
+	std::size_t row = 0;
+	for (const auto* dataHits : digitizedData) {
+		fillIdentity(dataHits->getIdentity(), row);
+		fillMatching(intColumns, dataHits->getIntObservablesView(), nIdentityColumns, row);
+		fillMatching(doubleColumns, dataHits->getDblObservablesView(), 0, row);
+		padRow(row++);
 	}
-	root_tree->Fill();
+	fill();
 
 	return true;
 }
 
 bool GRootTree::fillTree(const GGeneratedParticleBank& particles) {
-	for (auto& [varname, values] : intVarsMap) { values.clear(); }
-	for (auto& [varname, values] : doubleVarsMap) { values.clear(); }
-	for (auto& [varname, values] : stringVarsMap) { values.clear(); }
+	clearColumns();
 
 	for (const auto& particle : particles) {
-		intVarsMap["pid"].push_back(particle.pid);
-		intVarsMap["type"].push_back(particle.type);
-		intVarsMap["multiplicity"].push_back(particle.multiplicity);
-		doubleVarsMap["p"].push_back(particle.p);
-		doubleVarsMap["theta"].push_back(particle.theta);
-		doubleVarsMap["phi"].push_back(particle.phi);
-		doubleVarsMap["vx"].push_back(particle.vx);
-		doubleVarsMap["vy"].push_back(particle.vy);
-		doubleVarsMap["vz"].push_back(particle.vz);
-		stringVarsMap["name"].push_back(particle.name);
+		intColumns.buffers[GEN_PID].push_back(particle.pid);
+		intColumns.buffers[GEN_TYPE].push_back(particle.type);
+		intColumns.buffers[GEN_MULTIPLICITY].push_back(particle.multiplicity);
+		doubleColumns.buffers[GEN_P].push_back(particle.p);
+		doubleColumns.buffers[GEN_THETA].push_back(particle.theta);
+		doubleColumns.buffers[GEN_PHI].push_back(particle.phi);
+		doubleColumns.buffers[GEN_VX].push_back(particle.vx);
+		doubleColumns.buffers[GEN_VY].push_back(particle.vy);
+		doubleColumns.buffers[GEN_VZ].push_back(particle.vz);
+		stringColumns.buffers[GEN_NAME].push_back(particle.name);
 	}
 
-	root_tree->Fill();
+	fill();
 	return true;
 }
 
 bool GRootTree::fillTree(const GAncestorBank& ancestors) {
-	for (auto& [varname, values] : intVarsMap) { values.clear(); }
-	for (auto& [varname, values] : doubleVarsMap) { values.clear(); }
+	clearColumns();
 
 	for (const auto& ancestor : ancestors) {
-		intVarsMap["pid"].push_back(ancestor.pid);
-		intVarsMap["tid"].push_back(ancestor.tid);
-		intVarsMap["mtid"].push_back(ancestor.mtid);
-		doubleVarsMap["trackE"].push_back(ancestor.trackE);
-		doubleVarsMap["px"].push_back(ancestor.px);
-		doubleVarsMap["py"].push_back(ancestor.py);
-		doubleVarsMap["pz"].push_back(ancestor.pz);
-		doubleVarsMap["vx"].push_back(ancestor.vx);
-		doubleVarsMap["vy"].push_back(ancestor.vy);
-		doubleVarsMap["vz"].push_back(ancestor.vz);
+		intColumns.buffers[ANC_PID].push_back(ancestor.pid);
+		intColumns.buffers[ANC_TID].push_back(ancestor.tid);
+		intColumns.buffers[ANC_MTID].push_back(ancestor.mtid);
+		doubleColumns.buffers[ANC_TRACKE].push_back(ancestor.trackE);
+		doubleColumns.buffers[ANC_PX].push_back(ancestor.px);
+		doubleColumns.buffers[ANC_PY].push_back(ancestor.py);
+		doubleColumns.buffers[ANC_PZ].push_back(ancestor.pz);
+		doubleColumns.buffers[ANC_VX].push_back(ancestor.vx);
+		doubleColumns.buffers[ANC_VY].push_back(ancestor.vy);
+		doubleColumns.buffers[ANC_VZ].push_back(ancestor.vz);
 	}
 
-	root_tree->Fill();
+	fill();
 	return true;
 }
 
+void GRootTree::fill() {
+	const auto nbytes = root_tree->Fill();
+	if (nbytes > 0) { filledBytes += nbytes; }
+}
+
+std::uint64_t GRootTree::pendingBytes() const {
+	// TTree::GetTotBytes() only grows when a basket is written, so the difference with the bytes
+	// filled so far is what still sits in memory. Scale it by the compression achieved so far.
+	const Long64_t written = root_tree->GetTotBytes();
+	if (filledBytes <= written) { return 0; }
+
+	const Long64_t zipped = root_tree->GetZipBytes();
+	const double   ratio  = written > 0 && zipped > 0 ? static_cast<double>(zipped) / static_cast<double>(written) : 1.0;
+	return static_cast<std::uint64_t>(static_cast<double>(filledBytes - written) * ratio);
+}
+
+void GRootTree::fillEmptyEntries(Long64_t nentries) {
+	if (root_tree->GetEntries() >= nentries) { return; }
+
+	clearColumns();
+	while (root_tree->GetEntries() < nentries) { fill(); }
+}
+
+void GRootTree::bindBranches(const GRootTreeSettings& settings) {
+	// AutoFlush controls when buffered basket data are pushed to disk.
+	root_tree->SetAutoFlush(settings.autoFlush);
+
+	// AutoSave periodically writes tree metadata snapshots for recoverability.
+	root_tree->SetAutoSave(settings.autoSave);
+
+	bindColumns(root_tree.get(), intColumns, settings);
+	bindColumns(root_tree.get(), doubleColumns, settings);
+	bindColumns(root_tree.get(), stringColumns, settings);
+}
+
+void GRootTree::clearColumns() {
+	intColumns.clear();
+	doubleColumns.clear();
+	stringColumns.clear();
+}
+
+// Identity vectors have a fixed order per detector, so position i normally maps to column i.
+void GRootTree::fillIdentity(const std::vector<GIdentifier>& identity, std::size_t row) {
+	for (std::size_t i = 0; i < identity.size(); i++) {
+		std::size_t column = i;
+		if (column >= nIdentityColumns || intColumns.names[column] != identity[i].getName()) {
+			const auto it = intColumns.index.find(identity[i].getName());
+			if (it == intColumns.index.end() || it->second >= nIdentityColumns) { continue; }
+			column = it->second;
+		}
+		auto& buffer = intColumns.buffers[column];
+		if (buffer.size() == row) { buffer.push_back(identity[i].getValue()); }
+	}
+}
+
+void GRootTree::padRow(std::size_t row) {
+	padColumns(intColumns, row);
+	padColumns(doubleColumns, row);
+	padColumns(stringColumns, row);
+}
+
 
 // Implementation summary:
-// Register one branch and bind it to the appropriate backing vector map.
+// Register one column in the schema. Branches are bound later, in one go, by bindBranches().
 // The second parameter is used only to select the correct overload.
 
 void GRootTree::registerVariable(const std::string& varname, [[maybe_unused]] int value,
                                  bool can_ignore_duplicates) {
-	if (can_ignore_duplicates) {
-		root_tree->Branch(varname.c_str(), &intVarsMap[varname]);
-	}
-	else {
-		if (intVarsMap.find(varname) == intVarsMap.end()) {
-			root_tree->Branch(varname.c_str(), &intVarsMap[varname]);
-		}
-		else {
-			log->error(gstreamer::ERR_GSTREAMERVARIABLEEXISTS, "variable <", varname,
-					   "> already registered in the int variable map of tree ", root_tree->GetName());
-		}
+	if (!addColumn(intColumns, varname) && !can_ignore_duplicates) {
+		log->error(gstreamer::ERR_GSTREAMERVARIABLEEXISTS, "variable <", varname,
+				   "> already registered in the int variable map of tree ", root_tree->GetName());
 	}
 }
 
 void GRootTree::registerVariable(const std::string& varname, [[maybe_unused]] double value) {
-	if (doubleVarsMap.find(varname) == doubleVarsMap.end()) {
-		root_tree->Branch(varname.c_str(), &doubleVarsMap[varname]);
-	}
-	else {
+	if (!addColumn(doubleColumns, varname)) {
 		log->error(gstreamer::ERR_GSTREAMERVARIABLEEXISTS, "variable <", varname,
 				   "> already registered in the double variable map of tree ", root_tree->GetName());
 	}
 }
 
 void GRootTree::registerVariable(const std::string& varname, [[maybe_unused]] const std::string& value) {
-	if (stringVarsMap.find(varname) == stringVarsMap.end()) {
-		root_tree->Branch(varname.c_str(), &stringVarsMap[varname]);
-	}
-	else {
+	if (!addColumn(stringColumns, varname)) {
 		log->error(gstreamer::ERR_GSTREAMERVARIABLEEXISTS, "variable <", varname,
 				   "> already registered in the string variable map of tree ", root_tree->GetName());
 	}
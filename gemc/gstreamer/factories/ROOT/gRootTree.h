@@ -1,7 +1,10 @@
 #pragma once
 
 // c++
-#include <map>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // ROOT
 #include "TTree.h"
@@ -10,6 +13,8 @@
 // gemc
 #include "event/gEventDataCollection.h"
 #include "run/gRunDataCollection.h"
+#include "gRootTreeSettings.h"
+#include "gstreamerSelection.h"
 
 namespace gstreamer::root {
 inline constexpr char EVENTHEADERTREENAME[] = "event_header";
@@ -20,6 +25,7 @@ inline constexpr char GENERATEDTREENAMEDESC[] = "Generated Particles";
 inline constexpr char ANCESTORTREENAME[] = "ancestors";
 inline constexpr char ANCESTORTREENAMEDESC[] = "Geant4 Ancestors";
 inline constexpr int ERR_GSTREAMERROOTTREENOTFOUND = 850;
+inline constexpr int ERR_GSTREAMERROOTSETTINGS = 851;
 inline constexpr char EVENTHEADERTREENAMEDESC[] = "Event Header";
 inline constexpr char RUNHEADERTREENAMEDESC[] = "Run Header";
 inline constexpr char TRUEINFOTREENAMEDESC[] = "True Info Data";
@@ -39,7 +45,7 @@ inline constexpr char DIGITIZEDTREENAMEDESC[] = "Digitized Data";
  *
  * This class adapts GEMC header and hit data models to ROOT vector branches. It owns:
  * - one \c TTree
- * - one set of branch storage maps keyed by variable name
+ * - one fixed set of column buffers, each bound to its branch once at construction
  * - the logic needed to clear, refill, and write one entry per publish call
  *
  * Data organization:
@@ -48,9 +54,14 @@ inline constexpr char DIGITIZEDTREENAMEDESC[] = "Digitized Data";
  * - text variables are stored in \c std::vector<std::string> branches
  *
  * For hit-based trees, one branch vector entry corresponds to one hit in the published detector
- * collection. The same hit index therefore lines up across all branch vectors in a given tree fill.
+ * collection. The same hit index therefore lines up across all branch vectors in a given tree fill:
+ * a hit missing one of the schema variables gets a default value in that column.
  * Generated-particle trees use the same vector-branch model, with one branch vector entry per
  * generated-particle row in the bank.
+ *
+ * The schema is frozen when the tree is built. Hit values are matched to columns by walking the
+ * hit's sorted variable maps in step with the column list, so the common case costs one string
+ * comparison per value and no map lookup or allocation. Values absent from the schema are dropped.
  */
 class GRootTree
 {
@@ -67,9 +78,11 @@ public:
 	 * - \c timeStamp
 	 *
 	 * \param gevent_header Event header used to determine and initialize the schema.
+	 * \param settings Compression, basket, and flush settings for this tree kind.
 	 * \param log Logger used for diagnostics.
 	 */
-	GRootTree([[maybe_unused]] const std::unique_ptr<GEventHeader>& gevent_header, std::shared_ptr<GLogger>& log);
+	GRootTree([[maybe_unused]] const std::unique_ptr<GEventHeader>& gevent_header, const GRootTreeSettings& settings,
+	          std::shared_ptr<GLogger>& log);
 
 	/**
 	 * \brief Construct a run-header tree and register its branches.
@@ -77,9 +90,11 @@ public:
 	 * The run-header schema contains the run identifier.
 	 *
 	 * \param grun_header Run header used to determine and initialize the schema.
+	 * \param settings Compression, basket, and flush settings for this tree kind.
 	 * \param log Logger used for diagnostics.
 	 */
-	GRootTree([[maybe_unused]] const std::unique_ptr<GRunHeader>& grun_header, std::shared_ptr<GLogger>& log);
+	GRootTree([[maybe_unused]] const std::unique_ptr<GRunHeader>& grun_header, const GRootTreeSettings& settings,
+	          std::shared_ptr<GLogger>& log);
 
 	/**
 	 * \brief Construct a true-information tree for one detector and register its branches.
@@ -88,11 +103,16 @@ public:
 	 * - double-valued variables become \c std::vector<double> branches
 	 * - string-valued variables become \c std::vector<std::string> branches
 	 *
+	 * Variables not selected by \p selection get no branch and are skipped when filling.
+	 *
 	 * \param detectorName Final ROOT tree name for this detector collection.
 	 * \param gdata Sample true-information hit used to determine the schema.
+	 * \param settings Compression, basket, and flush settings for this tree kind.
+	 * \param selection Output selection of the streamer owning the tree.
 	 * \param log Logger used for diagnostics.
 	 */
-	GRootTree(const std::string& detectorName, const GTrueInfoData* gdata, std::shared_ptr<GLogger>& log);
+	GRootTree(const std::string& detectorName, const GTrueInfoData* gdata, const GRootTreeSettings& settings,
+	          const GStreamerSelection& selection, std::shared_ptr<GLogger>& log);
 
 	/**
 	 * \brief Construct a digitized-data tree for one detector and register its branches.
@@ -101,11 +121,16 @@ public:
 	 * - integer observables become \c std::vector<int> branches
 	 * - floating-point observables become \c std::vector<double> branches
 	 *
+	 * Observables not selected by \p selection get no branch and are skipped when filling.
+	 *
 	 * \param detectorName Final ROOT tree name for this detector collection.
 	 * \param gdata Sample digitized hit used to determine the schema.
+	 * \param settings Compression, basket, and flush settings for this tree kind.
+	 * \param selection Output selection of the streamer owning the tree.
 	 * \param log Logger used for diagnostics.
 	 */
-	GRootTree(const std::string& detectorName, const GDigitizedData* gdata, std::shared_ptr<GLogger>& log);
+	GRootTree(const std::string& detectorName, const GDigitizedData* gdata, const GRootTreeSettings& settings,
+	          const GStreamerSelection& selection, std::shared_ptr<GLogger>& log);
 
 	/**
 	 * \brief Construct a generated-particle tree and register its branches.
@@ -115,12 +140,14 @@ public:
 	 *
 	 * \param treeName Final ROOT tree name, normally \c generated or \c generated_tracked.
 	 * \param particles Sample bank used to initialize the schema.
+	 * \param settings Compression, basket, and flush settings for this tree kind.
 	 * \param log Logger used for diagnostics.
 	 */
-	GRootTree(const std::string& treeName, const GGeneratedParticleBank& particles, std::shared_ptr<GLogger>& log);
+	GRootTree(const std::string& treeName, const GGeneratedParticleBank& particles, const GRootTreeSettings& settings,
+	          std::shared_ptr<GLogger>& log);
 
 	/** \brief Construct the fixed-schema ancestor tree. */
-	GRootTree(const GAncestorBank& ancestors, std::shared_ptr<GLogger>& log);
+	GRootTree(const GAncestorBank& ancestors, const GRootTreeSettings& settings, std::shared_ptr<GLogger>& log);
 
 	/**
 	 * \brief Fill the event-header tree with one event header entry.
@@ -174,18 +201,83 @@ public:
 	/** \brief Fill the ancestor tree with one event bank. */
 	bool fillTree(const GAncestorBank& ancestors);
 
+	/**
+	 * \brief Append empty entries until the tree holds \p nentries entries.
+	 *
+	 * Used to keep per-detector trees aligned with the event-header tree when a detector has no hits
+	 * in an event, including events published before the detector tree existed.
+	 *
+	 * \param nentries Target number of entries.
+	 */
+	void fillEmptyEntries(Long64_t nentries);
+
+	/// \brief Number of entries written so far.
+	[[nodiscard]] Long64_t entries() const { return root_tree->GetEntries(); }
+
+	/**
+	 * \brief Estimated file bytes of the entries still held in unwritten baskets.
+	 *
+	 * The uncompressed size of the pending baskets is scaled by the compression ratio the tree
+	 * achieved so far, or taken as is before its first basket is written.
+	 *
+	 * \return Estimated bytes that the next basket flush adds to the file.
+	 */
+	[[nodiscard]] std::uint64_t pendingBytes() const;
+
 private:
+	/// \brief Fills one entry and counts the bytes committed to the baskets.
+	void fill();
+
+	/// \brief Uncompressed bytes committed by fill() so far.
+	Long64_t filledBytes = 0;
+
+	/**
+	 * \brief Branch buffers of one value type.
+	 *
+	 * \c buffers is sized once by bindBranches() and never resized afterwards, so the addresses
+	 * handed to \c TTree::Branch stay valid for the lifetime of the tree.
+	 */
+	template <typename T>
+	struct Columns
+	{
+		std::vector<std::string>                     names;
+		std::unordered_map<std::string, std::size_t> index;
+		std::vector<std::vector<T>>                  buffers;
+
+		/// Empties every buffer, keeping its capacity for the next entry.
+		void clear() { for (auto& buffer : buffers) { buffer.clear(); } }
+	};
+
 	/// \brief Owned ROOT tree instance receiving all branch data.
 	std::unique_ptr<TTree> root_tree;
 
-	/// \brief Integer branch storage keyed by variable name.
-	std::map<std::string, std::vector<int>> intVarsMap;
+	/// \brief Integer branch storage, identity columns first.
+	Columns<int> intColumns;
+
+	/// \brief Floating-point branch storage.
+	Columns<double> doubleColumns;
+
+	/// \brief String branch storage.
+	Columns<std::string> stringColumns;
+
+	/// \brief Number of leading integer columns holding the hit identity.
+	std::size_t nIdentityColumns = 0;
+
+	/**
+	 * \brief Create the column buffers and bind each one to its branch. Called once per constructor.
+	 *
+	 * \param settings Storage settings applied to the tree and to every branch.
+	 */
+	void bindBranches(const GRootTreeSettings& settings);
+
+	/// \brief Clear every column buffer.
+	void clearColumns();
 
-	/// \brief Floating-point branch storage keyed by the variable name.
-	std::map<std::string, std::vector<double>> doubleVarsMap;
+	/// \brief Append the identity of one hit to the identity columns.
+	void fillIdentity(const std::vector<GIdentifier>& identity, std::size_t row);
 
-	/// \brief String branch storage keyed by the variable name.
-	std::map<std::string, std::vector<std::string>>stringVarsMap;
+	/// \brief Give a default value to every column that received no value for hit \p row.
+	void padRow(std::size_t row);
 
 	/**
 	 * \brief Register one integer branch.
@@ -0,0 +1,138 @@
+// gstreamer
+#include "gRootTreeSettings.h"
+#include "gRootTree.h"
+
+// ROOT
+#include "Compression.h"
+
+// c++
+#include <algorithm>
+#include <charconv>
+#include <sstream>
+#include <vector>
+
+// Implementation summary:
+// Parse the per-streamer storage keys into one GRootTreeSettings per tree kind.
+
+namespace {
+
+std::optional<GRootTreeKind> treeKind(const std::string& name) {
+	if (name == "header") { return GRootTreeKind::header; }
+	if (name == "generated") { return GRootTreeKind::generated; }
+	if (name == "ancestors") { return GRootTreeKind::ancestors; }
+	if (name == "true_info") { return GRootTreeKind::trueInfo; }
+	if (name == "digitized") { return GRootTreeKind::digitized; }
+	return std::nullopt;
+}
+
+template <typename T>
+std::optional<T> parseNumber(const std::string& text) {
+	T          value{};
+	const auto last   = text.data() + text.size();
+	const auto result = std::from_chars(text.data(), last, value);
+	if (result.ec != std::errc() || result.ptr != last) { return std::nullopt; }
+	return value;
+}
+
+// algorithm[:level], with algorithm none, zlib, lzma, lz4, or zstd.
+std::optional<int> parseCompression(const std::string& text) {
+	const auto        separator = text.find(':');
+	const std::string algorithm = text.substr(0, separator);
+
+	// Uncompressed output takes no level.
+	if (algorithm == "none") { return separator == std::string::npos ? std::optional<int>(0) : std::nullopt; }
+
+	// Default levels follow ROOT's recommendation for each algorithm.
+	ROOT::RCompressionSetting::EAlgorithm::EValues code;
+	int                                            level;
+	if (algorithm == "zlib") {
+		code  = ROOT::RCompressionSetting::EAlgorithm::kZLIB;
+		level = 1;
+	}
+	else if (algorithm == "lzma") {
+		code  = ROOT::RCompressionSetting::EAlgorithm::kLZMA;
+		level = 7;
+	}
+	else if (algorithm == "lz4") {
+		code  = ROOT::RCompressionSetting::EAlgorithm::kLZ4;
+		level = 4;
+	}
+	else if (algorithm == "zstd") {
+		code  = ROOT::RCompressionSetting::EAlgorithm::kZSTD;
+		level = 5;
+	}
+	else { return std::nullopt; }
+
+	if (separator != std::string::npos) {
+		const auto parsed = parseNumber<int>(text.substr(separator + 1));
+		if (!parsed || *parsed < 1 || *parsed > 9) { return std::nullopt; }
+		level = *parsed;
+	}
+	return ROOT::CompressionSettings(code, level);
+}
+
+// Applies one comma-separated option value. A bare entry sets every kind, kind=value one kind only.
+// Bare entries are applied first so that overrides win regardless of their position in the list.
+template <typename Parse, typename Assign>
+void applyOption(const std::string& option, std::string entries, const std::shared_ptr<GLogger>& log,
+                 Parse parse, Assign assign) {
+	std::replace(entries.begin(), entries.end(), ',', ' ');
+
+	std::vector<std::pair<std::optional<GRootTreeKind>, std::string>> values;
+	std::istringstream stream(entries);
+	std::string        entry;
+	while (stream >> entry) {
+		const auto separator = entry.find('=');
+		if (separator == std::string::npos) {
+			values.emplace_back(std::nullopt, entry);
+			continue;
+		}
+		const auto kind = treeKind(entry.substr(0, separator));
+		if (!kind) {
+			log->error(gstreamer::root::ERR_GSTREAMERROOTSETTINGS, "invalid ", option, " entry <", entry,
+			           ">: tree kind must be one of header, generated, ancestors, true_info, digitized");
+		}
+		values.emplace_back(kind, entry.substr(separator + 1));
+	}
+	std::stable_partition(values.begin(), values.end(), [](const auto& value) { return !value.first; });
+
+	for (const auto& [kind, text] : values) {
+		const auto parsed = parse(text);
+		if (!parsed) {
+			log->error(gstreamer::root::ERR_GSTREAMERROOTSETTINGS, "invalid ", option, " value <", text, ">");
+		}
+		assign(kind, *parsed);
+	}
+}
+
+} // namespace
+
+// See header for API docs.
+GRootStorageSettings::GRootStorageSettings(const GStreamerDefinition& definition, const std::shared_ptr<GLogger>& log) {
+	auto forEachKind = [this](const std::optional<GRootTreeKind>& kind, auto member, auto value) {
+		if (kind) { settings[static_cast<std::size_t>(*kind)].*member = value; }
+		else { for (auto& tree : settings) { tree.*member = value; } }
+	};
+
+	applyOption("compression", definition.compression, log, parseCompression,
+	            [&](const std::optional<GRootTreeKind>& kind, int value) {
+		            if (!kind) { file_compression = value; }
+		            forEachKind(kind, &GRootTreeSettings::compression, value);
+	            });
+	applyOption("basket_size", definition.basket_size, log,
+	            [](const std::string& text) {
+		            auto value = parseNumber<int>(text);
+		            return value && *value > 0 ? value : std::nullopt;
+	            },
+	            [&](const std::optional<GRootTreeKind>& kind, int value) {
+		            forEachKind(kind, &GRootTreeSettings::basketSize, value);
+	            });
+	applyOption("auto_flush", definition.auto_flush, log, parseNumber<Long64_t>,
+	            [&](const std::optional<GRootTreeKind>& kind, Long64_t value) {
+		            forEachKind(kind, &GRootTreeSettings::autoFlush, value);
+	            });
+	applyOption("auto_save", definition.auto_save, log, parseNumber<Long64_t>,
+	            [&](const std::optional<GRootTreeKind>& kind, Long64_t value) {
+		            forEachKind(kind, &GRootTreeSettings::autoSave, value);
+	            });
+}
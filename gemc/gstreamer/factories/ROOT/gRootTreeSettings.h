@@ -0,0 +1,98 @@
+#pragma once
+
+// gstreamer
+#include "gstreamer_options.h"
+
+// gemc
+#include "glogger.h"
+
+// ROOT
+#include "RtypesCore.h"
+
+// c++
+#include <array>
+#include <optional>
+#include <string>
+
+/**
+ * \file gRootTreeSettings.h
+ * \brief Storage tuning (compression, basket size, flush cadence) for the ROOT gstreamer plugin.
+ * \ingroup gstreamer_plugin_root_api
+ */
+
+/**
+ * \ingroup gstreamer_plugin_root_api
+ * \brief Kinds of trees written by the ROOT plugin, each tunable on its own.
+ */
+enum class GRootTreeKind
+{
+	header,    ///< \c event_header and \c run_header
+	generated, ///< \c generated and \c generated_tracked
+	ancestors, ///< \c ancestors
+	trueInfo,  ///< \c true_info_<detector>
+	digitized  ///< \c digitized_<detector>
+};
+
+/**
+ * \ingroup gstreamer_plugin_root_api
+ * \brief Storage settings applied to one tree when it is created.
+ */
+struct GRootTreeSettings
+{
+	/// \brief ROOT compression settings (algorithm * 100 + level), or a negative value to inherit the file setting.
+	int compression = -1;
+
+	/// \brief Basket size in bytes of every branch of the tree.
+	int basketSize = 32000;
+
+	/// \brief \c TTree::SetAutoFlush threshold: positive for entries, negative for bytes.
+	Long64_t autoFlush = -20 * 1024 * 1024;
+
+	/// \brief \c TTree::SetAutoSave threshold: positive for entries, negative for bytes.
+	Long64_t autoSave = -50 * 1024 * 1024;
+};
+
+/**
+ * \class GRootStorageSettings
+ * \ingroup gstreamer_plugin_root_api
+ * \brief Per-streamer table of GRootTreeSettings, one entry per GRootTreeKind.
+ *
+ * Built once when the output file is opened, from the optional \c compression, \c basket_size,
+ * \c auto_flush, and \c auto_save keys of the streamer definition. Each key is a comma-separated
+ * list: a bare value sets every tree kind, and \c kind=value overrides a single kind:
+ *
+ * \code
+ * compression: 'zstd:5, header=lz4:1'
+ * basket_size: '32000, true_info=256000'
+ * \endcode
+ *
+ * A bare compression value also becomes the file-level compression.
+ */
+class GRootStorageSettings
+{
+public:
+	/// \brief Plugin defaults for every tree kind.
+	GRootStorageSettings() = default;
+
+	/**
+	 * \brief Parses the storage keys of one streamer definition.
+	 *
+	 * Malformed entries are fatal and reported through \p log.
+	 *
+	 * \param definition Streamer definition holding the raw option strings.
+	 * \param log Logger used for diagnostics.
+	 */
+	GRootStorageSettings(const GStreamerDefinition& definition, const std::shared_ptr<GLogger>& log);
+
+	/// \brief Settings for trees of the given kind.
+	[[nodiscard]] const GRootTreeSettings& forKind(GRootTreeKind kind) const {
+		return settings[static_cast<std::size_t>(kind)];
+	}
+
+	/// \brief File-level compression, when a bare compression value was given.
+	[[nodiscard]] std::optional<int> fileCompression() const { return file_compression; }
+
+private:
+	std::array<GRootTreeSettings, 5> settings{};
+	std::optional<int>               file_compression;
+};
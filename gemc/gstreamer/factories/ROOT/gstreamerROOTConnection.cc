@@ -4,6 +4,7 @@
 
 // root
 #include <TFile.h>
+#include <TTree.h>
 
 // Implementation summary:
 // Manage the lifetime of the ROOT file that owns all trees created by the plugin.
@@ -11,7 +12,12 @@
 bool GstreamerRootFactory::openConnection() {
 	log->debug(NORMAL, "GstreamerRootFactory::openConnection -> opening file " + filename());
 
+	storage_settings = GRootStorageSettings(gstreamer_definitions, log);
+
 	rootfile = std::make_unique<TFile>(filename().c_str(), "RECREATE");
+	if (const auto compression = storage_settings.fileCompression()) {
+		rootfile->SetCompressionSettings(*compression);
+	}
 
 	if (rootfile->IsZombie()) {
 		log->error(gstreamer::ERR_CANTOPENOUTPUT,
@@ -35,4 +41,42 @@ bool GstreamerRootFactory::closeConnectionImpl() {
 	log->info(1, SFUNCTION_NAME, "GstreamerRootFactory: closed file " + filename());
 
 	return true;
-}
\ No newline at end of file
+}
+
+std::uint64_t GstreamerRootFactory::outputBytes() {
+	if (rootfile == nullptr) { return 0; }
+
+	// GetEND() only covers written baskets: add the estimate of what the trees still buffer.
+	auto bytes = static_cast<std::uint64_t>(rootfile->GetEND());
+	for (const auto& [name, tree] : gRootTrees) {
+		if (tree != nullptr) { bytes += tree->pendingBytes(); }
+	}
+	return bytes;
+}
+
+bool GstreamerRootFactory::publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) {
+	if (rootfile == nullptr) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, "GstreamerRootFactory: file is not initialized");
+	}
+
+	rootfile->cd();
+	TTree       names("names", "process and particle name tables");
+	std::string table;
+	int         id = 0;
+	std::string name;
+	names.Branch("table", &table);
+	names.Branch("id", &id);
+	names.Branch("name", &name);
+
+	for (const auto& [tableName, nameTable] : {std::pair{"process", &processes}, std::pair{"particle", &particles}}) {
+		table = tableName;
+		for (const auto& [entryId, entryName] : nameTable->entries()) {
+			id   = entryId;
+			name = entryName;
+			names.Fill();
+		}
+	}
+
+	// The tree is written now and detached from the file when it goes out of scope.
+	return names.Write() > 0;
+}
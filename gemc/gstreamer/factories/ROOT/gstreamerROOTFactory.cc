@@ -40,7 +40,7 @@ const std::unique_ptr<GRootTree>& GstreamerRootFactory::getOrInstantiateHeaderTr
 	auto& treePtr = gRootTrees[gstreamer::root::EVENTHEADERTREENAME];
 	if (!treePtr) {
 		log->info(2, "GstreamerRootFactory", "Creating ROOT", gstreamer::root::EVENTHEADERTREENAME, " tree");
-		treePtr = std::make_unique<GRootTree>(event_header, log);
+		treePtr = std::make_unique<GRootTree>(event_header, storage_settings.forKind(GRootTreeKind::header), log);
 	}
 
 	return treePtr;
@@ -65,7 +65,7 @@ const std::unique_ptr<GRootTree>& GstreamerRootFactory::getOrInstantiateHeaderTr
 	auto& treePtr = gRootTrees[gstreamer::root::RUNHEADERTREENAME];
 	if (!treePtr) {
 		log->info(2, "GstreamerRootFactory", "Creating ROOT", gstreamer::root::RUNHEADERTREENAME, " tree");
-		treePtr = std::make_unique<GRootTree>(run_header, log);
+		treePtr = std::make_unique<GRootTree>(run_header, storage_settings.forKind(GRootTreeKind::header), log);
 	}
 
 	return treePtr;
@@ -82,7 +82,9 @@ const std::unique_ptr<GRootTree>& GstreamerRootFactory::getOrInstantiateTrueInfo
 	auto& treePtr = gRootTrees[treeName];
 	if (!treePtr) {
 		log->info(2, "GstreamerRootFactory", "Creating GTrueInfoData ROOT tree for ", detectorName);
-		treePtr = std::make_unique<GRootTree>(treeName, gdata, log);
+		const auto& settings = storage_settings.forKind(GRootTreeKind::trueInfo);
+		treePtr              = std::make_unique<GRootTree>(treeName, gdata, settings, output_selection, log);
+		alignNewTree(treePtr);
 	}
 
 	return treePtr;
@@ -99,7 +101,9 @@ const std::unique_ptr<GRootTree>& GstreamerRootFactory::getOrInstantiateDigitize
 	auto& treePtr = gRootTrees[treeName];
 	if (!treePtr) {
 		log->info(2, "GstreamerRootFactory", "Creating GDigitizedData ROOT tree for ", detectorName);
-		treePtr = std::make_unique<GRootTree>(treeName, gdata, log);
+		const auto& settings = storage_settings.forKind(GRootTreeKind::digitized);
+		treePtr              = std::make_unique<GRootTree>(treeName, gdata, settings, output_selection, log);
+		alignNewTree(treePtr);
 	}
 
 	return treePtr;
@@ -112,7 +116,9 @@ const std::unique_ptr<GRootTree>& GstreamerRootFactory::getOrInstantiateGenerate
 	auto& treePtr = gRootTrees[treeName];
 	if (!treePtr) {
 		log->info(2, "GstreamerRootFactory", "Creating generated-particle ROOT tree for ", treeName);
-		treePtr = std::make_unique<GRootTree>(treeName, particles, log);
+		const auto& settings = storage_settings.forKind(GRootTreeKind::generated);
+		treePtr              = std::make_unique<GRootTree>(treeName, particles, settings, log);
+		alignNewTree(treePtr);
 	}
 
 	return treePtr;
@@ -124,11 +130,23 @@ const std::unique_ptr<GRootTree>& GstreamerRootFactory::getOrInstantiateAncestor
 	auto& tree_ptr = gRootTrees[gstreamer::root::ANCESTORTREENAME];
 	if (!tree_ptr) {
 		log->info(2, "GstreamerRootFactory", "Creating ancestor ROOT tree");
-		tree_ptr = std::make_unique<GRootTree>(ancestors, log);
+		tree_ptr = std::make_unique<GRootTree>(ancestors, storage_settings.forKind(GRootTreeKind::ancestors), log);
+		alignNewTree(tree_ptr);
 	}
 	return tree_ptr;
 }
 
+Long64_t GstreamerRootFactory::publishedEvents() const {
+	const auto header = gRootTrees.find(gstreamer::root::EVENTHEADERTREENAME);
+	return header == gRootTrees.end() ? 0 : header->second->entries();
+}
+
+// The current event header is already written when a detector tree is created, so the new tree is
+// padded to one entry short of the header tree and the current event then fills the last one.
+void GstreamerRootFactory::alignNewTree(const std::unique_ptr<GRootTree>& tree) const {
+	tree->fillEmptyEntries(publishedEvents() - 1);
+}
+
 
 // Implementation summary:
 // Export the factory symbol required by the plugin loader.
@@ -31,6 +31,10 @@
  * Tree creation is demand-driven. The first hit seen for a detector determines the variable schema
  * used to build the corresponding \c TTree via GRootTree.
  *
+ * Event-level trees stay aligned with the \c event_header tree: entry \c i of every tree belongs to
+ * the same event. A tree created after some events were already written is first padded with empty
+ * entries, and at the end of each event every tree that received no data is given an empty entry.
+ *
  * Threading model:
  * - one plugin instance per worker thread is the intended usage
  * - the plugin enables ROOT thread safety at library load time
@@ -56,6 +60,9 @@ private:
 	 */
 	bool closeConnectionImpl() override;
 
+	/// \brief End of the ROOT file plus the estimated size of the baskets not yet flushed.
+	std::uint64_t outputBytes() override;
+
 	/**
 	 * \brief Begin one event publication cycle.
 	 *
@@ -116,6 +123,17 @@ private:
 	/** \brief Publish the event ancestor bank into the ancestors tree. */
 	bool publishEventAncestorsImpl(const GAncestorBank& ancestors) override;
 
+	/**
+	 * \brief Write the process and particle name tables into the \c names tree.
+	 *
+	 * The tree holds one entry per name, with the table (\c process or \c particle), id, and name.
+	 *
+	 * \param processes Process name table.
+	 * \param particles Particle name table.
+	 * \return \c true on success, \c false otherwise.
+	 */
+	bool publishNameTablesImpl(const GNameTable& processes, const GNameTable& particles) override;
+
 	/**
 	 * \brief Begin one run publication cycle.
 	 *
@@ -202,12 +220,29 @@ private:
 	                                                                        const GGeneratedParticleBank& particles);
 	const std::unique_ptr<GRootTree>& getOrInstantiateAncestorTree(const GAncestorBank& ancestors);
 
+	/**
+	 * \brief Number of events written to the event-header tree so far.
+	 *
+	 * \return The event-header entry count, or zero before the first event.
+	 */
+	[[nodiscard]] Long64_t publishedEvents() const;
+
+	/**
+	 * \brief Pads a freshly created event-level tree with one empty entry per earlier event.
+	 *
+	 * \param tree Tree just created while publishing the current event.
+	 */
+	void alignNewTree(const std::unique_ptr<GRootTree>& tree) const;
+
 	/// \brief Map of lazily created ROOT trees keyed by logical tree name.
 	std::unordered_map<std::string, std::unique_ptr<GRootTree>> gRootTrees;
 
 	/// \brief ROOT file owning all trees written by this plugin instance.
 	std::unique_ptr<TFile> rootfile;
 
+	/// \brief Compression, basket, and flush settings per tree kind, parsed when the file is opened.
+	GRootStorageSettings storage_settings;
+
 	/**
 	 * \brief Return the final ROOT filename for this plugin instance.
 	 *
@@ -3,6 +3,10 @@
 
 // gemc
 #include "gutilities.h"
+#include <gemc/gdata/gdataConventions.h>
+
+// c++
+#include <filesystem>
 
 // Implementation summary:
 // Common base-class logic for format validation, buffered event publication,
@@ -10,7 +14,7 @@
 
 const std::vector<std::string>& GStreamer::supported_formats() {
 	// Keep this list aligned with the available gstreamer_<format>_plugin factories.
-	static const std::vector<std::string> formats = {"jlabsro", "root", "ascii", "csv", "json"};
+	static const std::vector<std::string> formats = {"jlabsro", "root", "ascii", "csv", "json", "gbin"};
 	return formats;
 }
 
@@ -21,7 +25,82 @@ bool GStreamer::is_valid_format(const std::string& format) {
 }
 
 
-// pragma todo: pass someting like map<string, bitset> to each detector to decide which data to publish
+void GStreamer::define_gstreamer(const GStreamerDefinition& gstreamerDefinition, int tid) {
+	gstreamer_definitions = GStreamerDefinition(gstreamerDefinition, tid);
+	output_selection      = GStreamerSelection(gstreamer_definitions, log);
+
+	if (gstreamer_definitions.rotate_events < 0 || gstreamer_definitions.rotate_bytes < 0) {
+		log->error(gstreamer::ERR_INVALID_ROTATION, "rotate_events and rotate_bytes of output ",
+		           gstreamer_definitions.rootname, " must not be negative");
+	}
+
+	const auto& layout = gstreamer_definitions.true_info_layout;
+	if (!layout.empty() && layout != gstreamer::TRUEINFO_LAYOUT_FLAT && layout != gstreamer::TRUEINFO_LAYOUT_TRACKS) {
+		log->error(gstreamer::ERR_INVALID_TRUEINFO_LAYOUT, "true_info_layout of output ",
+		           gstreamer_definitions.rootname, " must be ", gstreamer::TRUEINFO_LAYOUT_FLAT, " or ",
+		           gstreamer::TRUEINFO_LAYOUT_TRACKS, ", not ", layout);
+	}
+	publishTrackLayout = layout == gstreamer::TRUEINFO_LAYOUT_TRACKS;
+
+	base_rootname     = gstreamer_definitions.rootname;
+	output_file_index = 0;
+	next_file_pending = false;
+	if (rotates()) { next_output_file(); }
+}
+
+void GStreamer::next_output_file() {
+	const auto index   = std::to_string(++output_file_index);
+	const auto padding = std::string(index.size() < 4 ? 4 - index.size() : 0, '0');
+
+	gstreamer_definitions.rootname = base_rootname + "_" + padding + index;
+	records_in_file                = 0;
+}
+
+// Called between two events or frames, so the closed file ends on a complete record.
+void GStreamer::rotate_if_due() {
+	if (!rotates()) { return; }
+	++records_in_file;
+
+	const auto& definition = gstreamer_definitions;
+	const bool  full_events = definition.rotate_events > 0 && records_in_file >= definition.rotate_events;
+	const bool  full_bytes  = definition.rotate_bytes > 0 &&
+		outputBytes() >= static_cast<std::uint64_t>(definition.rotate_bytes);
+	if (!full_events && !full_bytes) { return; }
+
+	log->info(1, "GStreamer: closing ", filename(), " after ", records_in_file, " records");
+	publish_name_tables();
+	if (!closeConnectionImpl()) {
+		log->error(gstreamer::ERR_CANTCLOSEOUTPUT, "could not close rotated output ", filename());
+	}
+	next_output_file();
+
+	// The next file is opened by the next publish, so a run ending on a full file leaves no empty one behind.
+	next_file_pending = true;
+}
+
+void GStreamer::open_pending_file() {
+	if (!next_file_pending) { return; }
+	next_file_pending = false;
+
+	if (!openConnection()) {
+		log->error(gstreamer::ERR_CANTOPENOUTPUT, "could not open rotated output ", filename());
+	}
+}
+
+void GStreamer::publish_name_tables() {
+	if (!events_in_file) { return; }
+	events_in_file = false;
+
+	log->info(2, "GStreamer::publishNameTables -> ",
+	          gutilities::success_or_fail(publishNameTablesImpl(GNameTable::processes(), GNameTable::particles())));
+}
+
+std::uint64_t GStreamer::outputBytes() {
+	std::error_code ec;
+	const auto      bytes = std::filesystem::file_size(filename(), ec);
+	return ec ? 0 : bytes;
+}
+
 void GStreamer::publishEventData(const std::shared_ptr<GEventDataCollection>& event_data) {
 	// The event collection and its header are required for any plugin to publish
 	// a meaningful event record.
@@ -36,8 +115,16 @@ void GStreamer::publishEventData(const std::shared_ptr<GEventDataCollection>& ev
 	// that raw pointers extracted later from hit collections remain valid.
 	eventBuffer.emplace_back(event_data);
 
-	// Once the configured threshold is reached, publish all buffered events in one pass.
-	if (eventBuffer.size() >= bufferFlushLimit) { flushEventBuffer(); }
+	// Events are normally frozen by the event action; freezing here covers producers that do not.
+	// The first streamer to see the event builds the views, the others reuse them.
+	event_data->freeze();
+	if (bufferFlushBytes > 0) { bufferedBytes += event_data->estimatedBytes(); }
+
+	// Once either threshold is reached, publish all buffered events in one pass.
+	// The byte budget bounds memory for large events, the count keeps batches of small ones finite.
+	if (eventBuffer.size() >= bufferFlushLimit || (bufferFlushBytes > 0 && bufferedBytes >= bufferFlushBytes)) {
+		flushEventBuffer();
+	}
 }
 
 
@@ -45,6 +132,8 @@ void GStreamer::publishEventData(const std::shared_ptr<GEventDataCollection>& ev
 // Run data are published immediately instead of being buffered. The publish order
 // mirrors the base-class run sequence: start, header, detector banks, end.
 void GStreamer::publishRunData(const std::shared_ptr<GRunDataCollection>& run_data) {
+	open_pending_file();
+
 	log->info(2, "GStreamer::publishRunData->startRun: ",
 			  gutilities::success_or_fail(startRun(run_data)));
 
@@ -55,6 +144,7 @@ void GStreamer::publishRunData(const std::shared_ptr<GRunDataCollection>& run_da
 	// vector of raw pointers. The owning run collection remains alive throughout
 	// this method call.
 	for (const auto& [sdname, gDataCollection] : run_data->getDataCollectionMap()) {
+		if (!output_selection.selectsDigitized(sdname)) { continue; }
 		const GDataCollection* tdptr = gDataCollection.get();
 
 		// Extract digitized hits into a flat raw-pointer view expected by the hooks.
@@ -73,13 +163,16 @@ void GStreamer::publishRunData(const std::shared_ptr<GRunDataCollection>& run_da
 
 
 void GStreamer::flushEventBuffer() {
-	log->info(2, "GStreamer::flushEventBuffer -> flushing ", eventBuffer.size(), " events to file");
+	log->info(2, "GStreamer::flushEventBuffer -> flushing ", eventBuffer.size(), " events, about ", bufferedBytes,
+	          " bytes, to file");
 
 	// Each buffered event is treated as read-only while the plugin hooks serialize it.
 	// The buffer's shared_ptr ownership keeps all event-owned hit objects alive during the flush.
 	for (const auto& eventData : eventBuffer) {
+		open_pending_file();
 		log->info(2, SFUNCTION_NAME, "->startEvent: ",
 				  gutilities::success_or_fail(startEvent(eventData)));
+		events_in_file = true;
 
 		log->info(2, SFUNCTION_NAME, "->publishEventHeader -> ",
 				  gutilities::success_or_fail(publishEventHeader(eventData->getHeader())));
@@ -95,44 +188,66 @@ void GStreamer::flushEventBuffer() {
 			          gutilities::success_or_fail(publishEventAncestors(eventData->getAncestors())));
 		}
 
-		// Publish one detector collection at a time.
-		for (const auto& [sdname, gDataCollection] : eventData->getDataCollectionMap()) {
-			const GDataCollection* tdptr = gDataCollection.get();
-
-			// Convert ownership-bearing containers into temporary raw-pointer views.
-			// Plugins consume these views immediately and do not own the pointed data.
-			std::vector<const GTrueInfoData*>  trueInfoPtrs;
-			std::vector<const GDigitizedData*> digitizedPtrs;
-			trueInfoPtrs.reserve(tdptr->getTrueInfoData().size());
-			digitizedPtrs.reserve(tdptr->getDigitizedData().size());
-
-			for (const auto& hit : tdptr->getTrueInfoData()) { trueInfoPtrs.push_back(hit.get()); }
-			for (const auto& hit : tdptr->getDigitizedData()) { digitizedPtrs.push_back(hit.get()); }
-
-			log->info(2, SFUNCTION_NAME, "->publishEventTrueInfoData for detector -> ", sdname,
-					  gutilities::success_or_fail(publishEventTrueInfoData(sdname, trueInfoPtrs)));
+		// Publish one detector at a time from the frozen views shared by every streamer of the event,
+		// skipping the products this instance does not select. Plugins do not own the pointed data.
+		bool publishedTrueInfo = false;
+		for (const auto& view : eventData->getDetectorViews()) {
+			const std::string& sdname = *view.sdName;
+
+			if (output_selection.selectsTrueInfo(sdname)) {
+				publishedTrueInfo = true;
+				bool published;
+				if (publishTrackLayout) { published = publishEventTrueInfoData(sdname, view.trueInfo); }
+				else {
+					// The flat copies are built once per event and shared by every streamer using this layout.
+					eventData->flattenTrueInfo();
+					published = publishEventTrueInfoData(sdname, view.flatTrueInfo);
+				}
+				log->info(2, SFUNCTION_NAME, "->publishEventTrueInfoData for detector -> ", sdname,
+						  gutilities::success_or_fail(published));
+			}
+
+			if (output_selection.selectsDigitized(sdname)) {
+				log->info(2, SFUNCTION_NAME, "->publishEventDigitizedData for detector -> ", sdname,
+						  gutilities::success_or_fail(publishEventDigitizedData(sdname, view.digitized)));
+			}
+		}
 
-			log->info(2, SFUNCTION_NAME, "->publishEventDigitizedData for detector -> ", sdname,
-					  gutilities::success_or_fail(publishEventDigitizedData(sdname, digitizedPtrs)));
+		// The track layout writes the track records referenced by the published hits once per event.
+		if (publishTrackLayout && publishedTrueInfo && !eventData->getTrackTrueInfoView().empty()) {
+			log->info(2, SFUNCTION_NAME, "->publishEventTrueInfoData for tracks -> ",
+			          gutilities::success_or_fail(publishEventTrueInfoData(TRACKTRUEINFONAME,
+			                                                               eventData->getTrackTrueInfoView())));
 		}
 
 		log->info(2, "GStreamer::endEvent -> ", gutilities::success_or_fail(endEvent(eventData)));
+		rotate_if_due();
 	}
 
 	// All buffered events have now been handed to the plugin hooks.
 	eventBuffer.clear();
+	bufferedBytes = 0;
 }
 
-// stream an individual frame
-// void GStreamer::publishFrameRunData(const std::shared_ptr<GFrameDataCollection>& frameRunData) {
-// TODO: add more infor like frame number or number of entries in paylod
-
-// log->info(2, "GStreamer::publishFrameRunData:  ",
-// 	gutilities::success_or_fail(startStream(frameRunData)));
-// log->info(2, "GStreamer::publishFrameHeader:  ",
-// 	gutilities::success_or_fail(publishFrameHeader(frameRunData->getHeader())));
-// log->info(2, "GStreamer::publishPayload:  ",
-// 	gutilities::success_or_fail(publishPayload(frameRunData->getIntegralPayload())));
-// log->info(2, "GStreamer::endStream:  ",
-// 	gutilities::success_or_fail(endStream(frameRunData)));
-// }
+// Publish one frame immediately: frames are not buffered.
+void GStreamer::publishFrameRunData(const GFrameDataCollection* frameRunData) {
+	if (frameRunData == nullptr) {
+		log->error(gstreamer::ERR_PUBLISH_ERROR, "frame data is null in GStreamer::publishFrameRunData");
+	}
+
+	// Events published before the frame keep their place in the output.
+	if (!eventBuffer.empty()) { flushEventBuffer(); }
+	open_pending_file();
+
+	log->info(2, "GStreamer::startStream -> ", gutilities::success_or_fail(startStream(frameRunData)));
+	log->info(2, "GStreamer::publishFrameHeader -> ",
+	          gutilities::success_or_fail(publishFrameHeader(frameRunData->getHeader())));
+	// Plugins consume a temporary raw-pointer view of the owned payloads, as for event data.
+	std::vector<GIntegralPayload*> payloadPtrs;
+	payloadPtrs.reserve(frameRunData->getIntegralPayload().size());
+	for (const auto& payload : frameRunData->getIntegralPayload()) { payloadPtrs.push_back(payload.get()); }
+
+	log->info(2, "GStreamer::publishPayload -> ", gutilities::success_or_fail(publishPayload(&payloadPtrs)));
+	log->info(2, "GStreamer::endStream -> ", gutilities::success_or_fail(endStream(frameRunData)));
+	rotate_if_due();
+}
@@ -3,6 +3,7 @@
 // gstreamer
 #include "gstreamer_options.h"
 #include "gstreamerConventions.h"
+#include "gstreamerSelection.h"
 
 // gemc
 #include <gemc/gdata/event/gEventDataCollection.h>
@@ -10,8 +11,11 @@
 #include <gemc/gdata/frame/gFrameDataCollection.h>
 #include <gemc/gfactory/gfactory.h>
 #include <gemc/gbase/gbase.h>
+#include <gemc/ghit/gnameTable.h>
 
 // c++
+#include <algorithm>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <map>
@@ -49,15 +53,28 @@
  * For event-based output, publication is buffered. Events are accumulated in memory and written
  * in batches when the configured buffer threshold is reached or when the connection is closed.
  *
+ * With \c rotate_events or \c rotate_bytes set in the definition, the base class closes the output
+ * between two events or frames once a limit is reached. The next numbered file is opened when the
+ * next event, frame or run record is published, so no empty file is left at the end of a run.
+ * Plugins reset their per-file state in \ref closeConnectionImpl "closeConnectionImpl()" and
+ * \ref openConnection "openConnection()", so every file is complete on its own.
+ *
  * \section gstreamer_class_buffering Buffering model
  * Event publication uses an internal buffer of
  * \c std::shared_ptr<GEventDataCollection>. This design ensures that all event-owned objects remain
- * alive for the full duration of a flush. During the flush, the base class extracts raw pointers
- * from the detector collections and passes them to plugin hooks as read-only views. Generated
- * particle banks are passed by const reference from the owning event collection.
+ * alive for the full duration of a flush. Events are frozen when queued: their detector-grouped
+ * raw-pointer views are built once, by \ref GEventDataCollection::freeze "freeze()", and every
+ * streamer publishing the event passes those same views to its plugin hooks. Generated particle banks
+ * are passed by const reference from the owning event collection.
+ *
+ * The views are built for every detector, since streamers with different selections share them.
+ * Detectors and products not selected by the \ref GStreamerSelection of the instance are skipped
+ * when the buffered events are flushed, so their views are never passed to the plugin hooks.
  *
  * The buffer is flushed when:
  * - the number of queued events reaches \c bufferFlushLimit
+ * - the estimated size of the queued events, from GEventDataCollection::estimatedBytes(), reaches
+ *   \c bufferFlushBytes
  * - \ref closeConnection "closeConnection()" is called
  * - \ref startStream "startStream()" is called, to avoid mixing buffered event data with frame data
  *
@@ -107,13 +124,23 @@ public:
 	 * \brief Close the output medium after flushing buffered events.
 	 *
 	 * This public wrapper guarantees that pending event data are published before the plugin-specific
-	 * close logic executes.
+	 * close logic executes. A rotating output moves on to its next file, so reopening it, for example
+	 * in the next run, does not overwrite the file just closed. When the last record filled a rotated
+	 * file, that file is already closed and its successor was never opened, so there is nothing left
+	 * to close.
 	 *
 	 * \return \c true on success, \c false on failure.
 	 */
 	[[nodiscard]] bool closeConnection() {
 		flushEventBuffer();
-		return closeConnectionImpl();
+		if (next_file_pending) {
+			next_file_pending = false;
+			return true;
+		}
+		publish_name_tables();
+		const bool closed = closeConnectionImpl();
+		if (rotates()) { next_output_file(); }
+		return closed;
 	}
 
 	/**
@@ -130,8 +157,8 @@ public:
 	 * \brief Queue one event for publication.
 	 *
 	 * The event is appended to the internal event buffer. Once the number of buffered events reaches
-	 * \c bufferFlushLimit, the base class flushes the entire buffer by calling the event publish
-	 * hook sequence on the derived plugin.
+	 * \c bufferFlushLimit, or their estimated size reaches \c bufferFlushBytes, the base class flushes
+	 * the entire buffer by calling the event publish hook sequence on the derived plugin.
 	 *
 	 * \param event_data Event data collection to publish.
 	 */
@@ -147,6 +174,16 @@ public:
 	 */
 	void publishRunData(const std::shared_ptr<GRunDataCollection>& run_data);
 
+	/**
+	 * \brief Publish one frame immediately.
+	 *
+	 * Frames are not buffered. Pending events are flushed first, then the frame publish sequence
+	 * (startStream, publishFrameHeader, publishPayload, endStream) is dispatched to the plugin hooks.
+	 *
+	 * \param frameRunData Frame collection to publish. It must stay alive for the duration of the call.
+	 */
+	void publishFrameRunData(const GFrameDataCollection* frameRunData);
+
 	/**
 	 * \brief Return the semantic stream type associated with this streamer instance.
 	 *
@@ -161,15 +198,23 @@ public:
 	 * \brief Assign the output definition used by this streamer instance.
 	 *
 	 * The assigned definition determines the format token, base filename, type, and optional
-	 * thread-specialized naming.
+	 * thread-specialized naming. Its output selection keys are compiled here, once per run. With
+	 * rotation enabled, the rootname gets the number of the first file.
 	 *
 	 * \param gstreamerDefinition Streamer definition to bind to this instance.
 	 * \param tid Worker thread id used to specialize the filename. The default value keeps the
 	 * original name unchanged.
 	 */
-	inline void define_gstreamer(const GStreamerDefinition& gstreamerDefinition, int tid = -1) {
-		gstreamer_definitions = GStreamerDefinition(gstreamerDefinition, tid);
-	}
+	void define_gstreamer(const GStreamerDefinition& gstreamerDefinition, int tid = -1);
+
+	/**
+	 * \brief Return the compiled output selection of this streamer instance.
+	 *
+	 * Callers use it to avoid collecting data products that no streamer publishes.
+	 *
+	 * \return Selection compiled by \ref define_gstreamer "define_gstreamer()".
+	 */
+	[[nodiscard]] const GStreamerSelection& getSelection() const { return output_selection; }
 
 	/**
 	 * \brief Return the list of output format tokens supported by the module.
@@ -194,18 +239,26 @@ public:
 	/**
 	 * \brief Load streamer runtime settings from the parsed options container.
 	 *
-	 * At present this method configures the event buffer flush limit from the \c ebuffer option.
+	 * At present this method configures the event buffer flush limits from the \c ebuffer and
+	 * \c ebuffer_mb options.
 	 *
 	 * \param g Parsed options container supplying module configuration.
 	 */
 	void set_loggers(const std::shared_ptr<GOptions>& g) {
 		bufferFlushLimit = g->getRequiredScalarInt("ebuffer");
+		bufferFlushBytes = static_cast<std::size_t>(std::max(g->getRequiredScalarInt("ebuffer_mb"), 0)) << 20;
 	}
 
 protected:
 	/// \brief Output definition currently bound to this streamer instance.
 	GStreamerDefinition gstreamer_definitions;
 
+	/// \brief Detectors, products, and variables published by this instance, compiled from the definition.
+	GStreamerSelection output_selection;
+
+	/// \brief True when the definition asks for the track true-information layout.
+	bool publishTrackLayout = false;
+
 	/**
 	 * \brief Begin publishing one buffered event.
 	 *
@@ -288,6 +341,9 @@ protected:
 	 *
 	 * The vector contains raw pointers into event-owned hit objects. Those objects remain valid for
 	 * the duration of the flush because the owning event remains stored in the internal buffer.
+	 * With the flat layout the hits are event-owned flat copies holding their track variables, built
+	 * once per event and shared by every streamer; with the track layout they are the event hits,
+	 * and the event track records follow under the name \c true_tracks.
 	 *
 	 * \param detectorName Detector or sensitive-detector name identifying the collection.
 	 * \param trueInfoData Raw-pointer view of the detector true-information hits.
@@ -366,6 +422,23 @@ protected:
 	/** \brief Plugin-specific event ancestor-bank serialization hook. */
 	virtual bool publishEventAncestorsImpl([[maybe_unused]] const GAncestorBank& ancestors) { return true; }
 
+	/**
+	 * \brief Plugin-specific hook writing the name tables that resolve the ids stored in the events.
+	 *
+	 * Called once per output file, before it is closed, when the file received events. True
+	 * information stores creator processes as \c procID ids of \p processes; \p particles maps the
+	 * PDG encodings of the particles that made hits to their names. Both tables only grow during a
+	 * run, so the snapshot written at close covers every id in the file.
+	 *
+	 * \param processes Run-wide process name table.
+	 * \param particles Run-wide particle name table.
+	 * \return \c true on success, \c false on failure.
+	 */
+	virtual bool publishNameTablesImpl([[maybe_unused]] const GNameTable& processes,
+	                                   [[maybe_unused]] const GNameTable& particles) {
+		return true;
+	}
+
 	/**
 	 * \brief Plugin-specific implementation hook for one detector digitized collection.
 	 *
@@ -551,6 +624,17 @@ protected:
 	 */
 	virtual bool endStreamImpl([[maybe_unused]] const GFrameDataCollection* frameRunData) { return false; }
 
+	/**
+	 * \brief Return the bytes written so far to the current output.
+	 *
+	 * Checked after each event or frame when \c rotate_bytes is set. The bundled plugins count their
+	 * own bytes. The default, for plugins that do not, reads the size of \ref filename "filename()"
+	 * on disk, which costs a file-system call per record and misses data still buffered in memory.
+	 *
+	 * \return Bytes in the current output file or files.
+	 */
+	[[nodiscard]] virtual std::uint64_t outputBytes();
+
 	/**
 	 * \brief Flush all buffered events to the backend in publish order.
 	 *
@@ -577,6 +661,44 @@ private:
 	/// \brief Maximum number of buffered events before automatic flush.
 	size_t bufferFlushLimit = 10;
 
+	/// \brief Estimated buffered bytes that trigger an automatic flush; 0 disables the budget.
+	size_t bufferFlushBytes = 0;
+
+	/// \brief Running estimate of the memory held by \ref eventBuffer.
+	size_t bufferedBytes = 0;
+
+	/// \brief Whether the definition splits the output in numbered files.
+	[[nodiscard]] bool rotates() const {
+		return gstreamer_definitions.rotate_events > 0 || gstreamer_definitions.rotate_bytes > 0;
+	}
+
+	/// \brief Count one more event or frame in the current file and move to the next file once a limit is reached.
+	void rotate_if_due();
+
+	/// \brief Point the rootname at the next numbered file.
+	void next_output_file();
+
+	/// \brief Rootname before numbering, used to build the name of each rotated file.
+	std::string base_rootname;
+
+	/// \brief Number of the current rotated file, starting at 1.
+	int output_file_index = 0;
+
+	/// \brief Events or frames written to the current rotated file.
+	long records_in_file = 0;
+
+	/// \brief Whether a rotated file was closed and the next one is still to be opened by the next publish.
+	bool next_file_pending = false;
+
+	/// \brief Open the next rotated file if the previous one was closed by \ref rotate_if_due.
+	void open_pending_file();
+
+	/// \brief Whether events were written to the current file since its name tables were published.
+	bool events_in_file = false;
+
+	/// \brief Publish the name tables to the current file if it received events, before it is closed.
+	void publish_name_tables();
+
 public:
 	/**
 	 * \brief Instantiate a streamer plugin from a dynamic library handle.
@@ -17,6 +17,28 @@ namespace gstreamer {
  */
 inline constexpr int DEFAULT_GSTREAMER_BUFFER_FLUSH_LIMIT = 100;
 
+/**
+ * \brief Default memory budget, in megabytes, of the events buffered by one GStreamer instance.
+ *
+ * This value is used when the user does not override it through the \c ebuffer_mb option. The buffer
+ * is flushed when its estimated size reaches the budget or when it holds \c ebuffer events, whichever
+ * comes first.
+ */
+inline constexpr int DEFAULT_GSTREAMER_BUFFER_MEGABYTES = 64;
+
+/**
+ * \name True-information layouts
+ * \brief Values of the \c true_info_layout key of a gstreamer output.
+ *
+ * With the flat layout every true-information hit carries all its variables, track-level ones
+ * included. With the track layout hits keep only their own variables plus a \c trackIndex, and
+ * the event track records are published once as an extra true-information table.
+ */
+///@{
+inline constexpr const char* TRUEINFO_LAYOUT_FLAT   = "flat";
+inline constexpr const char* TRUEINFO_LAYOUT_TRACKS = "tracks";
+///@}
+
 /**
  * \name gstreamer error codes
  * \brief Error and diagnostic codes reserved for the gstreamer module.
@@ -35,6 +57,14 @@ inline constexpr int ERR_CANTOPENOUTPUT = 803;
 inline constexpr int ERR_CANTCLOSEOUTPUT = 804;
 /// Publish sequence encountered invalid state or invalid input data.
 inline constexpr int ERR_PUBLISH_ERROR = 805;
+/// Output selection names an unknown data product.
+inline constexpr int ERR_INVALID_SELECTION = 806;
+/// Output rotation limit is negative.
+inline constexpr int ERR_INVALID_ROTATION = 807;
+/// True-information layout is neither flat nor tracks.
+inline constexpr int ERR_INVALID_TRUEINFO_LAYOUT = 808;
+/// Output medium reported a failure while writing buffered content.
+inline constexpr int ERR_CANTWRITEOUTPUT = 809;
 ///@}
 
 } // namespace gstreamer
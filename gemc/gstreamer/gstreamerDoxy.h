@@ -56,6 +56,12 @@
  * \brief Binary frame streamer plugin producing packed JLAB SRO records.
  */
 
+/**
+ * \defgroup gstreamer_plugin_gbin_api gbin streamer plugin
+ * \ingroup gstreamer_module
+ * \brief Native binary columnar streamer plugin, read back with the memory-mapped gstreamer::gbin::GBinFile.
+ */
+
 /**
  * \defgroup gstreamer_examples_api gstreamer examples
  * \ingroup gstreamer_module
@@ -85,6 +91,7 @@
  * - \c csv
  * - \c jlabsro
  * - \c json
+ * - \c gbin
  *
  * These map to plugin names using the standard naming convention:
  * - \c gstreamer_root_plugin
@@ -92,6 +99,7 @@
  * - \c gstreamer_csv_plugin
  * - \c gstreamer_jlabsro_plugin
  * - \c gstreamer_json_plugin
+ * - \c gstreamer_gbin_plugin
  *
  * \section gstreamer_ownership Ownership and lifecycle
  * The module is designed around explicit ownership boundaries:
@@ -153,6 +161,7 @@
  * - CSV appends \c _generated.csv and \c _generated_tracked.csv to the configured root filename.
  * - JSON writes both banks under the event-level \c generated object.
  * - ROOT writes TTrees named \c generated and \c generated_tracked.
+ * - gbin writes tables named \c generated and \c generated_tracked.
  *
  * \subsection gstreamer_arch_design Design notes
  * Design choices in this module include:
@@ -172,6 +181,11 @@
  *   - Usage : tune batching behavior for throughput versus memory usage
  *   - Default : \c gstreamer::DEFAULT_GSTREAMER_BUFFER_FLUSH_LIMIT
  *
+ * - \c ebuffer_mb
+ *   - Meaning : estimated megabytes of buffered events, per streamer and thread, that trigger a flush
+ *   - Usage : bound peak memory when event sizes vary widely; \c ebuffer remains the upper event count
+ *   - Default : \c gstreamer::DEFAULT_GSTREAMER_BUFFER_MEGABYTES
+ *
  * - \c -gstreamer
  *   - Meaning : list of output definitions
  *   - Required fields per entry :
@@ -0,0 +1,81 @@
+#pragma once
+
+// c++
+#include <cstdint>
+
+/**
+ * \file gstreamerGbinFormat.h
+ * \brief On-disk layout of the native \c gbin columnar format, shared by the writer plugin and the reader.
+ * \ingroup gstreamer_core_api
+ *
+ * A \c .gbin file is a file header followed by a sequence of records. Every record starts with a
+ * RecordHeader and carries a payload padded to a multiple of 8 bytes, so every column written in a
+ * chunk starts on an 8-byte boundary of the file and can be read in place from a memory map.
+ *
+ * - A \c schema record declares one table: its TableKind, its name (detector or bank name), and its
+ *   ordered columns with their ColumnType. It precedes the first chunk of that table.
+ * - A \c chunk record holds a block of rows for one table, stored column by column in schema order.
+ *
+ * Payload encodings, with all integers in the byte order recorded in the file header:
+ * - schema: \c u32 table kind, \c u32 column count, table name, then per column \c u32 type and name.
+ *   Names are a \c u32 length followed by the characters.
+ * - chunk: \c u64 row count, then per column:
+ *   - \c int64 and \c float64: one 8-byte value per row
+ *   - \c string: row count + 1 \c u64 offsets into the character block that follows, the block
+ *     padded to 8 bytes
+ */
+
+namespace gstreamer::gbin {
+
+/// \brief File signature, the first 8 bytes of every \c .gbin file.
+inline constexpr char MAGIC[8] = {'G', 'E', 'M', 'C', 'B', 'I', 'N', '\0'};
+
+/// \brief Current layout version. Readers reject files with a different version.
+inline constexpr std::uint32_t FORMAT_VERSION = 1;
+
+/// \brief Written as-is by the writer; a reader finding a different value has the other byte order.
+inline constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+/// \brief Alignment of record headers, payloads, and columns.
+inline constexpr std::uint64_t ALIGNMENT = 8;
+
+/// \brief Rounds \p bytes up to the format alignment.
+constexpr std::uint64_t padded(std::uint64_t bytes) { return (bytes + ALIGNMENT - 1) & ~(ALIGNMENT - 1); }
+
+/// \brief Record types.
+enum class RecordKind : std::uint32_t { schema = 1, chunk = 2 };
+
+/// \brief Column value types.
+enum class ColumnType : std::uint32_t { int64 = 1, float64 = 2, string = 3 };
+
+/// \brief Origin of the rows in a table.
+enum class TableKind : std::uint32_t {
+	header            = 0, ///< one row per event: evn, thread_id, seeds, replayed_evn, timestamp
+	generated         = 1, ///< \c generated particle bank
+	generated_tracked = 2, ///< \c generated_tracked particle bank
+	ancestors         = 3, ///< ancestor bank
+	trueInfo          = 4, ///< one table per detector, one row per true-information hit
+	digitized         = 5, ///< one table per detector, one row per digitized hit
+	runDigitized      = 6, ///< one table per detector, run-integrated digitized hits
+	names             = 7  ///< process and particle name tables, written once before the file is closed
+};
+
+/// \brief First 16 bytes of the file.
+struct FileHeader
+{
+	char          magic[8];
+	std::uint32_t version;
+	std::uint32_t byteOrder;
+};
+
+/// \brief 16-byte header opening every record.
+struct RecordHeader
+{
+	std::uint32_t kind;  ///< RecordKind
+	std::uint32_t table; ///< table id, in order of schema declaration
+	std::uint64_t size;  ///< payload bytes following the header, already padded
+};
+
+static_assert(sizeof(FileHeader) == 16 && sizeof(RecordHeader) == 16, "gbin headers must stay 16 bytes");
+
+} // namespace gstreamer::gbin
@@ -0,0 +1,234 @@
+// gstreamer
+#include "gstreamerGbinReader.h"
+
+// c++
+#include <cstring>
+#include <sstream>
+
+// posix
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Implementation summary:
+// Map the file read-only, validate the header, and walk the records once to build the table index.
+// Chunks keep pointers to their columns inside the mapping. Every size read from the file is checked
+// against the bytes left before it is used, so a corrupt file raises GBinError instead of reading
+// outside the mapping.
+
+namespace gstreamer::gbin {
+
+namespace {
+
+/// Sequential reader of a record payload that reports truncation instead of reading past it.
+struct Cursor
+{
+	const char* pos;
+	const char* end;
+
+	template <typename T>
+	bool read(T& value) {
+		if (static_cast<std::size_t>(end - pos) < sizeof(T)) { return false; }
+		std::memcpy(&value, pos, sizeof(T));
+		pos += sizeof(T);
+		return true;
+	}
+
+	bool readName(std::string& name) {
+		std::uint32_t length = 0;
+		if (!read(length) || static_cast<std::size_t>(end - pos) < length) { return false; }
+		name.assign(pos, length);
+		pos += length;
+		return true;
+	}
+
+	bool skip(std::uint64_t bytes) {
+		if (static_cast<std::uint64_t>(end - pos) < bytes) { return false; }
+		pos += bytes;
+		return true;
+	}
+
+	/// Skips count 8-byte values, rejecting counts whose byte size would overflow.
+	bool skipValues(std::uint64_t count) {
+		if (count > static_cast<std::uint64_t>(end - pos) / sizeof(std::uint64_t)) { return false; }
+		return skip(count * sizeof(std::uint64_t));
+	}
+};
+
+template <typename... Args>
+[[noreturn]] void fail(int code, const Args&... args) {
+	std::ostringstream message;
+	(message << ... << args);
+	throw GBinError(code, message.str());
+}
+
+bool validColumnType(std::uint32_t type) {
+	return type == static_cast<std::uint32_t>(ColumnType::int64) ||
+		type == static_cast<std::uint32_t>(ColumnType::float64) ||
+		type == static_cast<std::uint32_t>(ColumnType::string);
+}
+
+const char* typeName(ColumnType type) {
+	switch (type) {
+	case ColumnType::int64: return "int64";
+	case ColumnType::float64: return "float64";
+	case ColumnType::string: return "string";
+	}
+	return "unknown";
+}
+
+} // namespace
+
+const char* GBinChunk::columnData(std::size_t column, ColumnType expected) const {
+	if (column >= columns.size()) {
+		fail(ERR_GBINCOLUMNACCESS, "gbin column index ", column, " out of range: the table has ", columns.size(),
+		     " columns");
+	}
+	if (columns[column].type != expected) {
+		fail(ERR_GBINCOLUMNACCESS, "gbin column ", column, " holds ", typeName(columns[column].type), " values, not ",
+		     typeName(expected));
+	}
+	return columns[column].data;
+}
+
+GColumnSpan<std::int64_t> GBinChunk::ints(std::size_t column) const {
+	// The writer aligns every column on 8 bytes, and the mapping is page aligned.
+	return {reinterpret_cast<const std::int64_t*>(columnData(column, ColumnType::int64)), nrows};
+}
+
+GColumnSpan<double> GBinChunk::doubles(std::size_t column) const {
+	return {reinterpret_cast<const double*>(columnData(column, ColumnType::float64)), nrows};
+}
+
+std::string_view GBinChunk::string(std::size_t column, std::uint64_t row) const {
+	const auto* offsets = reinterpret_cast<const std::uint64_t*>(columnData(column, ColumnType::string));
+	if (row >= nrows) { fail(ERR_GBINCOLUMNACCESS, "gbin row ", row, " out of range: the chunk has ", nrows, " rows"); }
+
+	const std::uint64_t first = offsets[row];
+	const std::uint64_t last  = offsets[row + 1];
+	if (first > last || last > columns[column].charBytes) {
+		fail(ERR_GBININVALIDFILE, "gbin string column ", column, " row ", row, " spans [", first, ", ", last,
+		     ") outside its ", columns[column].charBytes, " characters");
+	}
+	return {columns[column].chars + first, static_cast<std::size_t>(last - first)};
+}
+
+std::optional<std::size_t> GBinTableView::column(const std::string& columnName) const {
+	for (std::size_t c = 0; c < tableColumns.size(); c++) {
+		if (tableColumns[c].name == columnName) { return c; }
+	}
+	return std::nullopt;
+}
+
+std::uint64_t GBinTableView::rows() const {
+	std::uint64_t total = 0;
+	for (const auto& chunk : tableChunks) { total += chunk.rows(); }
+	return total;
+}
+
+GBinFile::GBinFile(const std::string& path) {
+	const int fd = ::open(path.c_str(), O_RDONLY);
+	if (fd < 0) { fail(ERR_GBININVALIDFILE, "could not open gbin file ", path); }
+
+	struct stat info{};
+	if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+		::close(fd);
+		fail(ERR_GBININVALIDFILE, path, " is too short to be a gbin file");
+	}
+
+	mappedBytes     = static_cast<std::uint64_t>(info.st_size);
+	void* const map = ::mmap(nullptr, mappedBytes, PROT_READ, MAP_PRIVATE, fd, 0);
+	// The mapping keeps its own reference to the file.
+	::close(fd);
+	if (map == MAP_FAILED) { fail(ERR_GBININVALIDFILE, "could not map gbin file ", path); }
+	mapped = static_cast<const char*>(map);
+
+	// The destructor does not run when the constructor throws: release the mapping here.
+	try { index(path); }
+	catch (...) {
+		::munmap(const_cast<char*>(mapped), mappedBytes);
+		mapped = nullptr;
+		throw;
+	}
+}
+
+GBinFile::~GBinFile() {
+	if (mapped != nullptr) { ::munmap(const_cast<char*>(mapped), mappedBytes); }
+}
+
+const GBinTableView* GBinFile::table(TableKind kind, const std::string& name) const {
+	for (const auto& t : fileTables) {
+		if (t.kind() == kind && t.name() == name) { return &t; }
+	}
+	return nullptr;
+}
+
+void GBinFile::index(const std::string& path) {
+	FileHeader header{};
+	std::memcpy(&header, mapped, sizeof(header));
+	if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+		fail(ERR_GBININVALIDFILE, path, " is not a gbin file");
+	}
+	if (header.byteOrder != BYTE_ORDER_MARK) {
+		fail(ERR_GBININVALIDFILE, path, " was written with a different byte order");
+	}
+	if (header.version != FORMAT_VERSION) {
+		fail(ERR_GBININVALIDFILE, path, " has gbin version ", header.version, ", expected ", FORMAT_VERSION);
+	}
+
+	Cursor file{mapped + sizeof(FileHeader), mapped + mappedBytes};
+	while (file.pos < file.end) {
+		RecordHeader record{};
+		if (!file.read(record) || static_cast<std::uint64_t>(file.end - file.pos) < record.size) {
+			fail(ERR_GBININVALIDFILE, path, " is truncated at byte ", file.pos - mapped);
+		}
+		Cursor payload{file.pos, file.pos + record.size};
+		file.pos += record.size;
+
+		if (record.kind == static_cast<std::uint32_t>(RecordKind::schema)) {
+			if (record.table != fileTables.size()) {
+				fail(ERR_GBININVALIDFILE, path, ": schema for table ", record.table, " out of order");
+			}
+			auto&         table = fileTables.emplace_back();
+			std::uint32_t kind = 0, ncolumns = 0;
+			bool          ok   = payload.read(kind) && payload.read(ncolumns) && payload.readName(table.tableName);
+			table.tableKind    = static_cast<TableKind>(kind);
+			for (std::uint32_t c = 0; ok && c < ncolumns; c++) {
+				std::uint32_t type = 0;
+				auto&         col  = table.tableColumns.emplace_back();
+				ok                 = payload.read(type) && validColumnType(type) && payload.readName(col.name);
+				col.type           = static_cast<ColumnType>(type);
+			}
+			if (!ok) { fail(ERR_GBININVALIDFILE, path, ": invalid schema record for table ", record.table); }
+		}
+		else if (record.kind == static_cast<std::uint32_t>(RecordKind::chunk)) {
+			if (record.table >= fileTables.size()) {
+				fail(ERR_GBININVALIDFILE, path, ": chunk for undeclared table ", record.table);
+			}
+			auto&     table = fileTables[record.table];
+			GBinChunk chunk;
+			bool      ok = payload.read(chunk.nrows);
+			for (const auto& column : table.tableColumns) {
+				if (!ok) { break; }
+				GBinChunk::ColumnData data{column.type, payload.pos};
+				if (column.type == ColumnType::string) {
+					// nrows + 1 offsets, the last one being the size of the character block.
+					ok = payload.skipValues(chunk.nrows) && payload.read(data.charBytes);
+					if (ok) {
+						data.chars = payload.pos;
+						ok         = data.charBytes <= static_cast<std::uint64_t>(payload.end - payload.pos) &&
+							payload.skip(padded(data.charBytes));
+					}
+				}
+				else { ok = payload.skipValues(chunk.nrows); }
+				chunk.columns.push_back(data);
+			}
+			if (!ok) { fail(ERR_GBININVALIDFILE, path, ": truncated chunk for table ", table.tableName); }
+			table.tableChunks.push_back(std::move(chunk));
+		}
+		// Unknown record kinds are skipped, so newer writers can add records older readers ignore.
+	}
+}
+
+} // namespace gstreamer::gbin
@@ -0,0 +1,209 @@
+#pragma once
+
+// gstreamer
+#include "gstreamerGbinFormat.h"
+
+// c++
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * \file gstreamerGbinReader.h
+ * \brief Memory-mapped reader of \c .gbin files written by the gbin streamer plugin.
+ * \ingroup gstreamer_core_api
+ */
+
+namespace gstreamer::gbin {
+
+/// \brief The file is not a readable gbin file: bad signature, version, byte order, or truncated record.
+inline constexpr int ERR_GBININVALIDFILE = 860;
+/// \brief A column was accessed with a type or index that does not match the schema.
+inline constexpr int ERR_GBINCOLUMNACCESS = 861;
+
+/**
+ * \class GBinError
+ * \ingroup gstreamer_core_api
+ * \brief Thrown by the gbin reader for unreadable files and invalid column accesses.
+ *
+ * The reader is used by analysis code that has no GEMC logger or options, so it reports errors
+ * to the caller instead of exiting the process.
+ */
+class GBinError : public std::runtime_error
+{
+public:
+	GBinError(int errorCode, const std::string& message) : std::runtime_error(message), errCode(errorCode) {}
+
+	/// \brief ERR_GBININVALIDFILE or ERR_GBINCOLUMNACCESS.
+	[[nodiscard]] int code() const { return errCode; }
+
+private:
+	int errCode;
+};
+
+/**
+ * \class GColumnSpan
+ * \ingroup gstreamer_core_api
+ * \brief Read-only view of the values of one column in one chunk, pointing into the mapped file.
+ */
+template <typename T>
+class GColumnSpan
+{
+public:
+	GColumnSpan() = default;
+
+	GColumnSpan(const T* values, std::size_t count) : ptr(values), n(count) {}
+
+	[[nodiscard]] const T* data() const { return ptr; }
+	[[nodiscard]] std::size_t size() const { return n; }
+	[[nodiscard]] bool empty() const { return n == 0; }
+	[[nodiscard]] const T* begin() const { return ptr; }
+	[[nodiscard]] const T* end() const { return ptr + n; }
+	const T& operator[](std::size_t i) const { return ptr[i]; }
+
+private:
+	const T*    ptr = nullptr;
+	std::size_t n   = 0;
+};
+
+/// \brief Name and type of one column, as declared in the table schema.
+struct GBinColumn
+{
+	std::string name;
+	ColumnType  type;
+};
+
+/**
+ * \class GBinChunk
+ * \ingroup gstreamer_core_api
+ * \brief One block of rows of a table, with every column available in place.
+ */
+class GBinChunk
+{
+public:
+	[[nodiscard]] std::uint64_t rows() const { return nrows; }
+
+	/// \brief Values of an \c int64 column. Throws GBinError for a wrong index or type.
+	[[nodiscard]] GColumnSpan<std::int64_t> ints(std::size_t column) const;
+
+	/// \brief Values of a \c float64 column. Throws GBinError for a wrong index or type.
+	[[nodiscard]] GColumnSpan<double> doubles(std::size_t column) const;
+
+	/**
+	 * \brief Value of a \c string column in row \p row.
+	 *
+	 * Throws GBinError for a wrong index, type or row, and for offsets outside the column's
+	 * character block.
+	 */
+	[[nodiscard]] std::string_view string(std::size_t column, std::uint64_t row) const;
+
+private:
+	friend class GBinFile;
+
+	/// Start of the values, or of the offsets for string columns.
+	struct ColumnData
+	{
+		ColumnType    type;
+		const char*   data;
+		const char*   chars     = nullptr;
+		std::uint64_t charBytes = 0;
+	};
+
+	const char* columnData(std::size_t column, ColumnType expected) const;
+
+	std::uint64_t           nrows = 0;
+	std::vector<ColumnData> columns;
+};
+
+/**
+ * \class GBinTableView
+ * \ingroup gstreamer_core_api
+ * \brief Schema and chunks of one table of a gbin file.
+ *
+ * The rows of a table are the rows of its chunks, in file order.
+ */
+class GBinTableView
+{
+public:
+	[[nodiscard]] TableKind kind() const { return tableKind; }
+
+	/// \brief Detector name for detector tables, bank name otherwise.
+	[[nodiscard]] const std::string& name() const { return tableName; }
+
+	[[nodiscard]] const std::vector<GBinColumn>& columns() const { return tableColumns; }
+
+	/// \brief Index of the column named \p columnName, if the table has one.
+	[[nodiscard]] std::optional<std::size_t> column(const std::string& columnName) const;
+
+	[[nodiscard]] const std::vector<GBinChunk>& chunks() const { return tableChunks; }
+
+	/// \brief Total number of rows over all chunks.
+	[[nodiscard]] std::uint64_t rows() const;
+
+private:
+	friend class GBinFile;
+
+	TableKind               tableKind{};
+	std::string             tableName;
+	std::vector<GBinColumn> tableColumns;
+	std::vector<GBinChunk>  tableChunks;
+};
+
+/**
+ * \class GBinFile
+ * \ingroup gstreamer_core_api
+ * \brief Memory-maps a gbin file and indexes its tables and chunks.
+ *
+ * Opening the file validates its header and walks the record headers once; no column data is
+ * copied or converted. Column spans returned by the chunks point into the mapping and stay valid
+ * as long as the GBinFile exists. Pages are read by the operating system on first access, so
+ * reading only a few columns touches only the pages holding them.
+ *
+ * Example:
+ * \code
+ * gstreamer::gbin::GBinFile file("out.gbin");
+ * if (const auto* ctof = file.table(gstreamer::gbin::TableKind::digitized, "ctof")) {
+ *     const auto adc = ctof->column("adc");
+ *     for (const auto& chunk : ctof->chunks()) {
+ *         for (auto value : chunk.ints(*adc)) { ... }
+ *     }
+ * }
+ * \endcode
+ */
+class GBinFile
+{
+public:
+	/**
+	 * \brief Maps and indexes \p path.
+	 *
+	 * \param path File to read.
+	 * \throws GBinError with ERR_GBININVALIDFILE when the file cannot be mapped or is malformed.
+	 */
+	explicit GBinFile(const std::string& path);
+
+	~GBinFile();
+
+	GBinFile(const GBinFile&)            = delete;
+	GBinFile& operator=(const GBinFile&) = delete;
+
+	/// \brief Tables in declaration order.
+	[[nodiscard]] const std::vector<GBinTableView>& tables() const { return fileTables; }
+
+	/// \brief The table of kind \p kind named \p name, or \c nullptr.
+	[[nodiscard]] const GBinTableView* table(TableKind kind, const std::string& name) const;
+
+	/// \brief Size of the mapped file in bytes.
+	[[nodiscard]] std::uint64_t size() const { return mappedBytes; }
+
+private:
+	void index(const std::string& path);
+
+	const char*                mapped      = nullptr;
+	std::uint64_t              mappedBytes = 0;
+	std::vector<GBinTableView> fileTables;
+};
+
+} // namespace gstreamer::gbin
@@ -0,0 +1,32 @@
+// gstreamer
+#include "gstreamerSelection.h"
+#include "gstreamerConventions.h"
+
+// gemc
+#include "gutilities.h"
+
+// Implementation summary:
+// Turn the comma-separated selection keys of a streamer definition into lookup sets and flags.
+
+GStreamerSelection::GStreamerSelection(const GStreamerDefinition& definition, const std::shared_ptr<GLogger>& log) {
+	for (const auto& name : gutilities::getStringVectorFromStringWithDelimiter(definition.detectors, ",")) {
+		detectors.insert(name);
+	}
+	for (const auto& name : gutilities::getStringVectorFromStringWithDelimiter(definition.variables, ",")) {
+		variables.insert(name);
+	}
+
+	const auto products = gutilities::getStringVectorFromStringWithDelimiter(definition.products, ",");
+	if (products.empty()) { return; }
+
+	digitized = false;
+	trueInfo  = false;
+	for (const auto& product : products) {
+		if (product == "digitized") { digitized = true; }
+		else if (product == "true_info") { trueInfo = true; }
+		else {
+			log->error(gstreamer::ERR_INVALID_SELECTION, "invalid products entry <", product, "> for output ",
+			           definition.rootname, ": must be digitized or true_info");
+		}
+	}
+}
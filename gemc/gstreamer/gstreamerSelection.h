@@ -0,0 +1,78 @@
+#pragma once
+
+// gstreamer
+#include "gstreamer_options.h"
+
+// gemc
+#include <gemc/glogging/glogger.h>
+
+// c++
+#include <memory>
+#include <string>
+#include <unordered_set>
+
+/**
+ * \file gstreamerSelection.h
+ * \brief Compiled per-streamer selection of the detector data products to publish.
+ * \ingroup gstreamer_options_api
+ */
+
+/**
+ * \class GStreamerSelection
+ * \ingroup gstreamer_options_api
+ * \brief Which detectors, data products, and variables one streamer instance publishes.
+ *
+ * \details
+ * Built once, when the definition is bound to the streamer at run start, from the optional
+ * \c detectors, \c products, and \c variables keys of its \c -gstreamer entry. Each key is a
+ * comma-separated list, and an empty key selects everything:
+ * - \c detectors : sensitive detector names
+ * - \c products : \c digitized and/or \c true_info
+ * - \c variables : true-information variable and digitized observable names
+ *
+ * The base streamer skips unselected detectors and products before building the raw-pointer views
+ * handed to the plugins. Plugins apply \ref selectsVariable "selectsVariable()" when they build
+ * their schema or format a hit. The hit identity is the hit address and is always published.
+ */
+class GStreamerSelection
+{
+public:
+	/// \brief Selects every detector, product, and variable.
+	GStreamerSelection() = default;
+
+	/**
+	 * \brief Compile the selection keys of a streamer definition.
+	 *
+	 * Unknown product names are reported with \ref gstreamer::ERR_INVALID_SELECTION.
+	 *
+	 * \param definition Streamer definition holding the selection keys.
+	 * \param log Logger used for diagnostics.
+	 */
+	GStreamerSelection(const GStreamerDefinition& definition, const std::shared_ptr<GLogger>& log);
+
+	/// \brief Whether any product of \p detectorName is published.
+	[[nodiscard]] bool selectsDetector(const std::string& detectorName) const {
+		return detectors.empty() || detectors.contains(detectorName);
+	}
+
+	/// \brief Whether the digitized data of \p detectorName are published.
+	[[nodiscard]] bool selectsDigitized(const std::string& detectorName) const {
+		return digitized && selectsDetector(detectorName);
+	}
+
+	/// \brief Whether the true-information data of \p detectorName are published.
+	[[nodiscard]] bool selectsTrueInfo(const std::string& detectorName) const {
+		return trueInfo && selectsDetector(detectorName);
+	}
+
+	/// \brief Whether the variable or observable \p variableName is published.
+	[[nodiscard]] bool selectsVariable(const std::string& variableName) const {
+		return variables.empty() || variables.contains(variableName);
+	}
+
+private:
+	std::unordered_set<std::string> detectors; ///< Selected detectors; empty selects all.
+	std::unordered_set<std::string> variables; ///< Selected variables; empty selects all.
+	bool                            digitized = true;
+	bool                            trueInfo  = true;
+};
@@ -0,0 +1,149 @@
+#pragma once
+
+// c++
+#include <charconv>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * \file gstreamerTextOutput.h
+ * \brief Locale-independent text formatting buffers shared by the text streamers (CSV, JSON).
+ * \ingroup gstreamer_core_api
+ */
+
+namespace gstreamer {
+
+/// \brief Buffered bytes after which a GTextFile hands its buffer to the file in one write.
+inline constexpr std::size_t DEFAULT_TEXT_OUTPUT_CHUNK = 1024 * 1024;
+
+/**
+ * \class GTextBuffer
+ * \ingroup gstreamer_core_api
+ * \brief Append-only text buffer with \c operator<< for strings, characters, and numbers.
+ *
+ * Numbers are converted with \c std::to_chars, so the output does not depend on the global
+ * locale, doubles use the shortest representation that reads back to the same value, and no
+ * temporary string is created per value. clear() keeps the allocated capacity, so a buffer reused
+ * across events stops allocating once it has grown to the largest event.
+ */
+class GTextBuffer
+{
+public:
+	GTextBuffer& operator<<(std::string_view text) {
+		buffer.append(text);
+		return *this;
+	}
+
+	GTextBuffer& operator<<(const std::string& text) { return *this << std::string_view(text); }
+
+	GTextBuffer& operator<<(const char* text) { return *this << std::string_view(text); }
+
+	GTextBuffer& operator<<(char c) {
+		buffer.push_back(c);
+		return *this;
+	}
+
+	/// \brief Appends an integer or floating-point value.
+	template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T> && !std::is_same_v<T, char> &&
+	                                                   !std::is_same_v<T, bool>>>
+	GTextBuffer& operator<<(T value) {
+		// 32 characters hold any int64 and the shortest round-trip form of any double.
+		constexpr std::size_t max_chars = 32;
+		const std::size_t     used      = buffer.size();
+		buffer.resize(used + max_chars);
+		const auto result = std::to_chars(buffer.data() + used, buffer.data() + used + max_chars, value);
+		buffer.resize(static_cast<std::size_t>(result.ptr - buffer.data()));
+		return *this;
+	}
+
+	/// \brief Content written so far.
+	[[nodiscard]] std::string_view view() const { return buffer; }
+
+	[[nodiscard]] std::size_t size() const { return buffer.size(); }
+
+	[[nodiscard]] bool empty() const { return buffer.empty(); }
+
+	/// \brief Drops the content, keeping the capacity.
+	void clear() { buffer.clear(); }
+
+	void reserve(std::size_t bytes) { buffer.reserve(bytes); }
+
+private:
+	std::string buffer;
+};
+
+/**
+ * \class GTextFile
+ * \ingroup gstreamer_core_api
+ * \brief GTextBuffer bound to an output file and written to it in large chunks.
+ *
+ * Values are formatted into the buffer; the buffer goes to the file in a single unformatted
+ * write once it exceeds the chunk size, and on close(). The file stream never formats anything.
+ * Write failures (full disk, lost mount) are reported by the return value of flush_if_full()
+ * and close(); callers turn them into logger errors.
+ */
+class GTextFile : public GTextBuffer
+{
+public:
+	explicit GTextFile(std::size_t chunk_bytes = DEFAULT_TEXT_OUTPUT_CHUNK) : chunk(chunk_bytes) {}
+
+	/**
+	 * \brief Opens \p path for writing, truncating it.
+	 *
+	 * \return \c true when the file is open.
+	 */
+	bool open(const std::string& path) {
+		clear();
+		reserve(chunk + chunk / 4);
+		written = 0;
+		file.clear();
+		file.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+		return file.is_open() && file.good();
+	}
+
+	[[nodiscard]] bool is_open() const { return file.is_open(); }
+
+	/// \brief Bytes written to the file since it was opened, including the content still buffered.
+	[[nodiscard]] std::uint64_t bytes() const { return written + size(); }
+
+	/**
+	 * \brief Writes the buffer to the file when it exceeds the chunk size. Call between records.
+	 *
+	 * \return \c false when the file stream is in a failed state.
+	 */
+	[[nodiscard]] bool flush_if_full() {
+		if (size() >= chunk) { return write_buffer(); }
+		return file.good();
+	}
+
+	/**
+	 * \brief Writes any buffered content and closes the file.
+	 *
+	 * \return \c false when a write or the close failed, including earlier unchecked writes.
+	 */
+	[[nodiscard]] bool close() {
+		if (!file.is_open()) { return true; }
+		const bool wrote = write_buffer();
+		file.close();
+		written = 0;
+		return wrote && !file.fail();
+	}
+
+private:
+	bool write_buffer() {
+		const auto content = view();
+		file.write(content.data(), static_cast<std::streamsize>(content.size()));
+		written += content.size();
+		clear();
+		return file.good();
+	}
+
+	std::ofstream file;
+	std::size_t   chunk;
+	std::uint64_t written = 0;
+};
+
+} // namespace gstreamer
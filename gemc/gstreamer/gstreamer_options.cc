@@ -33,6 +33,27 @@ vector<GStreamerDefinition> getGStreamerDefinition(const std::shared_ptr<GOption
 			gopts->get_required_variable_in_option<string>(goutput_item, "filename"),
 			gopts->get_variable_in_option<string>(goutput_item, "type", "event")
 		);
+
+		// ROOT storage tuning, interpreted by the root plugin only.
+		auto& goutput       = goutputs.back();
+		goutput.compression = gopts->get_optional_variable_in_option<string>(goutput_item, "compression").value_or("");
+		goutput.basket_size = gopts->get_optional_variable_in_option<string>(goutput_item, "basket_size").value_or("");
+		goutput.auto_flush  = gopts->get_optional_variable_in_option<string>(goutput_item, "auto_flush").value_or("");
+		goutput.auto_save   = gopts->get_optional_variable_in_option<string>(goutput_item, "auto_save").value_or("");
+
+		// Output selection, compiled by each streamer when its definition is bound.
+		goutput.detectors = gopts->get_optional_variable_in_option<string>(goutput_item, "detectors").value_or("");
+		goutput.products  = gopts->get_optional_variable_in_option<string>(goutput_item, "products").value_or("");
+		goutput.variables = gopts->get_optional_variable_in_option<string>(goutput_item, "variables").value_or("");
+
+		// File rotation limits. Read as double so that large byte counts can be written as 2e9.
+		goutput.rotate_events =
+			static_cast<long>(gopts->get_optional_variable_in_option<double>(goutput_item, "rotate_events").value_or(0));
+		goutput.rotate_bytes =
+			static_cast<long long>(gopts->get_optional_variable_in_option<double>(goutput_item, "rotate_bytes").value_or(0));
+
+		goutput.true_info_layout = gopts->get_variable_in_option<string>(goutput_item, "true_info_layout",
+		                                                                 TRUEINFO_LAYOUT_FLAT);
 	}
 
 	return goutputs;
@@ -63,21 +84,76 @@ GOptions defineOptions() {
 	help += "The produced files structure depends on the accumulation method used: \n \n";
 	help += " - event-based digitization (like flux) will have one file for every thread, with \"_t<thread>\" appended to the filename \n";
 	help += " - run-based digitization (like dosimeter) will have one file only\n";
+	help += "\n \n";
+	help += "ROOT outputs accept optional storage tuning keys: compression, basket_size, auto_flush, auto_save.\n";
+	help += "Each takes a comma-separated list: a bare value applies to every tree, kind=value overrides one\n";
+	help += "tree kind (header, generated, ancestors, true_info, digitized). Compression is algorithm:level\n";
+	help += "with algorithm zlib, lzma, lz4 or zstd and level 1-9, or none without a level; auto_flush and\n";
+	help += "auto_save follow the TTree convention (positive: entries, negative: bytes).\n \n";
+	help += "Example of a fast scratch output with large true-info baskets:\n \n";
+	help += " -gstreamer=\"[{format: root, filename: out, compression: 'lz4:1', basket_size: '32000, true_info=256000'}]\"\n";
+	help += "\n \n";
+	help += "Every output accepts optional selection keys, each a comma-separated list where empty selects all:\n \n";
+	help += " - detectors: sensitive detectors to publish\n";
+	help += " - products: digitized and/or true_info\n";
+	help += " - variables: true info variables and digitized observables to publish; hit addresses are always kept\n";
+	help += "\n";
+	help += "Unselected data are not formatted, and true info selected by no output is not collected.\n";
+	help += "Example that writes the flux digitized energy and time only:\n \n";
+	help += " -gstreamer=\"[{format: csv, filename: flux, detectors: flux, products: digitized, variables: 'totEdep, time'}]\"\n";
+	help += "\n \n";
+	help += "Every output can also be split in sequentially numbered files with rotate_events (events or frames\n";
+	help += "per file) and rotate_bytes (approximate bytes per file). Files are named <filename>_0001, _0002, ...\n";
+	help += "and each one is closed cleanly before the next one is opened, so completed files can be processed\n";
+	help += "while the simulation is still running.\n \n";
+	help += "Example that starts a new ROOT file every 100000 events or 2 GB:\n \n";
+	help += " -gstreamer=\"[{format: root, filename: out, rotate_events: 100000, rotate_bytes: 2e9}]\"\n";
+	help += "\n \n";
+	help += "True information is stored once per track (pid, vertices, mother, creator process). The true_info_layout\n";
+	help += "key selects how it is written:\n \n";
+	help += " - flat: every hit carries its track variables, as separate columns (default)\n";
+	help += " - tracks: hits carry a trackIndex, and the tracks are written once per event in the \"true_tracks\" table\n";
+	help += "\n";
+	help += "Example: -gstreamer=\"[{format: root, filename: out, true_info_layout: tracks}]\"\n";
 
 	// Buffer flush limit:
 	// controls how many events each streamer instance may retain in memory
 	// before the base class forces a flush to the backend.
-	string ebuffer_help = "Number of events each streamer keeps in memory before flushing them to the\n";
-	ebuffer_help        += "output file. Larger values reduce I/O frequency at the cost of more memory.\n \n";
+	string ebuffer_help = "Maximum number of events each streamer keeps in memory before flushing them to the\n";
+	ebuffer_help        += "output file. Larger values reduce I/O frequency at the cost of more memory.\n";
+	ebuffer_help        += "The buffer is also flushed earlier once it holds ebuffer_mb megabytes.\n \n";
 	ebuffer_help        += "Example: -ebuffer=100\n";
 	goptions.defineOption(GVariable("ebuffer", gstreamer::DEFAULT_GSTREAMER_BUFFER_FLUSH_LIMIT,
 	                                "number of events kept in memory before flushing them to the filestream"), ebuffer_help);
 
+	// Buffer memory budget:
+	// bounds the estimated size of the events retained by each streamer instance,
+	// so large events are flushed sooner than the ebuffer count alone would allow.
+	string ebuffer_mb_help = "Estimated memory, in megabytes, that the events buffered by each streamer in each\n";
+	ebuffer_mb_help        += "thread may hold before they are flushed to the output file. Small events are still\n";
+	ebuffer_mb_help        += "batched up to ebuffer events, while large showers are flushed as soon as they add up\n";
+	ebuffer_mb_help        += "to the budget. Peak buffer memory is about ebuffer_mb times the number of streamers\n";
+	ebuffer_mb_help        += "and threads. A value of 0 disables the budget and flushes on the event count only.\n \n";
+	ebuffer_mb_help        += "Example: -ebuffer_mb=32\n";
+	goptions.defineOption(GVariable("ebuffer_mb", gstreamer::DEFAULT_GSTREAMER_BUFFER_MEGABYTES,
+	                                "megabytes of buffered events before flushing them to the filestream"),
+	                      ebuffer_mb_help);
+
 	// Schema of each object in the -gstreamer array.
 	vector<GVariable> gstreamer = {
 		{"filename", goptions::REQUIRED, "name of output file. "},
 		{"format", goptions::REQUIRED, "format of output file. "},
 		{"type", "event", "type of output file"},
+		{"compression", std::nullopt, "ROOT compression algorithm:level, optionally per tree kind"},
+		{"basket_size", std::nullopt, "ROOT basket size in bytes, optionally per tree kind"},
+		{"auto_flush", std::nullopt, "ROOT auto-flush threshold, optionally per tree kind"},
+		{"auto_save", std::nullopt, "ROOT auto-save threshold, optionally per tree kind"},
+		{"detectors", std::nullopt, "comma-separated detectors to publish"},
+		{"products", std::nullopt, "comma-separated products to publish: digitized, true_info"},
+		{"variables", std::nullopt, "comma-separated variables to publish"},
+		{"rotate_events", std::nullopt, "events or frames per output file, 0 to disable"},
+		{"rotate_bytes", std::nullopt, "approximate bytes per output file, 0 to disable"},
+		{"true_info_layout", TRUEINFO_LAYOUT_FLAT, "true information layout: flat or tracks"},
 	};
 
 	goptions.defineOption("gstreamer", "define a gstreamer output", gstreamer, help);
@@ -32,6 +32,8 @@ constexpr const char* GSTREAMER_LOGGER = "gstreamer";
  * - the output \ref rootname base name
  * - the semantic \ref type of data to be written
  * - the optional \ref tid used to specialize filenames in multithreaded execution
+ * - the optional format-specific storage settings, output selection, file rotation, and
+ *   true-information layout
  *
  * The struct does not own any file or plugin resources. It is purely a value object used during
  * configuration parsing and streamer instantiation.
@@ -63,7 +65,10 @@ struct GStreamerDefinition
 	 * \param t Worker thread identifier. A negative value disables filename specialization.
 	 */
 	GStreamerDefinition(const GStreamerDefinition& other, int t) :
-		format(other.format), rootname(other.rootname + "_t" + std::to_string(t)), type(other.type), tid(t) {
+		format(other.format), rootname(other.rootname + "_t" + std::to_string(t)), type(other.type), tid(t),
+		compression(other.compression), basket_size(other.basket_size), auto_flush(other.auto_flush),
+		auto_save(other.auto_save), detectors(other.detectors), products(other.products), variables(other.variables),
+		rotate_events(other.rotate_events), rotate_bytes(other.rotate_bytes), true_info_layout(other.true_info_layout) {
 		if (tid < 0) {
 			rootname = other.rootname;
 		}
@@ -81,6 +86,65 @@ struct GStreamerDefinition
 	/// \brief Worker thread id associated with this definition, or a negative value when not specialized.
 	int tid = -1;
 
+	/**
+	 * \name ROOT storage tuning
+	 *
+	 * Optional settings used by the \c root format only. Each one is a list of values separated by
+	 * commas: a bare value applies to every tree, and \c kind=value overrides it for one tree kind
+	 * (\c header, \c generated, \c ancestors, \c true_info, \c digitized). Empty means the plugin default.
+	 */
+	///@{
+	/// \brief Compression as \c algorithm:level, with algorithm one of zlib, lzma, lz4, zstd, or \c none.
+	std::string compression;
+
+	/// \brief Branch basket size in bytes.
+	std::string basket_size;
+
+	/// \brief \c TTree::SetAutoFlush threshold: positive for entries, negative for bytes.
+	std::string auto_flush;
+
+	/// \brief \c TTree::SetAutoSave threshold: positive for entries, negative for bytes.
+	std::string auto_save;
+	///@}
+
+	/**
+	 * \name Output selection
+	 *
+	 * Optional comma-separated lists restricting what this output publishes, compiled into a
+	 * \ref GStreamerSelection at run start. Empty means everything.
+	 */
+	///@{
+	/// \brief Sensitive detectors to publish.
+	std::string detectors;
+
+	/// \brief Data products to publish: \c digitized and/or \c true_info.
+	std::string products;
+
+	/// \brief True-information variables and digitized observables to publish. The hit identity is always kept.
+	std::string variables;
+	///@}
+
+	/**
+	 * \name Output rotation
+	 *
+	 * When either limit is positive, the output is split in files numbered \c _0001, \c _0002, ...
+	 * after the rootname. A file is closed and the next one opened once it holds \ref rotate_events
+	 * events (or frames) or \ref rotate_bytes bytes, whichever comes first. Zero disables a limit.
+	 */
+	///@{
+	/// \brief Events or frames per file.
+	long rotate_events = 0;
+
+	/// \brief Approximate bytes per file, checked after each event or frame.
+	long long rotate_bytes = 0;
+	///@}
+
+	/**
+	 * \brief True-information layout: \c flat (default) writes every track variable with each hit,
+	 * \c tracks writes them once per track in a separate table referenced by \c trackIndex.
+	 */
+	std::string true_info_layout;
+
 	/**
 	 * \brief Return the plugin library name expected by the dynamic loader.
 	 *
@@ -120,7 +184,7 @@ std::vector<GStreamerDefinition> getGStreamerDefinition(const std::shared_ptr<GO
  * \brief Define the options contributed by the gstreamer module.
  *
  * The returned GOptions object contains:
- * - gstreamer-specific options such as \c ebuffer and \c -gstreamer
+ * - gstreamer-specific options such as \c ebuffer, \c ebuffer_mb, and \c -gstreamer
  * - the option definitions contributed by dependent modules currently aggregated here
  *
  * This function is typically used by applications and examples as the module entry point for
@@ -35,6 +35,10 @@ int main(int argc, char* argv[]) {
 		// - then a type-specific discriminator
 		bool is_equal = ctof == a_ctof_gtouchable;
 
+		// The hit-cell lookup must agree with operator==: equal touchables share a key.
+		if (ctof.sameCell(a_ctof_gtouchable) != is_equal) return EXIT_FAILURE;
+		if (is_equal && ctof.cellKey() != a_ctof_gtouchable.cellKey()) return EXIT_FAILURE;
+
 		log->info(" GTouchable: ", ctof, " is equal: ", is_equal ? "true" : "false");
 	}
 
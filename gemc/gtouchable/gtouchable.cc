@@ -14,12 +14,14 @@ GTouchable::GTouchable(const std::shared_ptr<GOptions>& gopt,
 					   const std::string&               digitization,
 					   const std::string&               gidentityString,
 					   const std::vector<double>&       dimensions,
-					   const double&                    dm) :
+					   const double&                    dm,
+					   const double&                    dv) :
 	GBase(gopt, TOUCHABLE_LOGGER),
 	trackId(0),
 	eMultiplier(1),
 	detectorDimensions(dimensions),
-	mass(dm) {
+	mass(dm),
+	volume(dv) {
 	// Determine the type based on the digitization string.
 	// The string constants are defined in gtouchableConventions.h.
 	if (digitization == gtouchable::FLUXNAME) { gType = flux; }
@@ -52,12 +54,14 @@ GTouchable::GTouchable(const std::shared_ptr<GLogger>& logger,
 					   const std::string&              digitization,
 					   const std::string&              gidentityString,
 					   const std::vector<double>&      dimensions,
-					   const double&                   dm) :
+					   const double&                   dm,
+					   const double&                   dv) :
 	GBase(logger),
 	trackId(0),
 	eMultiplier(1),
 	detectorDimensions(dimensions),
-	mass(dm) {
+	mass(dm),
+	volume(dv) {
 	// Determine the type based on the digitization string.
 	// The string constants are defined in gtouchableConventions.h.
 	if (digitization == gtouchable::FLUXNAME) { gType = flux; }
@@ -149,30 +153,63 @@ bool GTouchable::operator==(const GTouchable& that) const {
 	return typeComparison;
 }
 
+namespace {
+
+// splitmix64 finalizer: spreads every input bit over the whole key.
+std::uint64_t mixKey(std::uint64_t h) {
+	h ^= h >> 30;
+	h *= 0xbf58476d1ce4e5b9ULL;
+	h ^= h >> 27;
+	h *= 0x94d049bb133111ebULL;
+	h ^= h >> 31;
+	return h;
+}
+
+// Folds one 32-bit value into the running key; order-dependent, like the identity comparison.
+std::uint64_t combineKey(std::uint64_t key, int value) {
+	return mixKey(key ^ (static_cast<std::uint64_t>(static_cast<std::uint32_t>(value)) + 0x9e3779b97f4a7c15ULL));
+}
+
+} // namespace
+
 // Builds the hit-cell key with the same semantics as operator==: identity values plus the
-// type-specific discriminator. Kept allocation-light because it runs for every step in a
-// sensitive volume.
-std::string GTouchable::cellKey() const {
-	std::string key;
-	key.reserve(gidentity.size() * 8 + 12);
-	for (const auto& gid : gidentity) {
-		key += std::to_string(gid.getValue());
-		key += ',';
-	}
+// type-specific discriminator. Integer-only because it runs for every step in a sensitive volume.
+std::uint64_t GTouchable::cellKey() const {
+	std::uint64_t key = gidentity.size();
+	for (const auto& gid : gidentity) { key = combineKey(key, gid.getValue()); }
+
+	// The discriminator is folded last, tagged so an unset time index differs from any set one.
 	switch (gType) {
 		case readout:
-			key += 'r';
-			key += stepTimeAtElectronicsIndex ? std::to_string(*stepTimeAtElectronicsIndex) : "unset";
+			key = combineKey(key, stepTimeAtElectronicsIndex.has_value());
+			if (stepTimeAtElectronicsIndex) { key = combineKey(key, *stepTimeAtElectronicsIndex); }
 			break;
 		case flux:
-		case gPhotonDetector: key += 't'; key += std::to_string(trackId); break;
-		case particle_counter: key += 'p'; key += std::to_string(pid); break;
+		case gPhotonDetector: key = combineKey(key, trackId); break;
+		case particle_counter: key = combineKey(key, pid); break;
 		case dosimeter:
 		case integral_counter: break;
 	}
 	return key;
 }
 
+// Same comparison as operator==, without logging.
+bool GTouchable::sameCell(const GTouchable& that) const {
+	if (gidentity.size() != that.gidentity.size()) { return false; }
+	for (size_t i = 0; i < gidentity.size(); ++i) {
+		if (gidentity[i].getValue() != that.gidentity[i].getValue()) { return false; }
+	}
+	switch (gType) {
+		case readout: return stepTimeAtElectronicsIndex == that.stepTimeAtElectronicsIndex;
+		case flux:
+		case gPhotonDetector: return trackId == that.trackId;
+		case particle_counter: return pid == that.pid;
+		case dosimeter:
+		case integral_counter: return true;
+	}
+	return false;
+}
+
 // ostream GTouchable
 std::ostream& operator<<(std::ostream& stream, const GTouchable& gtouchable) {
 	stream << " GTouchable: ";
@@ -4,6 +4,7 @@
 #include <gemc/gbase/gbase.h>
 
 // c++
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -165,12 +166,14 @@ public:
 	 * \param gidentityString Identity specification string, e.g. \c "sector: 2, layer: 4, wire: 33".
 	 * \param dimensions Physical dimensions of the detector element (module-defined convention).
 	 * \param mass The mass of the detector element.
+	 * \param volume The volume of the detector element, 0 when unknown.
 	 */
 	GTouchable(const std::shared_ptr<GOptions>& gopt,
 			   const std::string&               digitization,
 			   const std::string&               gidentityString,
 			   const std::vector<double>&       dimensions,
-			   const double&                    mass);
+			   const double&                    mass,
+			   const double&                    volume = 0);
 
 	/**
 	 * \brief Constructs a \c GTouchable using an existing logger.
@@ -184,13 +187,15 @@ public:
 	 * \param gidentityString Identity specification string, e.g. \c "sector: 2, layer: 4, wire: 33".
 	 * \param dimensions Physical dimensions of the detector element (module-defined convention).
 	 * \param mass The mass of the detector element.
+	 * \param volume The volume of the detector element, 0 when unknown.
 	 *
 	 */
 	GTouchable(const std::shared_ptr<GLogger>& logger,
 			   const std::string&              digitization,
 			   const std::string&              gidentityString,
 			   const std::vector<double>&      dimensions,
-			   const double&                   mass);
+			   const double&                   mass,
+			   const double&                   volume = 0);
 
 	/**
 	 * \brief Copy constructor that preserves identity but updates the electronics time-cell index.
@@ -210,7 +215,10 @@ public:
 		  gidentity(base->gidentity),
 		  trackId(base->trackId),
 		  eMultiplier(base->eMultiplier),
-		  stepTimeAtElectronicsIndex(newTimeIndex) {
+		  stepTimeAtElectronicsIndex(newTimeIndex),
+		  detectorDimensions(base->detectorDimensions),
+		  mass(base->mass),
+		  volume(base->volume) {
 		log->debug(CONSTRUCTOR, "Copy-with-time-index", gtouchable::to_string(gType), " ", getIdentityString());
 	}
 
@@ -231,16 +239,28 @@ public:
 	bool operator==(const GTouchable& gtouchable) const;
 
 	/**
-	 * \brief Builds a compact key identifying the hit cell of this touchable.
+	 * \brief Builds an integer key identifying the hit cell of this touchable.
 	 *
-	 * Two touchables produce the same key if and only if \c operator== considers them equal:
-	 * the key concatenates the identity values and the type-specific discriminator
-	 * (time-cell index for \c readout, track id for \c flux and \c gPhotonDetector,
-	 * pid for \c particle_counter). Used for map-based hit lookups in the sensitive detector.
+	 * The key combines the identity values with the type-specific discriminator (time-cell index
+	 * for \c readout, track id for \c flux and \c gPhotonDetector, pid for \c particle_counter),
+	 * so touchables that \c operator== considers equal always produce the same key. Distinct cells
+	 * collide only with negligible probability; map-based hit lookups in the sensitive detector
+	 * confirm a key match with sameCell().
 	 *
-	 * \return The hit-cell key string.
+	 * \return The 64-bit hit-cell key.
 	 */
-	[[nodiscard]] std::string cellKey() const;
+	[[nodiscard]] std::uint64_t cellKey() const;
+
+	/**
+	 * \brief Returns true if both touchables address the same hit cell.
+	 *
+	 * Same semantics as \c operator==, without the per-comparison debug logging, for use on the
+	 * per-step hit lookup path.
+	 *
+	 * \param that The touchable to compare with.
+	 * \return True if the identity values and the type-specific discriminator match.
+	 */
+	[[nodiscard]] bool sameCell(const GTouchable& that) const;
 
 	/**
 	 * \brief Assigns the track id used by \c flux and \c dosimeter discrimination.
@@ -326,6 +346,13 @@ public:
 	 */
 	[[nodiscard]] inline double getMass() const { return mass; }
 
+	/**
+	 * \brief Returns the volume of the sensitive g4volume
+	 *
+	 * \return a double with the volume value, 0 when unknown
+	 */
+	[[nodiscard]] inline double getVolume() const { return volume; }
+
 	/**
 	 * \brief Checks whether this touchable exists in a vector using \c operator== semantics.
 	 *
@@ -398,6 +425,7 @@ private:
 	std::optional<int> stepTimeAtElectronicsIndex; ///< Readout time-cell index used for readout discrimination.
 	std::vector<double> detectorDimensions; ///< Detector dimensions stored for digitization use.
 	double mass;
+	double volume;
 
 	/// Stream output helper used in logs and diagnostics.
 	friend std::ostream& operator<<(std::ostream& stream, const GTouchable& gtouchable);